@@ -0,0 +1,520 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/benchmark_demo.c: time the core kernels, JSON output
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Times the core GraphBLAS kernels on a set of matrices, for each of a set of
+// thread counts, and writes the results to stdout as a single JSON object, so
+// that the timings of two versions of GraphBLAS, or of two settings of the
+// global options, can be compared on the same hardware.  Progress is printed
+// to stderr.
+//
+//  benchmark_demo [options] [file ...]
+//
+//  -trials k           # of trials of each kernel (default 3)
+//  -threads t1,t2,...  thread counts to use (default: 1 and the max)
+//  -scale s            size of the generated matrices (default 1)
+//  -hyper_switch h     set the global hyper_switch
+//  -bitmap_switch b    set all entries of the global bitmap_switch
+//
+// Two matrices are always generated: a Wathen matrix on a (64*s)-by-(64*s)
+// mesh (see Demo/Source/wathen.c), and the Kronecker product of a random
+// sparse (64*s)-by-(64*s) matrix with itself.  The random numbers are
+// generated with a fixed seed, so the matrices are the same in every run.
+// Each file (for example, Demo/Matrix/west0067) is read with read_matrix as
+// a 0-based matrix of triplets.
+//
+// For each kernel, the min, mean, and max time of all trials is reported.
+// The time of each trial includes GrB_wait on the result, so the work is
+// not left pending.  Setting up the inputs of each trial is not timed.
+//
+// Like the rest of the demos, this program is not a substitute for LAGraph
+// and its benchmarks of complete graph algorithms.  It times the kernels in
+// isolation.
+
+#include "graphblas_demos.h"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+#include <time.h>
+
+//------------------------------------------------------------------------------
+// global workspace
+//------------------------------------------------------------------------------
+
+#define MAX_TRIALS 100
+#define MAX_THREADS_LIST 32
+
+GrB_Matrix A = NULL, B = NULL, C = NULL, M = NULL, S = NULL, A0 = NULL ;
+GrB_Vector u = NULL, w = NULL ;
+GrB_Descriptor desc_gus = NULL, desc_hash = NULL, desc_dot = NULL ;
+GrB_Index *I = NULL, *J = NULL, *Jrot = NULL ;
+double *X = NULL ;
+void *blob = NULL ;
+FILE *file = NULL ;
+
+#define FREE_WORK                           \
+{                                           \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Matrix_free (&B) ;                  \
+    GrB_Matrix_free (&C) ;                  \
+    GrB_Matrix_free (&M) ;                  \
+    GrB_Matrix_free (&S) ;                  \
+    GrB_Matrix_free (&A0) ;                 \
+    GrB_Vector_free (&u) ;                  \
+    GrB_Vector_free (&w) ;                  \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (Jrot != NULL) free (Jrot) ;         \
+    if (X != NULL) free (X) ;               \
+    if (blob != NULL) free (blob) ;         \
+    if (file != NULL) fclose (file) ;       \
+    I = NULL ; J = NULL ; Jrot = NULL ;     \
+    X = NULL ; blob = NULL ; file = NULL ;  \
+}
+
+#define FREE_ALL                            \
+{                                           \
+    FREE_WORK ;                             \
+    GrB_Descriptor_free (&desc_gus) ;       \
+    GrB_Descriptor_free (&desc_hash) ;      \
+    GrB_Descriptor_free (&desc_dot) ;       \
+    GrB_finalize ( ) ;                      \
+}
+
+//------------------------------------------------------------------------------
+// wtime: wall clock time
+//------------------------------------------------------------------------------
+
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// JSON output
+//------------------------------------------------------------------------------
+
+static bool first_result = true ;
+
+// print a string, with quotes and backslashes escaped
+static void print_json_string (const char *s)
+{
+    printf ("\"") ;
+    for ( ; *s != '\0' ; s++)
+    {
+        if (*s == '"' || *s == '\\') printf ("\\") ;
+        printf ("%c", *s) ;
+    }
+    printf ("\"") ;
+}
+
+// report the timings of one kernel
+static void report
+(
+    const char *matrix_name,
+    const char *kernel,
+    int nthreads,
+    const double *t,
+    int ntrials
+)
+{
+    double tmin = t [0], tmax = t [0], tsum = 0 ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        tmin = MIN (tmin, t [trial]) ;
+        tmax = MAX (tmax, t [trial]) ;
+        tsum += t [trial] ;
+    }
+    printf ("%s\n    { \"matrix\": ", first_result ? "" : ",") ;
+    print_json_string (matrix_name) ;
+    printf (", \"kernel\": \"%s\", \"nthreads\": %d, \"trials\": %d, "
+        "\"min\": %.6e, \"mean\": %.6e, \"max\": %.6e }",
+        kernel, nthreads, ntrials, tmin, tsum / ntrials, tmax) ;
+    fprintf (stderr, "  %-24s nthreads %3d: %12.6f sec\n", kernel, nthreads,
+        tmin) ;
+    first_result = false ;
+}
+
+//------------------------------------------------------------------------------
+// BENCH: time a kernel for ntrials trials
+//------------------------------------------------------------------------------
+
+// setup is done before each trial, and is not timed.  The time includes the
+// method and finish, which waits for the result.
+
+#define BENCH(kernel,setup,method,finish)                               \
+{                                                                       \
+    for (int trial = 0 ; trial < ntrials ; trial++)                     \
+    {                                                                   \
+        setup ;                                                         \
+        double t0 = wtime ( ) ;                                         \
+        OK (method) ;                                                   \
+        OK (finish) ;                                                   \
+        t [trial] = wtime ( ) - t0 ;                                    \
+    }                                                                   \
+    report (matrix_name, kernel, nthreads, t, ntrials) ;                \
+}
+
+// create an empty nrows-by-ncols result matrix C
+#define NEW_C(nrows,ncols)                                              \
+{                                                                       \
+    GrB_Matrix_free (&C) ;                                              \
+    OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;                  \
+}
+
+//------------------------------------------------------------------------------
+// benchmark: time all kernels on the matrix A
+//------------------------------------------------------------------------------
+
+static GrB_Info benchmark
+(
+    const char *matrix_name,
+    int ntrials,
+    const int *threads,
+    int nthreads_list
+)
+{
+    GrB_Info info ;
+    double t [MAX_TRIALS] ;
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    fprintf (stderr, "\nmatrix %s: %g-by-%g, %g entries\n", matrix_name,
+        (double) nrows, (double) ncols, (double) nvals) ;
+
+    //--------------------------------------------------------------------------
+    // construct the inputs that are not timed
+    //--------------------------------------------------------------------------
+
+    // B = A(:,Jrot) where Jrot is a rotation of the columns, so B has the
+    // same size as A but a different pattern
+    Jrot = (GrB_Index *) malloc ((ncols + 1) * sizeof (GrB_Index)) ;
+    CHECK (Jrot != NULL, GrB_OUT_OF_MEMORY) ;
+    for (GrB_Index j = 0 ; j < ncols ; j++)
+    {
+        Jrot [j] = (j + 1) % ncols ;
+    }
+    OK (GrB_Matrix_new (&B, GrB_FP64, nrows, ncols)) ;
+    OK (GrB_Matrix_extract (B, NULL, NULL, A, GrB_ALL, nrows, Jrot, ncols,
+        NULL)) ;
+
+    // M = pattern of A'*A, the mask for the dot product method
+    OK (GrB_Matrix_new (&M, GrB_BOOL, ncols, ncols)) ;
+    OK (GrB_mxm (M, NULL, NULL, GxB_ANY_PAIR_BOOL, A, A, GrB_DESC_T0)) ;
+    OK (GrB_wait (M, GrB_MATERIALIZE)) ;
+
+    // u = dense vector of length ncols
+    OK (GrB_Vector_new (&u, GrB_FP64, ncols)) ;
+    OK (GrB_Vector_assign_FP64 (u, NULL, NULL, 1, GrB_ALL, ncols, NULL)) ;
+    OK (GrB_wait (u, GrB_MATERIALIZE)) ;
+
+    // ranges for assign and extract: the leading half of A
+    GrB_Index Irange [2], Jrange [2] ;
+    Irange [GxB_BEGIN] = 0 ; Irange [GxB_END] = nrows / 2 ;
+    Jrange [GxB_BEGIN] = 0 ; Jrange [GxB_END] = ncols / 2 ;
+    GrB_Index nrows2 = nrows / 2 + 1, ncols2 = ncols / 2 + 1 ;
+    nrows2 = MIN (nrows, nrows2) ;
+    ncols2 = MIN (ncols, ncols2) ;
+    Irange [GxB_END] = nrows2 - 1 ;
+    Jrange [GxB_END] = ncols2 - 1 ;
+    OK (GrB_Matrix_new (&S, GrB_FP64, nrows2, ncols2)) ;
+    OK (GrB_Matrix_extract (S, NULL, NULL, B, Irange, GxB_RANGE,
+        Jrange, GxB_RANGE, NULL)) ;
+    OK (GrB_wait (S, GrB_MATERIALIZE)) ;
+
+    // tuples of A, in a random order, for build and wait
+    GrB_Index n = MAX (nvals, 1) ;
+    I = (GrB_Index *) malloc (n * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) malloc (n * sizeof (GrB_Index)) ;
+    X = (double *) malloc (n * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL, GrB_OUT_OF_MEMORY) ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A)) ;
+    simple_rand_seed (42) ;
+    for (int64_t k = ((int64_t) nvals) - 1 ; k > 0 ; k--)
+    {
+        int64_t p = simple_rand_i ( ) % (k + 1) ;
+        GrB_Index ti = I [k] ; I [k] = I [p] ; I [p] = ti ;
+        GrB_Index tj = J [k] ; J [k] = J [p] ; J [p] = tj ;
+        double    tx = X [k] ; X [k] = X [p] ; X [p] = tx ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time each kernel for each thread count
+    //--------------------------------------------------------------------------
+
+    for (int kth = 0 ; kth < nthreads_list ; kth++)
+    {
+        int nthreads = threads [kth] ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+
+        // C = A'*A, with the default method, and each saxpy method forced
+        BENCH ("mxm", NEW_C (ncols, ncols),
+            GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                GrB_DESC_T0),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+        BENCH ("mxm_saxpy_gustavson", NEW_C (ncols, ncols),
+            GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                desc_gus),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+        BENCH ("mxm_saxpy_hash", NEW_C (ncols, ncols),
+            GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                desc_hash),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // C<M> = A'*A with the dot product method
+        BENCH ("mxm_dot", NEW_C (ncols, ncols),
+            GrB_mxm (C, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                desc_dot),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // w = A*u
+        BENCH ("mxv",
+            { GrB_Vector_free (&w) ;
+              OK (GrB_Vector_new (&w, GrB_FP64, nrows)) ; },
+            GrB_mxv (w, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u, NULL),
+            GrB_wait (w, GrB_MATERIALIZE)) ;
+
+        // C = A+B and C = A.*B
+        BENCH ("eWiseAdd", NEW_C (nrows, ncols),
+            GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, GrB_PLUS_FP64, A, B,
+                NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+        BENCH ("eWiseMult", NEW_C (nrows, ncols),
+            GrB_Matrix_eWiseMult_BinaryOp (C, NULL, NULL, GrB_TIMES_FP64, A, B,
+                NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // C(I,J) = S, where C starts as a copy of A
+        BENCH ("assign",
+            { GrB_Matrix_free (&C) ;
+              OK (GrB_Matrix_dup (&C, A)) ; },
+            GrB_Matrix_assign (C, NULL, NULL, S, Irange, GxB_RANGE,
+                Jrange, GxB_RANGE, NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // C = A(I,J)
+        BENCH ("extract", NEW_C (nrows2, ncols2),
+            GrB_Matrix_extract (C, NULL, NULL, A, Irange, GxB_RANGE,
+                Jrange, GxB_RANGE, NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // C = tril (A)
+        BENCH ("select", NEW_C (nrows, ncols),
+            GrB_Matrix_select_INT64 (C, NULL, NULL, GrB_TRIL, A, 0, NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // s = sum (A)
+        double s = 0 ;
+        BENCH ("reduce", ,
+            GrB_Matrix_reduce_FP64 (&s, NULL, GrB_PLUS_MONOID_FP64, A, NULL),
+            GrB_SUCCESS) ;
+
+        // C = A'
+        BENCH ("transpose", NEW_C (ncols, nrows),
+            GrB_transpose (C, NULL, NULL, A, NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // C = sparse (I,J,X), with the tuples in a random order
+        BENCH ("build", NEW_C (nrows, ncols),
+            GrB_Matrix_build_FP64 (C, I, J, X, nvals, GrB_PLUS_FP64),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+
+        // assemble the pending tuples from GrB_Matrix_setElement
+        BENCH ("wait",
+            { NEW_C (nrows, ncols) ;
+              for (GrB_Index k = 0 ; k < nvals ; k++)
+              {
+                  OK (GrB_Matrix_setElement_FP64 (C, X [k], I [k], J [k])) ;
+              } },
+            GrB_wait (C, GrB_MATERIALIZE),
+            GrB_SUCCESS) ;
+
+        // serialize A into a blob, and deserialize the blob into C
+        GrB_Index blob_size = 0 ;
+        BENCH ("serialize",
+            { if (blob != NULL) free (blob) ;
+              blob = NULL ; },
+            GxB_Matrix_serialize (&blob, &blob_size, A, NULL),
+            GrB_SUCCESS) ;
+        BENCH ("deserialize",
+            GrB_Matrix_free (&C),
+            GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL),
+            GrB_wait (C, GrB_MATERIALIZE)) ;
+        free (blob) ;
+        blob = NULL ;
+    }
+
+    FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// benchmark_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Info info ;
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+
+    //--------------------------------------------------------------------------
+    // get the options
+    //--------------------------------------------------------------------------
+
+    int ntrials = 3, scale = 1, nthreads_max = 1 ;
+    int threads [MAX_THREADS_LIST], nthreads_list = 0 ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    int argk = 1 ;
+    for ( ; argk < argc && argv [argk][0] == '-' ; argk += 2)
+    {
+        char *arg = argv [argk] ;
+        if (argk + 1 >= argc)
+        {
+            fprintf (stderr, "benchmark_demo: missing value for %s\n", arg) ;
+            FREE_ALL ;
+            return (1) ;
+        }
+        char *value = argv [argk+1] ;
+        if (strcmp (arg, "-trials") == 0)
+        {
+            ntrials = atoi (value) ;
+        }
+        else if (strcmp (arg, "-threads") == 0)
+        {
+            for (char *p = strtok (value, ",") ; p != NULL &&
+                nthreads_list < MAX_THREADS_LIST ; p = strtok (NULL, ","))
+            {
+                threads [nthreads_list++] = MAX (atoi (p), 1) ;
+            }
+        }
+        else if (strcmp (arg, "-scale") == 0)
+        {
+            scale = MAX (atoi (value), 1) ;
+        }
+        else if (strcmp (arg, "-hyper_switch") == 0)
+        {
+            OK (GxB_Global_Option_set (GxB_HYPER_SWITCH, atof (value))) ;
+        }
+        else if (strcmp (arg, "-bitmap_switch") == 0)
+        {
+            double bitmap_switch [GxB_NBITMAP_SWITCH] ;
+            for (int k = 0 ; k < GxB_NBITMAP_SWITCH ; k++)
+            {
+                bitmap_switch [k] = atof (value) ;
+            }
+            OK (GxB_Global_Option_set (GxB_BITMAP_SWITCH, bitmap_switch)) ;
+        }
+        else
+        {
+            fprintf (stderr, "benchmark_demo: unknown option %s\n", arg) ;
+            FREE_ALL ;
+            return (1) ;
+        }
+    }
+    ntrials = MAX (1, MIN (ntrials, MAX_TRIALS)) ;
+    if (nthreads_list == 0)
+    {
+        threads [nthreads_list++] = 1 ;
+        if (nthreads_max > 1) threads [nthreads_list++] = nthreads_max ;
+    }
+
+    // descriptors that force each saxpy method, and the dot product method
+    OK (GrB_Descriptor_new (&desc_gus)) ;
+    OK (GrB_Descriptor_new (&desc_hash)) ;
+    OK (GrB_Descriptor_new (&desc_dot)) ;
+    OK (GxB_Desc_set (desc_gus,  GrB_INP0, GrB_TRAN)) ;
+    OK (GxB_Desc_set (desc_hash, GrB_INP0, GrB_TRAN)) ;
+    OK (GxB_Desc_set (desc_dot,  GrB_INP0, GrB_TRAN)) ;
+    OK (GxB_Desc_set (desc_gus,  GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
+    OK (GxB_Desc_set (desc_hash, GxB_AxB_METHOD, GxB_AxB_HASH)) ;
+    OK (GxB_Desc_set (desc_dot,  GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_Desc_set (desc_dot,  GrB_MASK, GrB_STRUCTURE)) ;
+
+    //--------------------------------------------------------------------------
+    // print the library version and the settings
+    //--------------------------------------------------------------------------
+
+    char *library, *date, *compiler ;
+    int version [3], compiler_version [3] ;
+    double hyper_switch, bitmap_switch [GxB_NBITMAP_SWITCH] ;
+    OK (GxB_Global_Option_get (GxB_LIBRARY_NAME, &library)) ;
+    OK (GxB_Global_Option_get (GxB_LIBRARY_VERSION, version)) ;
+    OK (GxB_Global_Option_get (GxB_LIBRARY_DATE, &date)) ;
+    OK (GxB_Global_Option_get (GxB_COMPILER_NAME, &compiler)) ;
+    OK (GxB_Global_Option_get (GxB_COMPILER_VERSION, compiler_version)) ;
+    OK (GxB_Global_Option_get (GxB_HYPER_SWITCH, &hyper_switch)) ;
+    OK (GxB_Global_Option_get (GxB_BITMAP_SWITCH, bitmap_switch)) ;
+
+    printf ("{\n  \"library\": { \"name\": ") ;
+    print_json_string (library) ;
+    printf (", \"version\": [%d, %d, %d], \"date\": ",
+        version [0], version [1], version [2]) ;
+    print_json_string (date) ;
+    printf (", \"compiler\": ") ;
+    print_json_string (compiler) ;
+    printf (", \"compiler_version\": [%d, %d, %d] },\n",
+        compiler_version [0], compiler_version [1], compiler_version [2]) ;
+    printf ("  \"settings\": { \"trials\": %d, \"scale\": %d, "
+        "\"nthreads_max\": %d, \"hyper_switch\": %g, \"bitmap_switch\": [",
+        ntrials, scale, nthreads_max, hyper_switch) ;
+    for (int k = 0 ; k < GxB_NBITMAP_SWITCH ; k++)
+    {
+        printf ("%s%g", (k == 0) ? "" : ", ", bitmap_switch [k]) ;
+    }
+    printf ("] },\n  \"results\": [") ;
+
+    //--------------------------------------------------------------------------
+    // generated matrices
+    //--------------------------------------------------------------------------
+
+    // Wathen matrix
+    int64_t nx = 64 * scale ;
+    simple_rand_seed (1) ;
+    OK (wathen (&A, nx, nx, false, 0, NULL)) ;
+    OK (benchmark ("wathen", ntrials, threads, nthreads_list)) ;
+
+    // A = kron (A0,A0) where A0 is a random sparse matrix
+    int64_t n0 = 64 * scale ;
+    simple_rand_seed (1) ;
+    OK (random_matrix (&A0, false, false, n0, n0, 6 * n0, 1, false)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n0 * n0, n0 * n0)) ;
+    OK (GrB_Matrix_kronecker_BinaryOp (A, NULL, NULL, GrB_TIMES_FP64, A0, A0,
+        NULL)) ;
+    GrB_Matrix_free (&A0) ;
+    OK (benchmark ("kron", ntrials, threads, nthreads_list)) ;
+
+    //--------------------------------------------------------------------------
+    // matrices from files
+    //--------------------------------------------------------------------------
+
+    for ( ; argk < argc ; argk++)
+    {
+        file = fopen (argv [argk], "r") ;
+        if (file == NULL)
+        {
+            fprintf (stderr, "benchmark_demo: unable to read %s\n",
+                argv [argk]) ;
+            continue ;
+        }
+        OK (read_matrix (&A, file, false, false, false, false, false)) ;
+        fclose (file) ;
+        file = NULL ;
+        OK (benchmark (argv [argk], ntrials, threads, nthreads_list)) ;
+    }
+
+    printf ("\n  ]\n}\n") ;
+    FREE_ALL ;
+    return (0) ;
+}
+
@@ -1458,6 +1458,12 @@
 #define GxB_Col_subassign GxM_Col_subassign
 #define GxB_CONJ_FC32 GxM_CONJ_FC32
 #define GxB_CONJ_FC64 GxM_CONJ_FC64
+#define GxB_Context_disengage GxM_Context_disengage
+#define GxB_Context_engage GxM_Context_engage
+#define GxB_Context_free GxM_Context_free
+#define GxB_Context_get GxM_Context_get
+#define GxB_Context_new GxM_Context_new
+#define GxB_Context_set GxM_Context_set
 #define GxB_COPYSIGN_FP32 GxM_COPYSIGN_FP32
 #define GxB_COPYSIGN_FP64 GxM_COPYSIGN_FP64
 #define GxB_COS_FC32 GxM_COS_FC32
@@ -1996,6 +2002,7 @@
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
@@ -2012,6 +2019,7 @@
 #define GxB_Matrix_extractElement_FC64 GxM_Matrix_extractElement_FC64
 #define GxB_Matrix_extractTuples_FC32 GxM_Matrix_extractTuples_FC32
 #define GxB_Matrix_extractTuples_FC64 GxM_Matrix_extractTuples_FC64
+#define GxB_Matrix_extractTuples_Ordered GxM_Matrix_extractTuples_Ordered
 #define GxB_Matrix_fprint GxM_Matrix_fprint
 #define GxB_Matrix_import_BitmapC GxM_Matrix_import_BitmapC
 #define GxB_Matrix_import_BitmapR GxM_Matrix_import_BitmapR
@@ -2030,11 +2038,15 @@
 #define GxB_Matrix_pack_BitmapC GxM_Matrix_pack_BitmapC
 #define GxB_Matrix_pack_BitmapR GxM_Matrix_pack_BitmapR
 #define GxB_Matrix_pack_CSC GxM_Matrix_pack_CSC
+#define GxB_Matrix_pack_CSC32 GxM_Matrix_pack_CSC32
 #define GxB_Matrix_pack_CSR GxM_Matrix_pack_CSR
+#define GxB_Matrix_pack_CSR32 GxM_Matrix_pack_CSR32
 #define GxB_Matrix_pack_FullC GxM_Matrix_pack_FullC
 #define GxB_Matrix_pack_FullR GxM_Matrix_pack_FullR
 #define GxB_Matrix_pack_HyperCSC GxM_Matrix_pack_HyperCSC
 #define GxB_Matrix_pack_HyperCSR GxM_Matrix_pack_HyperCSR
+#define GxB_Matrix_read_MatrixMarket GxM_Matrix_read_MatrixMarket
+#define GxB_Matrix_read_binary_COO GxM_Matrix_read_binary_COO
 #define GxB_Matrix_reduce_FC32 GxM_Matrix_reduce_FC32
 #define GxB_Matrix_reduce_FC64 GxM_Matrix_reduce_FC64
 #define GxB_Matrix_resize GxM_Matrix_resize
@@ -2042,6 +2054,7 @@
 #define GxB_Matrix_select_FC32 GxM_Matrix_select_FC32
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
 #define GxB_Matrix_sort GxM_Matrix_sort
@@ -2064,10 +2077,13 @@
 #define GxB_Matrix_subassign_UINT8 GxM_Matrix_subassign_UINT8
 #define GxB_Matrix_type GxM_Matrix_type
 #define GxB_Matrix_type_name GxM_Matrix_type_name
+#define GxB_Matrix_unpack_Arrow GxM_Matrix_unpack_Arrow
 #define GxB_Matrix_unpack_BitmapC GxM_Matrix_unpack_BitmapC
 #define GxB_Matrix_unpack_BitmapR GxM_Matrix_unpack_BitmapR
 #define GxB_Matrix_unpack_CSC GxM_Matrix_unpack_CSC
+#define GxB_Matrix_unpack_CSC32 GxM_Matrix_unpack_CSC32
 #define GxB_Matrix_unpack_CSR GxM_Matrix_unpack_CSR
+#define GxB_Matrix_unpack_CSR32 GxM_Matrix_unpack_CSR32
 #define GxB_Matrix_unpack_FullC GxM_Matrix_unpack_FullC
 #define GxB_Matrix_unpack_FullR GxM_Matrix_unpack_FullR
 #define GxB_Matrix_unpack_HyperCSC GxM_Matrix_unpack_HyperCSC
@@ -3251,6 +3267,7 @@
 #define GxB_Vector_build_FC64 GxM_Vector_build_FC64
 #define GxB_Vector_build_Scalar GxM_Vector_build_Scalar
 #define GxB_Vector_deserialize GxM_Vector_deserialize
+#define GxB_Vector_deserialize_stream GxM_Vector_deserialize_stream
 #define GxB_Vector_diag GxM_Vector_diag
 #define GxB_Vector_eWiseUnion GxM_Vector_eWiseUnion
 #define GxB_Vector_export_Bitmap GxM_Vector_export_Bitmap
@@ -3278,6 +3295,7 @@
 #define GxB_Vector_select_FC32 GxM_Vector_select_FC32
 #define GxB_Vector_select_FC64 GxM_Vector_select_FC64
 #define GxB_Vector_serialize GxM_Vector_serialize
+#define GxB_Vector_serialize_stream GxM_Vector_serialize_stream
 #define GxB_Vector_setElement_FC32 GxM_Vector_setElement_FC32
 #define GxB_Vector_setElement_FC64 GxM_Vector_setElement_FC64
 #define GxB_Vector_sort GxM_Vector_sort
@@ -3556,8 +3574,10 @@
 #define GB_ewise_generic GM_ewise_generic
 #define GB_ewise_slice GM_ewise_slice
 #define GB_export GM_export
+#define GB_export32 GM_export32
 #define GB_extract GM_extract
 #define GB_extractTuples GM_extractTuples
+#define GB_extractTuples_ordered GM_extractTuples_ordered
 #define GB_extract_vector_list GM_extract_vector_list
 #define GB_FC32_div GM_FC32_div
 #define GB_FC64_div GM_FC64_div
@@ -3580,6 +3600,11 @@
 #define GB_Global_burble_set GM_Global_burble_set
 #define GB_Global_chunk_get GM_Global_chunk_get
 #define GB_Global_chunk_set GM_Global_chunk_set
+#define GB_Global_context_chunk_get GM_Global_context_chunk_get
+#define GB_Global_context_engage GM_Global_context_engage
+#define GB_Global_context_get GM_Global_context_get
+#define GB_Global_context_memory_add GM_Global_context_memory_add
+#define GB_Global_context_nthreads_max_get GM_Global_context_nthreads_max_get
 #define GB_Global_cpu_features_avx2 GM_Global_cpu_features_avx2
 #define GB_Global_cpu_features_avx512f GM_Global_cpu_features_avx512f
 #define GB_Global_cpu_features_query GM_Global_cpu_features_query
@@ -3587,13 +3612,19 @@
 #define GB_Global_flush_set GM_Global_flush_set
 #define GB_Global_free_function GM_Global_free_function
 #define GB_Global_free_function_set GM_Global_free_function_set
+#define GB_Global_free_pool_cache_init GM_Global_free_pool_cache_init
+#define GB_Global_free_pool_cache_limit_get GM_Global_free_pool_cache_limit_get
+#define GB_Global_free_pool_cache_limit_set GM_Global_free_pool_cache_limit_set
 #define GB_Global_free_pool_dump GM_Global_free_pool_dump
+#define GB_Global_free_pool_flush GM_Global_free_pool_flush
 #define GB_Global_free_pool_get GM_Global_free_pool_get
 #define GB_Global_free_pool_init GM_Global_free_pool_init
 #define GB_Global_free_pool_limit_get GM_Global_free_pool_limit_get
 #define GB_Global_free_pool_limit_set GM_Global_free_pool_limit_set
 #define GB_Global_free_pool_nblocks_total GM_Global_free_pool_nblocks_total
 #define GB_Global_free_pool_put GM_Global_free_pool_put
+#define GB_Global_free_pool_stats_clear GM_Global_free_pool_stats_clear
+#define GB_Global_free_pool_stats_get GM_Global_free_pool_stats_get
 #define GB_Global_get_wtime GM_Global_get_wtime
 #define GB_Global_gpu_chunk_get GM_Global_gpu_chunk_get
 #define GB_Global_gpu_chunk_set GM_Global_gpu_chunk_set
@@ -3613,6 +3644,8 @@
 #define GB_Global_hack_get GM_Global_hack_get
 #define GB_Global_hack_set GM_Global_hack_set
 #define GB_Global_have_realloc_function GM_Global_have_realloc_function
+#define GB_Global_huge_page_threshold_get GM_Global_huge_page_threshold_get
+#define GB_Global_huge_page_threshold_set GM_Global_huge_page_threshold_set
 #define GB_Global_hyper_switch_get GM_Global_hyper_switch_get
 #define GB_Global_hyper_switch_set GM_Global_hyper_switch_set
 #define GB_Global_is_csc_get GM_Global_is_csc_get
@@ -3623,10 +3656,17 @@
 #define GB_Global_malloc_debug_set GM_Global_malloc_debug_set
 #define GB_Global_malloc_function GM_Global_malloc_function
 #define GB_Global_malloc_function_set GM_Global_malloc_function_set
+#define GB_Global_malloc_is_ansi GM_Global_malloc_is_ansi
 #define GB_Global_malloc_is_thread_safe_get GM_Global_malloc_is_thread_safe_get
 #define GB_Global_malloc_is_thread_safe_set GM_Global_malloc_is_thread_safe_set
 #define GB_Global_malloc_tracking_get GM_Global_malloc_tracking_get
 #define GB_Global_malloc_tracking_set GM_Global_malloc_tracking_set
+#define GB_Global_memory_add GM_Global_memory_add
+#define GB_Global_memory_alignment_get GM_Global_memory_alignment_get
+#define GB_Global_memory_alignment_set GM_Global_memory_alignment_set
+#define GB_Global_memory_budget_get GM_Global_memory_budget_get
+#define GB_Global_memory_budget_set GM_Global_memory_budget_set
+#define GB_Global_memory_used_get GM_Global_memory_used_get
 #define GB_Global_memtable_add GM_Global_memtable_add
 #define GB_Global_memtable_clear GM_Global_memtable_clear
 #define GB_Global_memtable_dump GM_Global_memtable_dump
@@ -3640,6 +3680,9 @@
 #define GB_Global_nmalloc_get GM_Global_nmalloc_get
 #define GB_Global_nthreads_max_get GM_Global_nthreads_max_get
 #define GB_Global_nthreads_max_set GM_Global_nthreads_max_set
+#define GB_Global_numa_nodes_get GM_Global_numa_nodes_get
+#define GB_Global_numa_policy_get GM_Global_numa_policy_get
+#define GB_Global_numa_policy_set GM_Global_numa_policy_set
 #define GB_Global_omp_get_max_threads GM_Global_omp_get_max_threads
 #define GB_Global_printf_get GM_Global_printf_get
 #define GB_Global_printf_set GM_Global_printf_set
@@ -3649,6 +3692,25 @@
 #define GB_Global_print_one_based_set GM_Global_print_one_based_set
 #define GB_Global_realloc_function GM_Global_realloc_function
 #define GB_Global_realloc_function_set GM_Global_realloc_function_set
+#define GB_Global_spill_add GM_Global_spill_add
+#define GB_Global_spill_directory_get GM_Global_spill_directory_get
+#define GB_Global_spill_directory_set GM_Global_spill_directory_set
+#define GB_Global_spill_find GM_Global_spill_find
+#define GB_Global_spill_nblocks GM_Global_spill_nblocks
+#define GB_Global_spill_ok GM_Global_spill_ok
+#define GB_Global_spill_remove GM_Global_spill_remove
+#define GB_Global_spill_threshold_get GM_Global_spill_threshold_get
+#define GB_Global_spill_threshold_set GM_Global_spill_threshold_set
+#define GB_Global_telemetry_bytes_add GM_Global_telemetry_bytes_add
+#define GB_Global_telemetry_bytes_get GM_Global_telemetry_bytes_get
+#define GB_Global_telemetry_call_id GM_Global_telemetry_call_id
+#define GB_Global_telemetry_get GM_Global_telemetry_get
+#define GB_Global_telemetry_set GM_Global_telemetry_set
+#define GB_Global_thread_share_begin GM_Global_thread_share_begin
+#define GB_Global_thread_share_end GM_Global_thread_share_end
+#define GB_Global_thread_share_get GM_Global_thread_share_get
+#define GB_Global_thread_sharing_get GM_Global_thread_sharing_get
+#define GB_Global_thread_sharing_set GM_Global_thread_sharing_set
 #define GB_Global_timing_add GM_Global_timing_add
 #define GB_Global_timing_clear GM_Global_timing_clear
 #define GB_Global_timing_clear_all GM_Global_timing_clear_all
@@ -3664,6 +3726,8 @@
 #define GB_helper5 GM_helper5
 #define GB_helper7 GM_helper7
 #define GB_helper8 GM_helper8
+#define GB_huge_page_advise GM_huge_page_advise
+#define GB_huge_page_supported GM_huge_page_supported
 #define GB_hypermatrix_prune GM_hypermatrix_prune
 #define GB_hyper_prune GM_hyper_prune
 #define GB_hyper_realloc GM_hyper_realloc
@@ -3681,6 +3745,7 @@
 #define GB_ijproperties GM_ijproperties
 #define GB_ijsort GM_ijsort
 #define GB_import GM_import
+#define GB_import32 GM_import32
 #define GB_IndexUnaryOp_check GM_IndexUnaryOp_check
 #define GB_init GM_init
 #define GB_int64_multiply GM_int64_multiply
@@ -3813,6 +3878,8 @@
 #define GB_nnz_full GM_nnz_full
 #define GB_nnz_held GM_nnz_held
 #define GB_nnz_max GM_nnz_max
+#define GB_numa_online_nodes GM_numa_online_nodes
+#define GB_numa_place GM_numa_place
 #define GB_nvals GM_nvals
 #define GB_nvec_nonempty GM_nvec_nonempty
 #define GB_Operator_check GM_Operator_check
@@ -3849,6 +3916,9 @@
 #define GB_qsort_1b_size8 GM_qsort_1b_size8
 #define GB_qsort_2 GM_qsort_2
 #define GB_qsort_3 GM_qsort_3
+#define GB_read_MatrixMarket GM_read_MatrixMarket
+#define GB_read_binary_COO GM_read_binary_COO
+#define GB_read_build GM_read_build
 #define GB_realloc_memory GM_realloc_memory
 #define GB_reduce_to_scalar GM_reduce_to_scalar
 #define GB_reduce_to_vector GM_reduce_to_vector
@@ -3856,6 +3926,7 @@
 #define GB_Scalar_check GM_Scalar_check
 #define GB_Scalar_reduce GM_Scalar_reduce
 #define GB_Scalar_wrap GM_Scalar_wrap
+#define GB_same_pattern GM_same_pattern
 #define GB_select GM_select
 #define GB_SelectOp_check GM_SelectOp_check
 #define GB_SelectOp_new GM_SelectOp_new
@@ -3866,6 +3937,7 @@
 #define GB_serialize_array GM_serialize_array
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream GM_serialize_stream
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
 #define GB_shallow_copy GM_shallow_copy
@@ -3876,6 +3948,10 @@
 #define GB_slice_vector GM_slice_vector
 #define GB_sort GM_sort
 #define GB_sparsity_control GM_sparsity_control
+#define GB_spill_directory_set GM_spill_directory_set
+#define GB_spill_free GM_spill_free
+#define GB_spill_malloc GM_spill_malloc
+#define GB_spill_unspill GM_spill_unspill
 #define GB_split GM_split
 #define GB_split_bitmap GM_split_bitmap
 #define GB_split_full GM_split_full
@@ -3916,6 +3992,9 @@
 #define GB_subref_phase3 GM_subref_phase3
 #define GB_subref_slice GM_subref_slice
 #define GB_task_cumsum GM_task_cumsum
+#define GB_telemetry_end GM_telemetry_end
+#define GB_telemetry_event GM_telemetry_event
+#define GB_telemetry_start GM_telemetry_start
 #define GB_transplant GM_transplant
 #define GB_transplant_conform GM_transplant_conform
 #define GB_transpose GM_transpose
@@ -3932,6 +4011,7 @@
 #define GB_UnaryOp_new GM_UnaryOp_new
 #define GB_unjumble GM_unjumble
 #define GB_unop_one GM_unop_one
+#define GB_unshallow GM_unshallow
 #define GB_Vector_check GM_Vector_check
 #define GB_Vector_diag GM_Vector_diag
 #define GB_Vector_removeElement GM_Vector_removeElement
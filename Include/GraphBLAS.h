@@ -471,7 +471,10 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 //
 // GxB_IMPORT:  GxB_FAST_IMPORT (faster, for trusted input data) or
 //      GxB_SECURE_IMPORT (slower, for untrusted input data), for the
-//      GxB*_pack* methods.
+//      GxB*_pack* methods.  GxB_SHALLOW_IMPORT is for GxB_Matrix_deserialize
+//      and GxB_Vector_deserialize only: uncompressed arrays in the blob are
+//      not copied (see GxB_Matrix_deserialize for details).  The GxB*_pack*
+//      methods treat GxB_SHALLOW_IMPORT as GxB_SECURE_IMPORT.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field for global options.  They are defined with the same integer
@@ -534,7 +537,9 @@ typedef enum
     GxB_AxB_SAXPY     = 1005,   // saxpy method (any kind)
 
     // for GxB_IMPORT only:
-    GxB_SECURE_IMPORT = 502     // GxB*_pack* methods trust their input data
+    GxB_SECURE_IMPORT = 502,    // GxB*_pack* methods trust their input data
+    GxB_SHALLOW_IMPORT = 503    // GxB*_deserialize may return a matrix whose
+                                // content is held in the blob itself
 }
 GrB_Desc_Value ;
 
@@ -4184,6 +4189,33 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
     (I, J, X, nvals, A)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractTuples_Ordered: extract tuples in row or column order
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_extractTuples_Ordered is like GrB_Matrix_extractTuples, except
+// that the tuples are returned in a specified order, regardless of the format
+// of A.  If order is GxB_BY_ROW (0), the tuples are sorted by row index and
+// then by column index.  If order is GxB_BY_COL (1), they are sorted by column
+// index and then by row index.  If order is GxB_NO_FORMAT (-1), they are
+// returned in the order they are held in A, which is fastest (they may then
+// be unsorted).  The values are typecasted to xtype as they are written into
+// X.  If xtype is NULL, the type of A is used.  A user-defined xtype must be
+// the same as the type of A.  Any of I, J, and X may be NULL.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractTuples_Ordered   // [I,J,X] = find (A), in order
+(
+    GrB_Index *I,               // array for returning row indices of tuples
+    GrB_Index *J,               // array for returning col indices of tuples
+    void *X,                    // array for returning values of tuples
+    GrB_Index *nvals,           // I,J,X size on input; # tuples on output
+    GrB_Type xtype,             // type of X (NULL: the type of A)
+    int order,                  // GxB_BY_ROW, GxB_BY_COL, or GxB_NO_FORMAT
+    const GrB_Matrix A,         // matrix to extract tuples from
+    const GrB_Descriptor desc   // currently unused
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_concat and GxB_Matrix_split
 //------------------------------------------------------------------------------
@@ -4377,6 +4409,24 @@ typedef enum            // for global options or matrix options
     GxB_FLUSH = 102,    // flush function diagnostic output
     GxB_MEMORY_POOL = 103,  // memory pool control
     GxB_PRINT_1BASED = 104,   // print matrices as 0-based or 1-based
+    GxB_MEMORY_POOL_CACHE = 105,    // memory pool cache control
+    GxB_MEMORY_POOL_STATS = 106,    // memory pool hit/miss counters
+    GxB_TELEMETRY_FUNCTION = 107,   // telemetry callback (see below)
+    GxB_THREAD_SHARING = 110,       // share threads between concurrent calls
+    GxB_NUMA_POLICY = 111,          // NUMA placement of large arrays
+    GxB_MEMORY_ALIGNMENT = 112,     // alignment of all new arrays
+    GxB_HUGE_PAGE_THRESHOLD = 113,  // huge pages for large arrays
+    GxB_MEMORY_BUDGET = 114,        // max memory used by GraphBLAS
+    GxB_MEMORY_USED = 115,          // memory in use by GraphBLAS (get only)
+    GxB_SPILL_DIRECTORY = 116,      // directory for spilled arrays
+    GxB_SPILL_THRESHOLD = 117,      // min size of spilled arrays
+
+    //------------------------------------------------------------
+    // for GxB_Context_set/get only (with GxB_NTHREADS and GxB_CHUNK):
+    //------------------------------------------------------------
+
+    GxB_CONTEXT_MAX_MEMORY = 108,   // memory budget in bytes (int64_t)
+    GxB_CONTEXT_MEMORY_USED = 109,  // bytes charged to the context (get only)
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get only:
@@ -4552,6 +4602,86 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
     ...                             // return value of the global option
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Context: execution context for a user thread
+//------------------------------------------------------------------------------
+
+// The global settings for the number of threads and chunk size are shared by
+// all user threads, and GrB_*_dup, _build, _wait, _extractTuples, and
+// GxB_*_resize take no descriptor, so they always use the global settings.  A
+// GxB_Context holds the settings for one caller (a tenant of a server, for
+// example).  A user thread engages a context with GxB_Context_engage, and then
+// all GraphBLAS methods that thread calls use the settings in the context,
+// until the thread calls GxB_Context_disengage.  Other threads are not
+// affected, and several threads may engage the same context.
+//
+//      GxB_set (GxB_Context c, GxB_NTHREADS, int nthreads_max) ;
+//      GxB_get (GxB_Context c, GxB_NTHREADS, int *nthreads_max) ;
+//
+//      GxB_set (GxB_Context c, GxB_CHUNK, double chunk) ;
+//      GxB_get (GxB_Context c, GxB_CHUNK, double *chunk) ;
+//
+//      GxB_set (GxB_Context c, GxB_CONTEXT_MAX_MEMORY, int64_t max_memory) ;
+//      GxB_get (GxB_Context c, GxB_CONTEXT_MAX_MEMORY, int64_t *max_memory) ;
+//
+//      GxB_get (GxB_Context c, GxB_CONTEXT_MEMORY_USED, int64_t *memory_used) ;
+//
+// If the nthreads_max or chunk of the context is GxB_DEFAULT (the default),
+// the global setting is used.  An nthreads_max given in a descriptor takes
+// precedence over the context.  If max_memory is greater than zero, any
+// allocation that would make the memory charged to the context exceed
+// max_memory fails, and the method returns GrB_OUT_OF_MEMORY.  Memory is
+// charged to the context engaged by the thread that allocates it, and
+// returned to the context engaged by the thread that frees it, so the count
+// is exact only if the objects created while a context is engaged are also
+// freed while it is engaged.  Arrays moved into or out of GraphBLAS by
+// GxB_*_pack, GxB_*_unpack, import, export, and serialize are not counted.
+// A context must be disengaged by all threads before it is freed.
+// GxB_Context_engage returns GrB_NOT_IMPLEMENTED if the compiler does not
+// support thread-local storage.
+
+typedef struct GB_Context_opaque *GxB_Context ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_new        // create a new context
+(
+    GxB_Context *Context        // handle of context to create
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_free       // free a context
+(
+    GxB_Context *Context        // handle of context to free
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_set        // set a parameter in a context
+(
+    GxB_Context Context,        // context to modify
+    GxB_Option_Field field,     // parameter to change
+    ...                         // value to change it to
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_get        // get a parameter from a context
+(
+    GxB_Context Context,        // context to query
+    GxB_Option_Field field,     // parameter to query
+    ...                         // return value of the parameter
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_engage     // engage a context for this user thread
+(
+    GxB_Context Context         // context to engage
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_disengage  // disengage the context of this user thread
+(
+    GxB_Context Context         // context to disengage (NULL: any context)
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_set and GxB_get
 //------------------------------------------------------------------------------
@@ -4602,6 +4732,165 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_MEMORY_POOL, free_pool_limit) ;
 //      GxB_set (GxB_MEMORY_POOL, NULL) ;     // set defaults
 //      GxB_get (GxB_MEMORY_POOL, free_pool_limit) ;
+//
+//      int64_t free_pool_cache_limit [64] ;
+//      GxB_set (GxB_MEMORY_POOL_CACHE, free_pool_cache_limit) ;
+//      GxB_set (GxB_MEMORY_POOL_CACHE, NULL) ;     // set defaults
+//      GxB_get (GxB_MEMORY_POOL_CACHE, free_pool_cache_limit) ;
+//
+//      int64_t free_pool_stats [3] ;
+//      GxB_get (GxB_MEMORY_POOL_STATS, free_pool_stats) ;
+//      GxB_set (GxB_MEMORY_POOL_STATS, NULL) ;     // clear the counters
+//
+//      GxB_set (GxB_TELEMETRY_FUNCTION, GxB_telemetry_function_t f) ;
+//      GxB_get (GxB_TELEMETRY_FUNCTION, GxB_telemetry_function_t *f) ;
+//
+//      GxB_set (GxB_THREAD_SHARING, bool sharing) ;
+//      GxB_get (GxB_THREAD_SHARING, bool *sharing) ;
+//
+//      GxB_set (GxB_NUMA_POLICY, GxB_NUMA_FIRST_TOUCH) ;
+//      GxB_set (GxB_NUMA_POLICY, GxB_NUMA_INTERLEAVE) ;
+//      GxB_set (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT) ;
+//      GxB_get (GxB_NUMA_POLICY, int *policy) ;
+//
+//      GxB_set (GxB_MEMORY_ALIGNMENT, int alignment) ;
+//      GxB_get (GxB_MEMORY_ALIGNMENT, int *alignment) ;
+//
+//      GxB_set (GxB_HUGE_PAGE_THRESHOLD, int64_t threshold) ;
+//      GxB_get (GxB_HUGE_PAGE_THRESHOLD, int64_t *threshold) ;
+//
+//      GxB_set (GxB_MEMORY_BUDGET, int64_t budget) ;
+//      GxB_get (GxB_MEMORY_BUDGET, int64_t *budget) ;
+//      GxB_get (GxB_MEMORY_USED, int64_t *used) ;
+//
+//      GxB_set (GxB_SPILL_DIRECTORY, const char *dir) ;
+//      GxB_get (GxB_SPILL_DIRECTORY, const char **dir) ;
+//      GxB_set (GxB_SPILL_THRESHOLD, int64_t threshold) ;
+//      GxB_get (GxB_SPILL_THRESHOLD, int64_t *threshold) ;
+
+// The memory pool keeps freed blocks of size 2^k for reuse.  Each thread uses
+// a cache of up to free_pool_cache_limit [k] blocks of size 2^k (shared with
+// other threads only if there are more than 64), in front of a shared pool of
+// up to free_pool_limit [k] blocks.  The counters are the # of blocks taken
+// from a cache, the # taken from the shared pool, and the # of misses.
+
+// If several user threads call GraphBLAS at the same time, each call uses up
+// to nthreads_max threads, and the cores are oversubscribed.  If
+// GxB_THREAD_SHARING is true (it is false by default), each parallel region
+// of a method is limited to an equal share of the global nthreads_max among
+// all methods currently running, so concurrent calls divide the cores
+// between them.  A call that starts while others are running begins with a
+// smaller share, and each later parallel region uses a larger one as the
+// other calls finish.  GxB_set (GxB_THREAD_SHARING, true) returns
+// GrB_NOT_IMPLEMENTED if the compiler does not support thread-local storage.
+
+// GxB_NUMA_POLICY controls where the pages of each newly allocated block of
+// 1 MB or more (such as the Ap, Ai, and Ax arrays of a large matrix) are
+// placed on a NUMA system.  With GxB_NUMA_DEFAULT, the pages are placed by
+// the operating system when the kernels first touch them.  With
+// GxB_NUMA_FIRST_TOUCH, the block is split into one equal slice per thread
+// and each thread touches its own slice when the block is allocated (and
+// clears it, for calloc), so that a kernel that gives each thread an equal
+// number of entries mostly reads memory local to that thread.  This requires
+// the OpenMP threads to be bound to cores (OMP_PROC_BIND=true, for example).
+// With GxB_NUMA_INTERLEAVE, the pages are interleaved across all NUMA nodes
+// (Linux only; GxB_set returns GrB_NOT_IMPLEMENTED if this is not available).
+
+// GxB_MEMORY_ALIGNMENT sets the alignment, in bytes, of every block that
+// GraphBLAS allocates from then on (including the Ap, Ah, Ai, Ab, and Ax
+// arrays of a matrix, but not the arrays that are imported or packed into a
+// matrix by the user application).  It must be zero (the default, which gives
+// the alignment of malloc), or a power of two from sizeof (void *) to 2 MB;
+// 64 gives each array its own cache lines, and allows aligned SIMD loads.
+// The blocks in the memory pool are freed when the alignment is changed.
+// This requires the ANSI C malloc and free (GrB_init); GxB_set returns
+// GrB_NOT_IMPLEMENTED if GraphBLAS was started with GxB_init and another
+// memory manager.  realloc is not used while an alignment is set.
+
+// GxB_HUGE_PAGE_THRESHOLD asks the operating system to back each newly
+// allocated block of at least threshold bytes with 2 MB transparent huge
+// pages, which reduces the TLB misses of kernels that access large arrays at
+// random.  With the ANSI C malloc, these blocks are also aligned on a 2 MB
+// boundary.  A threshold of zero (the default) disables huge pages; any
+// other threshold below 2 MB is treated as 2 MB.  GxB_set returns
+// GrB_NOT_IMPLEMENTED if transparent huge pages are not available (they
+// require Linux).
+
+// GxB_MEMORY_BUDGET limits the memory, in bytes, in use by all GraphBLAS
+// objects and workspace in the process, in addition to the budget of the
+// GxB_Context of each user thread (zero, the default, means no limit).  An
+// allocation that would exceed either budget fails, and the method returns
+// GrB_OUT_OF_MEMORY, unless the block can be spilled.  GxB_MEMORY_USED is
+// the memory currently in use.  The budget is checked but not reserved in a
+// single atomic step, so concurrent calls may exceed it slightly.  Blocks in
+// the memory pool, and arrays imported from (or exported to) the user
+// application, are not counted.
+
+// If a spill directory is set (it is NULL by default), then a block of at
+// least GxB_SPILL_THRESHOLD bytes (64 MB by default) that would exceed a
+// memory budget, or that malloc cannot allocate, is placed in a temporary
+// file in that directory and mapped into memory instead.  The method that
+// allocates it (typically for the Ai and Ax arrays of its output, or for
+// large workspace) runs more slowly, since its pages are read from and
+// written to the file as needed, but it does not fail.  The files are
+// deleted when the blocks are freed, or if the process terminates.  Spilled
+// arrays are moved back into memory if they are exported, unpacked, or
+// serialized.  Spilled blocks are not counted in GxB_MEMORY_USED.  Setting
+// the directory to NULL disables spilling; GxB_set returns GrB_INVALID_VALUE
+// if the directory cannot be written, or GrB_NOT_IMPLEMENTED if mmap is not
+// available.
+
+#define GxB_NUMA_DEFAULT 0
+#define GxB_NUMA_FIRST_TOUCH 1
+#define GxB_NUMA_INTERLEAVE 2
+
+//------------------------------------------------------------------------------
+// telemetry
+//------------------------------------------------------------------------------
+
+// GxB_set (GxB_TELEMETRY_FUNCTION, f) installs a function f that is called
+// with a GxB_Telemetry_Event record each time a user-callable method that
+// reports a burble completes (GxB_TELEMETRY_CALL), and each time that method
+// selects an internal algorithm (GxB_TELEMETRY_METHOD), converts a matrix to
+// another sparsity format (GxB_TELEMETRY_CONVERT), transposes a matrix
+// (GxB_TELEMETRY_TRANSPOSE), or finishes a timed phase of an algorithm
+// (GxB_TELEMETRY_PHASE).  Unlike the burble, the events do not depend on
+// GxB_BURBLE and are not printed.  All events of one call have the same
+// call_id, and are delivered from the user thread that made the call, so the
+// function f must be thread-safe if GraphBLAS is called from multiple user
+// threads.  The event and its strings are only valid during the call to f.
+// GxB_set (GxB_TELEMETRY_FUNCTION, NULL) disables the telemetry.
+
+typedef enum
+{
+    GxB_TELEMETRY_CALL = 0,         // a user-callable method has finished
+    GxB_TELEMETRY_METHOD = 1,       // an internal algorithm has been selected
+    GxB_TELEMETRY_CONVERT = 2,      // a matrix has changed its sparsity format
+    GxB_TELEMETRY_TRANSPOSE = 3,    // a matrix has been transposed
+    GxB_TELEMETRY_PHASE = 4         // a phase of an algorithm has finished
+}
+GxB_Telemetry_Kind ;
+
+typedef struct
+{
+    GxB_Telemetry_Kind kind ;   // kind of event
+    uint64_t call_id ;          // unique id of the user-callable method call
+    const char *operation ;     // user-callable method ("GrB_mxm", ...)
+    const char *method ;        // algorithm, conversion, transpose, or phase
+                                // (for example "saxpy3:hash", "dot3",
+                                // "sparse to bitmap"); NULL for CALL events
+    double time ;               // seconds: for CALL, the whole call; for
+                                // PHASE, the phase; otherwise the time since
+                                // the call started
+    double flops ;              // flop count, or 0 if not known
+    int nthreads ;              // # of threads used, or 0 if not known
+    int64_t bytes ;             // CALL only: # of bytes allocated by the
+                                // calling thread during the call, or -1 if not
+                                // known; zero for other events
+}
+GxB_Telemetry_Event ;
+
+typedef void (*GxB_telemetry_function_t) (const GxB_Telemetry_Event *event) ;
 
 // To get global options that can be queried but not modified:
 //
@@ -4693,7 +4982,8 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             GxB_Option_Field : GxB_Global_Option_set ,          \
             GrB_Vector       : GxB_Vector_Option_set ,          \
             GrB_Matrix       : GxB_Matrix_Option_set ,          \
-            GrB_Descriptor   : GxB_Desc_set                     \
+            GrB_Descriptor   : GxB_Desc_set                   , \
+            GxB_Context      : GxB_Context_set                  \
     )                                                           \
     (arg1, __VA_ARGS__)
 
@@ -4710,7 +5000,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             const GrB_Matrix       : GxB_Matrix_Option_get ,    \
                   GrB_Matrix       : GxB_Matrix_Option_get ,    \
             const GrB_Descriptor   : GxB_Desc_get          ,    \
-                  GrB_Descriptor   : GxB_Desc_get               \
+                  GrB_Descriptor   : GxB_Desc_get          ,    \
+            const GxB_Context      : GxB_Context_get       ,    \
+                  GxB_Context      : GxB_Context_get            \
     )                                                           \
     (arg1, __VA_ARGS__)
 #endif
@@ -4739,6 +5031,7 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             GrB_Vector       *: GrB_Vector_free       , \
             GrB_Matrix       *: GrB_Matrix_free       , \
             GrB_Descriptor   *: GrB_Descriptor_free   , \
+            GxB_Context      *: GxB_Context_free      , \
             GxB_Iterator     *: GxB_Iterator_free       \
     )                                                   \
     (object)
@@ -10754,6 +11047,143 @@ GrB_Info GxB_Vector_unpack_Full   // unpack a full vector
     const GrB_Descriptor desc
 ) ;
 
+//==============================================================================
+// GxB pack/unpack with 32-bit indices
+//==============================================================================
+
+// GxB_Matrix_pack_CSR32 and GxB_Matrix_pack_CSC32 are identical to
+// GxB_Matrix_pack_CSR and GxB_Matrix_pack_CSC, except that the pointers Ap
+// and indices Aj or Ai are uint32_t arrays.  This allows matrices with fewer
+// than 2^32 entries and a dimension no larger than 2^32, held in 32-bit CSR
+// or CSC form by another library, to be handed to GraphBLAS without first
+// being converted by the application.  GraphBLAS holds its indices in 64
+// bits, so these arrays are widened in parallel into new arrays, and then
+// freed; the values Ax are packed with no copy, as GxB_Matrix_pack_CSR does.
+// Just as for GxB_Matrix_pack_CSR, the arrays must be allocated by the same
+// malloc function that GraphBLAS uses, and are returned as NULL if the pack
+// is successful.  If it fails, Ap and Aj (or Ai) are not modified, and remain
+// owned by the application.
+
+// GxB_Matrix_unpack_CSR32 and GxB_Matrix_unpack_CSC32 are identical to
+// GxB_Matrix_unpack_CSR and GxB_Matrix_unpack_CSC, except that Ap and Aj or
+// Ai are returned as newly allocated uint32_t arrays.  GrB_INVALID_VALUE is
+// returned, and the matrix is not unpacked, if nvals(A) >= 2^32 or if the
+// indices of A (column indices for CSR32, row indices for CSC32) do not fit
+// in 32 bits.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_pack_CSR32    // pack a CSR matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // row "pointers", Ap_size >= (nrows+1)*sizeof(uint32_t)
+    uint32_t **Aj,      // column indices, Aj_size >= nvals(A)*sizeof(uint32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Aj_size,  // size of Aj in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each row may be unsorted
+    const GrB_Descriptor desc
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_pack_CSC32    // pack a CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // col "pointers", Ap_size >= (ncols+1)*sizeof(uint32_t)
+    uint32_t **Ai,      // row indices, Ai_size >= nvals(A)*sizeof(uint32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Ai_size,  // size of Ai in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each column may be unsorted
+    const GrB_Descriptor desc
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_unpack_CSR32  // unpack a CSR matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to unpack (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // row "pointers"
+    uint32_t **Aj,      // column indices
+    void **Ax,          // values
+    GrB_Index *Ap_size, // size of Ap in bytes
+    GrB_Index *Aj_size, // size of Aj in bytes
+    GrB_Index *Ax_size, // size of Ax in bytes
+    bool *iso,          // if true, A is iso
+    bool *jumbled,      // if true, indices in each row may be unsorted
+    const GrB_Descriptor desc
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_unpack_CSC32  // unpack a CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to unpack (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // col "pointers"
+    uint32_t **Ai,      // row indices
+    void **Ax,          // values
+    GrB_Index *Ap_size, // size of Ap in bytes
+    GrB_Index *Ai_size, // size of Ai in bytes
+    GrB_Index *Ax_size, // size of Ax in bytes
+    bool *iso,          // if true, A is iso
+    bool *jumbled,      // if true, indices in each column may be unsorted
+    const GrB_Descriptor desc
+) ;
+
+//==============================================================================
+// GxB_Matrix_unpack_Arrow: unpack a matrix into Apache Arrow buffers
+//==============================================================================
+
+// GxB_Matrix_unpack_Arrow unpacks a matrix into buffers laid out so they can
+// be wrapped directly as Apache Arrow arrays, with no copy of the indices or
+// values.  The matrix keeps its current by-row or by-column orientation
+// (returned as by_col), and is unpacked in one of two layouts:
+
+//  GxB_SPARSE: for a sparse or hypersparse matrix.  Ap (int64 offsets, of
+//      size nvec+1, where nvec is nrows if by row or ncols if by column), Ai
+//      (int64 indices) and Ax are the indptr, indices and data buffers of an
+//      Arrow SparseCSRMatrix (if by row) or SparseCSCMatrix (if by column).
+//      Av is returned as NULL.  A hypersparse matrix is first converted to
+//      sparse.
+
+//  GxB_FULL: for a bitmap or full matrix.  Ax holds all nrows*ncols values,
+//      in row-major order if by row or column-major order if by column, and
+//      Ap and Ai are returned as NULL.  If the matrix is bitmap, Av is an
+//      Arrow validity bitmap for Ax, with one bit per value (least
+//      significant bit first, 1 if the entry is present), padded with zeros
+//      to a multiple of 64 bytes.  Av is NULL if the matrix is full.
+
+// If iso is true, Ax holds a single value, shared by all entries.  This can be
+// wrapped as an Arrow run-end encoded array with a single run.
+
+// Ownership of all returned buffers is transferred to the application, which
+// must free them with the free function passed to GxB_init (or free, for
+// GrB_init).  If that function's malloc returns 64-byte aligned memory, all
+// of the buffers meet the Arrow alignment recommendation.  The matrix is
+// left with no entries, as for the other GxB_Matrix_unpack_* methods.  If
+// the method fails, the matrix is not unpacked.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_unpack_Arrow    // unpack a matrix into Arrow buffers
+(
+    GrB_Matrix A,       // matrix to unpack (type, nrows, ncols unchanged)
+    int *layout,        // GxB_SPARSE (CSR or CSC) or GxB_FULL (dense)
+    bool *by_col,       // true if CSC or column-major, false if by row
+    GrB_Index **Ap,     // offsets, size nvec+1 (NULL if dense)
+    GrB_Index **Ai,     // indices (NULL if dense)
+    uint8_t **Av,       // validity bitmap (NULL if sparse, or no nulls)
+    void **Ax,          // values
+    GrB_Index *Ap_size, // size of Ap in bytes
+    GrB_Index *Ai_size, // size of Ai in bytes
+    GrB_Index *Av_size, // size of Av in bytes
+    GrB_Index *Ax_size, // size of Ax in bytes
+    bool *iso,          // if true, A is iso
+    const GrB_Descriptor desc
+) ;
+
 //==============================================================================
 // GrB import/export
 //==============================================================================
@@ -11349,6 +11779,10 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // #define GxB_COMPRESSION_BZIP2 5000  // BZIP2, with default level 9
 // #define GxB_COMPRESSION_LZSS  6000  // LZSS
 
+// delta + varint encoding of the integer arrays of the matrix, followed by
+// LZ4 or LZ4HC (see below):
+#define GxB_COMPRESSION_DELTA   100000
+
 // using the Intel IPP versions, if available (not yet supported);
 #define GxB_COMPRESSION_INTEL   1000000
 
@@ -11376,6 +11810,18 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // but not available, this setting is ignored and the non-Intel methods are
 // used instead.
 
+// GxB_COMPRESSION_DELTA can be added to LZ4 or LZ4HC.  The integer arrays of
+// the matrix (Ap, Ah, and Ai, which hold the pointers and indices of a sparse
+// or hypersparse matrix) are then encoded before they are compressed: each
+// entry is replaced with its difference from the prior entry, in a compact
+// variable-length form.  This is typically much more compact than LZ4 alone,
+// for these arrays.  The values and the bitmap of the matrix are compressed
+// as usual.  For example, to use delta encoding with LZ4HC at level 9, use
+// method = GxB_COMPRESSION_DELTA + GxB_COMPRESSION_LZ4HC + 9.  The
+// compressed blocks are still decoded in parallel.  Using
+// GxB_COMPRESSION_DELTA by itself selects the default method (LZ4) with delta
+// encoding.
+
 // If the level setting is out of range, the default is used for that method.
 // If the method is negative, no compression is performed.  If the method is
 // positive but unrecognized, the default is used (GxB_COMPRESSION_LZ4, with no
@@ -11434,6 +11880,16 @@ GrB_Info GrB_Matrix_serializeSize   // estimate the size of a blob
 // deserialize methods simply add the descriptor, which allows for optional
 // control of the # of threads used to deserialize the blob.
 
+// If the descriptor has GxB_IMPORT set to GxB_SHALLOW_IMPORT, then any array
+// in the blob that was serialized with GxB_COMPRESSION_NONE, and that is
+// suitably aligned in memory, is not copied.  Instead, the output matrix C
+// refers to it in the blob directly.  This allows a blob held in a file to
+// be memory-mapped (with mmap) and used immediately, with no copying.  The
+// blob must not be modified or freed until C is freed.  C can be used as
+// the input or output of any GraphBLAS method; GraphBLAS makes its own copy
+// of any part of C held in the blob before it modifies C, and never writes
+// to the blob.  Arrays compressed with LZ4 or LZ4HC are always copied.
+
 GB_PUBLIC
 GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
 (
@@ -11497,6 +11953,161 @@ GrB_Info GxB_deserialize_type_name  // return the type name of a blob
     GrB_Index blob_size     // size of the blob
 ) ;
 
+//------------------------------------------------------------------------------
+// streaming serialize/deserialize
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_serialize_stream and GxB_Vector_serialize_stream serialize a
+// matrix or vector into a stream of bytes, without constructing the entire
+// blob in memory.  The blob is passed in order, one piece at a time, to the
+// user's writer function.  The blob has the same format as the one constructed
+// by GxB_Matrix_serialize (only the compressed block sizes may differ), so it
+// can be read back by GxB_*_deserialize_stream, or loaded into memory (or
+// mapped into memory, and imported via GxB_SHALLOW_IMPORT) and read by
+// GxB_*_deserialize.  The compression method and # of threads are selected by
+// the descriptor, as in GxB_Matrix_serialize.
+
+// Since the blob header holds the size of each compressed block, each
+// compressed array is compressed twice, in batches of at most nthreads blocks
+// of at most 1MB each (once to find the block sizes, and again to write them).
+// The workspace is thus a few MB per thread, regardless of the size of the
+// matrix.  Uncompressed arrays (GxB_COMPRESSION_NONE) are written as-is, with
+// a single call to the writer, and are not copied.
+
+// GxB_Matrix_deserialize_stream and GxB_Vector_deserialize_stream read a blob
+// in order from a stream, via the user's reader function.  Only the blob
+// header is held in memory; the compressed blocks are read in batches of at
+// most nthreads blocks and decompressed directly into the output.
+
+// The writer and reader must return true if all size bytes were written or
+// read, or false on failure.  If the writer fails, GrB_INSUFFICIENT_SPACE is
+// returned.  If the reader fails, or if the stream is invalid or truncated,
+// GrB_INVALID_OBJECT is returned.
+
+typedef bool (*GxB_serialize_write_function)  // return true if successful
+(
+    void *stream,               // user-defined stream
+    const void *data,           // data to write to the stream
+    size_t size                 // # of bytes to write
+) ;
+
+typedef bool (*GxB_serialize_read_function)   // return true if successful
+(
+    void *stream,               // user-defined stream
+    void *data,                 // data read from the stream
+    size_t size                 // # of bytes to read
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_serialize_write_function writer,    // function to write the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_serialize_stream    // serialize a GrB_Vector to a stream
+(
+    GxB_serialize_write_function writer,    // function to write the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Vector u,                   // vector to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_serialize_read_function reader,     // function to read the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_deserialize_stream  // deserialize a stream into a vector
+(
+    // output:
+    GrB_Vector *w,      // output vector created from the stream
+    // input:
+    GrB_Type type,      // type of the vector w.  Required if the stream holds
+                        // a vector of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of w.
+    GxB_serialize_read_function reader,     // function to read the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+//==============================================================================
+// GxB_Matrix_read_*: read a matrix from a file
+//==============================================================================
+
+// GxB_Matrix_read_MatrixMarket reads a matrix from a file in the Matrix Market
+// format (https://math.nist.gov/MatrixMarket/formats.html).  The coordinate
+// and array formats are supported, with real, double, integer, complex, or
+// pattern entries, and general, symmetric, skew-symmetric, or hermitian
+// symmetry.  The entries in the file are parsed as GrB_FP64 (real or double),
+// GrB_INT64 (integer), GxB_FC64 (complex), or as an iso GrB_BOOL matrix with
+// all entries equal to true (pattern), and then typecast into the type of C.
+// If type is NULL, the type of C is given by an optional "%%GraphBLAS type"
+// line in the header of the file (such as "%%GraphBLAS GrB_BOOL"), or by the
+// type of the entries otherwise.  If the file is symmetric, the upper
+// triangular part of C is constructed from the lower triangular part held in
+// the file.  The file must be open for reading; it is not closed.
+
+// GxB_Matrix_read_binary_COO reads a matrix from a binary file that holds a
+// list of records (i,j,x), from the current position of the file to its end,
+// with no header.  The row index i and column index j are 0-based unsigned
+// integers of index_size bytes each (4 or 8), and x is a value of the given
+// type, of type->size bytes.  The indices and values are in the native byte
+// order of this machine, with no padding.  If type is NULL, each record holds
+// just (i,j), and C is returned as an iso GrB_BOOL matrix with all entries
+// equal to true.  The file should be opened in binary mode ("rb").
+
+// Both methods read the file in large chunks, and parse or decode each chunk
+// in parallel, directly into the tuples used to build C.  The # of threads is
+// controlled by the descriptor.  If any entries appear more than once in the
+// file, the last one is kept.  GrB_INVALID_VALUE is returned if the file is
+// invalid, GrB_INDEX_OUT_OF_BOUNDS if an index in a binary COO file is out of
+// range, and GrB_DOMAIN_MISMATCH if the entries of a Matrix Market file
+// cannot be typecast into the requested type.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_read_MatrixMarket   // read a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,          // matrix read from the file
+    // input:
+    GrB_Type type,          // type of C, or NULL to use the file
+    FILE *f,                // file to read, open for reading
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_read_binary_COO     // read a binary list of tuples
+(
+    // output:
+    GrB_Matrix *C,          // matrix read from the file
+    // input:
+    GrB_Type type,          // type of C and of the values in the file, or
+                            // NULL if the file holds no values
+    GrB_Index nrows,        // # of rows of C
+    GrB_Index ncols,        // # of columns of C
+    int index_size,         // size of each index in the file (4 or 8 bytes)
+    FILE *f,                // file to read, open for reading
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -11569,7 +12180,39 @@ outer loop), and one entry at a time within the row (in the inner loop):
     }
     GrB_free (&iterator) ;
 
-parallel iteration using 4 threads (work may be imbalanced however):
+parallel iteration using 4 threads, with a balanced partition of the entries
+(one row may be split between two threads):
+
+    GrB_wait (A, GrB_MATERIALIZE) ;     // this is essential
+    #pragma omp parallel for num_threads(4)
+    for (int tid = 0 ; tid < 4 ; tid++)
+    {
+        GxB_Iterator iterator ;
+        GxB_Iterator_new (&iterator) ;
+        GrB_Info info = GxB_rowIterator_attach (iterator, A, NULL) ;
+        if (info < 0) { handle the failure ... }
+        // seek to the first row of the tid-th partition of A
+        info = GxB_rowIterator_seekPartition (iterator, tid, 4) ;
+        while (info != GxB_EXHAUSTED)
+        {
+            // iterate over the entries in A(i,:) in this partition
+            GrB_Index i = GxB_rowIterator_getRowIndex (iterator) ;
+            while (info == GrB_SUCCESS)
+            {
+                // get the entry A(i,j)
+                GrB_Index j = GxB_rowIterator_getColIndex (iterator) ;
+                double  aij = GxB_Iterator_get_FP64 (iterator) ;
+                // move to the next entry in A(i,:)
+                info = GxB_rowIterator_nextCol (iterator) ;
+            }
+            // move to the next row in this partition
+            info = GxB_rowIterator_nextRow (iterator) ;
+        }
+        GrB_free (&iterator) ;
+    }
+
+parallel iteration using 4 threads, by ranges of rows (work may be
+imbalanced however):
 
     GrB_Index nrows ;
     GrB_wait (A, GrB_MATERIALIZE) ;     // this is essential
@@ -11606,10 +12249,7 @@ parallel iteration using 4 threads (work may be imbalanced however):
     }
 
     In the parallel example above, a more balanced work distribution can be
-    obtained by first computing the row degree via GrB_mxv (see LAGraph), and
-    then compute the cumulative sum (ideally in parallel).  Next, partition the
-    cumulative sum into one part per thread via binary search, and divide the
-    rows into parts accordingly.
+    obtained with GxB_rowIterator_seekPartition, as in the prior example.
 
 */
 
@@ -11631,6 +12271,11 @@ struct GB_Iterator_opaque
     int64_t p ;                 // position of the current entry
     int64_t k ;                 // the current vector
 
+    // the range of a row/col iterator; these change when the iterator is
+    // attached, or moved by GxB_*Iterator_seek* or GxB_*Iterator_*kseek:
+    int64_t kend ;              // the iterator is exhausted when k >= kend
+    int64_t plast ;             // entries at p >= plast are out of range
+
     // only changes when the iterator is created:
     size_t header_size ;        // size of this iterator object
 
@@ -11688,6 +12333,32 @@ GB_PUBLIC GrB_Info GB_Iterator_rc_seek
     bool jth_vector
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_partition: seek a row/col iterator to a partition of a matrix
+//------------------------------------------------------------------------------
+
+GB_PUBLIC GrB_Info GB_Iterator_rc_partition
+(
+    GxB_Iterator iterator,
+    int tid,
+    int ntasks
+) ;
+
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_span: get the span of the current vector of a row/col iterator
+//------------------------------------------------------------------------------
+
+GB_PUBLIC GrB_Info GB_Iterator_rc_span
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,
+    const GrB_Index **Indices,
+    GrB_Index *first,
+    const int8_t **Bitmap,
+    const void **Values,
+    bool *iso
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Iterator_rc_bitmap_next: move a row/col iterator to next entry in bitmap
 //------------------------------------------------------------------------------
@@ -11701,7 +12372,7 @@ GB_PUBLIC GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
 #define GB_Iterator_rc_knext(iterator)                                      \
 (                                                                           \
     /* move to the next vector, and check if iterator is exhausted */       \
-    (++(iterator->k) >= iterator->anvec) ?                                  \
+    (++(iterator->k) >= iterator->kend) ?                                   \
     (                                                                       \
         /* iterator is at the end of the matrix */                          \
         iterator->pstart = 0,                                               \
@@ -11718,6 +12389,8 @@ GB_PUBLIC GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
             /* matrix is sparse or hypersparse */                           \
             iterator->pstart = iterator->Ap [iterator->k],                  \
             iterator->pend = iterator->Ap [iterator->k+1],                  \
+            iterator->pend = (iterator->pend < iterator->plast) ?           \
+                iterator->pend : iterator->plast,                           \
             iterator->p = iterator->pstart,                                 \
             ((iterator->p >= iterator->pend) ? GrB_NO_VALUE : GrB_SUCCESS)  \
         )                                                                   \
@@ -11725,7 +12398,9 @@ GB_PUBLIC GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
         (                                                                   \
             /* matrix is bitmap or full */                                  \
             iterator->pstart += iterator->avlen,                            \
-            iterator->pend += iterator->avlen,                              \
+            iterator->pend = iterator->pstart + iterator->avlen,            \
+            iterator->pend = (iterator->pend < iterator->plast) ?           \
+                iterator->pend : iterator->plast,                           \
             iterator->p = iterator->pstart,                                 \
             (iterator->A_sparsity <= GxB_BITMAP) ?                          \
             (                                                               \
@@ -11818,10 +12493,12 @@ GB_PUBLIC GrB_Info GB_Iterator_rc_bitmap_next (GxB_Iterator iterator) ;
 #undef GxB_rowIterator_kount
 #undef GxB_rowIterator_seekRow
 #undef GxB_rowIterator_kseek
+#undef GxB_rowIterator_seekPartition
 #undef GxB_rowIterator_nextRow
 #undef GxB_rowIterator_nextCol
 #undef GxB_rowIterator_getRowIndex
 #undef GxB_rowIterator_getColIndex
+#undef GxB_rowIterator_getSpan
 
 //------------------------------------------------------------------------------
 // GxB_rowIterator_attach: attach a row iterator to a matrix
@@ -11936,6 +12613,50 @@ GrB_Info GxB_rowIterator_kseek (GxB_Iterator iterator, GrB_Index k) ;
     GB_Iterator_rc_seek (iterator, k, true)                                 \
 )
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_seekPartition: move a row iterator to a partition of A
+//------------------------------------------------------------------------------
+
+// On input, the row iterator must be attached to a matrix, but need not be at
+// any specific row; results are undefined if this condition is not met.
+
+// GxB_rowIterator_seekPartition restricts the row iterator to the tid-th of
+// ntasks partitions of the matrix, and moves it to the first row of that
+// partition.  The entries of the matrix are divided evenly between the
+// partitions, in the same way that GraphBLAS slices a matrix for its own
+// parallel methods.  Rows are not divided evenly; a row with many entries may
+// be split across two or more partitions, and each partition then holds a
+// contiguous part of that row.  All other rows appear in just one partition,
+// including empty rows (which may be skipped, as for nextRow).  If ntasks
+// iterators each move to a different partition tid = 0 to ntasks-1, then
+// together they visit each entry of the matrix exactly once.
+
+// GxB_rowIterator_nextRow and GxB_rowIterator_nextCol then traverse only the
+// rows and entries in the partition.  The iterator is exhausted when it
+// reaches the end of the partition.  Calling GxB_rowIterator_seekRow or
+// GxB_rowIterator_kseek removes the restriction.
+
+// The method takes O(log(kount)) time, so it can be called by each thread in
+// a parallel region, with no need to precompute the partitions.  If tid is
+// not in the range 0 to ntasks-1, the iterator is exhausted.  Otherwise, the
+// return conditions are identical to those of GxB_rowIterator_seekRow: if
+// GrB_NO_VALUE is returned, the first row of the partition has no entries in
+// the partition, and GxB_rowIterator_nextRow should be used to move to the
+// next row.
+
+GB_PUBLIC
+GrB_Info GxB_rowIterator_seekPartition
+(
+    GxB_Iterator iterator,
+    int tid,                    // partition to move to, in range 0:ntasks-1
+    int ntasks                  // # of partitions of the matrix
+) ;
+
+#define GxB_rowIterator_seekPartition(iterator, tid, ntasks)                \
+(                                                                           \
+    GB_Iterator_rc_partition (iterator, tid, ntasks)                        \
+)
+
 //------------------------------------------------------------------------------
 // GxB_rowIterator_nextRow: move a row iterator to the next row of a matrix
 //------------------------------------------------------------------------------
@@ -12022,6 +12743,92 @@ GrB_Index GxB_rowIterator_getColIndex (GxB_Iterator iterator) ;
     GB_Iterator_rc_geti ((iterator))                                        \
 )
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_getSpan: get the rest of the current row, as arrays
+//------------------------------------------------------------------------------
+
+// On input, the iterator must be already successfully attached to matrix as a
+// row iterator, and positioned at a row (not exhausted).  Results are
+// undefined if this condition is not met.
+
+// GxB_rowIterator_getSpan returns the entries of the current row, from the
+// current entry to the end of the row (or the end of the partition, if
+// GxB_rowIterator_seekPartition was used), as pointers into the matrix itself.
+// No data is copied, and the arrays must not be modified.  They remain valid
+// until the matrix is modified or freed.  The loop over the entries can then
+// be written without a branch or function call per entry, so that it can be
+// vectorized by the compiler.  For an entry at position k in the span, for k
+// in the range 0 to count-1:
+
+//      the column index is Indices [k] if Indices is not NULL,
+//          or first+k if Indices is NULL (the matrix is bitmap or full);
+//      the entry is present if Bitmap is NULL, or if Bitmap [k] is nonzero;
+//      its value is ((type *) Values) [k], or ((type *) Values) [0] if iso.
+
+// For a bitmap matrix, Bitmap is a byte array (not a bit array), so it can be
+// read and tested 8 bytes at a time, to skip runs of missing entries.  The
+// span does not change the position of the iterator; use
+// GxB_rowIterator_nextRow to move to the next row.  GrB_NO_VALUE is returned
+// if the span is empty (count is then zero), and GrB_SUCCESS otherwise.
+
+// Example usage, for a row iterator on a GrB_FP64 matrix A and a dense vector
+// X, to compute a dot product of each row of A with X:
+
+/*
+    while (info != GxB_EXHAUSTED)
+    {
+        GrB_Index i = GxB_rowIterator_getRowIndex (iterator) ;
+        GrB_Index count, first ;
+        const GrB_Index *J ;
+        const int8_t *Jb ;
+        const double *Ax ;
+        bool iso ;
+        GxB_rowIterator_getSpan (iterator, &count, &J, &first, &Jb,
+            (const void **) &Ax, &iso) ;
+        double t = 0 ;
+        if (J != NULL && !iso)
+        {
+            // A is sparse or hypersparse, and not iso
+            for (GrB_Index k = 0 ; k < count ; k++)
+            {
+                t += Ax [k] * X [J [k]] ;
+            }
+        }
+        else if (Jb == NULL && !iso)
+        {
+            // A is full, and not iso
+            for (GrB_Index k = 0 ; k < count ; k++)
+            {
+                t += Ax [k] * X [first + k] ;
+            }
+        }
+        else
+        {
+            ... other cases: iso, or bitmap
+        }
+        Y [i] = t ;
+        info = GxB_rowIterator_nextRow (iterator) ;
+    }
+*/
+
+GB_PUBLIC
+GrB_Info GxB_rowIterator_getSpan
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,           // # of positions in the span
+    const GrB_Index **Indices,  // column indices, or NULL if bitmap or full
+    GrB_Index *first,           // column index of the first position
+    const int8_t **Bitmap,      // bitmap of the span, or NULL if not bitmap
+    const void **Values,        // values of the span, or the iso value
+    bool *iso                   // true if all entries have the value Values[0]
+) ;
+
+#define GxB_rowIterator_getSpan(iterator,count,Indices,first,Bitmap,Values,iso)\
+(                                                                           \
+    GB_Iterator_rc_span (iterator, count, Indices, first, Bitmap, Values,   \
+        iso)                                                                \
+)
+
 //==============================================================================
 // GxB_colIterator_*: iterate over columns of a matrix
 //==============================================================================
@@ -12032,10 +12839,12 @@ GrB_Index GxB_rowIterator_getColIndex (GxB_Iterator iterator) ;
 #undef GxB_colIterator_kount
 #undef GxB_colIterator_seekCol
 #undef GxB_colIterator_kseek
+#undef GxB_colIterator_seekPartition
 #undef GxB_colIterator_nextCol
 #undef GxB_colIterator_nextRow
 #undef GxB_colIterator_getColIndex
 #undef GxB_colIterator_getRowIndex
+#undef GxB_colIterator_getSpan
 
 // GxB_colIterator_attach: attach a column iterator to a matrix
 GB_PUBLIC
@@ -12074,6 +12883,19 @@ GrB_Info GxB_colIterator_kseek (GxB_Iterator iterator, GrB_Index k) ;
     GB_Iterator_rc_seek (iterator, k, true)                                 \
 )
 
+// GxB_colIterator_seekPartition: move a column iterator to a partition of A
+GB_PUBLIC
+GrB_Info GxB_colIterator_seekPartition
+(
+    GxB_Iterator iterator,
+    int tid,                    // partition to move to, in range 0:ntasks-1
+    int ntasks                  // # of partitions of the matrix
+) ;
+#define GxB_colIterator_seekPartition(iterator, tid, ntasks)                \
+(                                                                           \
+    GB_Iterator_rc_partition (iterator, tid, ntasks)                        \
+)
+
 // GxB_colIterator_nextCol: move a column iterator to first entry of next column
 GB_PUBLIC
 GrB_Info GxB_colIterator_nextCol (GxB_Iterator iterator) ;
@@ -12106,6 +12928,24 @@ GrB_Index GxB_colIterator_getRowIndex (GxB_Iterator iterator) ;
     GB_Iterator_rc_geti ((iterator))                                        \
 )
 
+// GxB_colIterator_getSpan: get the rest of the current column, as arrays
+GB_PUBLIC
+GrB_Info GxB_colIterator_getSpan
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,           // # of positions in the span
+    const GrB_Index **Indices,  // row indices, or NULL if bitmap or full
+    GrB_Index *first,           // row index of the first position
+    const int8_t **Bitmap,      // bitmap of the span, or NULL if not bitmap
+    const void **Values,        // values of the span, or the iso value
+    bool *iso                   // true if all entries have the value Values[0]
+) ;
+#define GxB_colIterator_getSpan(iterator,count,Indices,first,Bitmap,Values,iso)\
+(                                                                           \
+    GB_Iterator_rc_span (iterator, count, Indices, first, Bitmap, Values,   \
+        iso)                                                                \
+)
+
 //==============================================================================
 // GxB_Matrix_Iterator_*: iterate over the entries of a matrix
 //==============================================================================
@@ -64,6 +64,7 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
         GB_sparsity_char_matrix (A),    // C has the sparsity structure of A
         GB_sparsity_char_matrix (A),
         GB_sparsity_char_matrix (D)) ;
+    GB_TELEMETRY (GxB_TELEMETRY_METHOD, "colscale", (double) GB_nnz (A), 0) ;
 
     //--------------------------------------------------------------------------
     // get the semiring operators
@@ -237,6 +237,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     GBURBLE ("(nthreads: %d naslice %g nbslice %g) ", nthreads,
         (double) naslice, (double) nbslice) ;
+    GB_TELEMETRY (GxB_TELEMETRY_METHOD, "dot2", 0, nthreads) ;
 
     //--------------------------------------------------------------------------
     // get the semiring operators
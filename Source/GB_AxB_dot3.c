@@ -238,6 +238,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         C, Context)) ;
 
     GBURBLE ("nthreads %d ntasks %d ", nthreads, ntasks) ;
+    GB_TELEMETRY (GxB_TELEMETRY_METHOD, "dot3", 0, nthreads) ;
 
     //--------------------------------------------------------------------------
     // C<M> = A'*B, via masked dot product method and built-in semiring
@@ -246,6 +246,7 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     else if (info == GrB_SUCCESS)
     { 
         ASSERT_MATRIX_OK (C, "dot4: output", GB0) ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "dot4", 0, nthreads) ;
         (*done_in_place) = true ;
     }
     return (info) ;
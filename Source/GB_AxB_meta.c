@@ -491,6 +491,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // done after any such transposings.
     }
 
+    if (can_do_in_place)
+    { 
+        // C_in is modified in-place, so it must own all of its content
+        GB_OK (GB_unshallow (C_in, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // burble
     //--------------------------------------------------------------------------
@@ -53,6 +53,7 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
         GB_sparsity_char_matrix (B),    // C has the sparsity structure of B
         GB_sparsity_char_matrix (D),
         GB_sparsity_char_matrix (B)) ;
+    GB_TELEMETRY (GxB_TELEMETRY_METHOD, "rowscale", (double) GB_nnz (B), 0) ;
 
     //--------------------------------------------------------------------------
     // get the semiring operators
@@ -174,6 +174,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         //----------------------------------------------------------------------
 
         GBURBLE ("(iso full saxpy) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "saxpy:iso_full", 0, 1) ;
         ASSERT (C_sparsity == GxB_FULL) ;
         // set C->iso = true    OK
         info = GB_new_bix (&C, // existing header
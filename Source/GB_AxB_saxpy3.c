@@ -265,6 +265,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // phase0: create parallel tasks and allocate workspace
     //==========================================================================
 
+    double t_phase = GB_TELEMETRY_TIME ;
+
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
 
@@ -473,6 +475,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     if (nfine_gus    > 0) GBURBLE (" fine: %d",        nfine_gus) ;
     if (nfine_hash   > 0) GBURBLE (" fine hash: %d",   nfine_hash) ;
     GBURBLE (") ") ;
+    GB_TELEMETRY (GxB_TELEMETRY_METHOD,
+        (ncoarse_hash + nfine_hash == 0) ? "saxpy3:gustavson" :
+        (ncoarse_gus  + nfine_gus  == 0) ? "saxpy3:hash" : "saxpy3:mixed",
+        0, nthreads) ;
 
     //--------------------------------------------------------------------------
     // allocate space for all hash tables
@@ -588,8 +594,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // GB_Global_timing_add (5, ttt) ;
 // ttt = omp_get_wtime ( ) ;
 
+    GB_TELEMETRY_PHASE ("saxpy3:tasks", t_phase, nthreads) ;
     GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
         A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    GB_TELEMETRY_PHASE ("saxpy3:symbolic", t_phase, nthreads) ;
 
 // the above phase takes 1.6 seconds for 64 trials of the web graph.
 
@@ -687,6 +695,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // GB_Global_timing_add (7, ttt) ;
 // ttt = omp_get_wtime ( ) ;
 
+    GB_TELEMETRY_PHASE ("saxpy3:numeric", t_phase, nthreads) ;
+
     C->magic = GB_MAGIC ;
     GB_FREE_WORKSPACE ;
     GB_OK (GB_hypermatrix_prune (C, Context)) ;
@@ -393,6 +393,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     //--------------------------------------------------------------------------
 
     (*nthreads) = GB_nthreads ((double) total_flops, chunk, nthreads_max) ;
+    GB_TELEMETRY_FLOPS (total_flops) ;
     int ntasks_initial = ((*nthreads) == 1) ? 1 :
         (GB_NTASKS_PER_THREAD * (*nthreads)) ;
 
@@ -189,6 +189,7 @@ GrB_Info GB_AxB_saxpy4              // C += A*B
     else
     { 
         ASSERT_MATRIX_OK (C, "saxpy4: output", GB0) ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "saxpy4", 0, nthreads) ;
         (*done_in_place) = true ;
         return (GrB_SUCCESS) ;
     }
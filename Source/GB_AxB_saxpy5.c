@@ -183,6 +183,7 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     else if (info == GrB_SUCCESS)
     { 
         ASSERT_MATRIX_OK (C, "saxpy5: output", GB0) ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "saxpy5", 0, nthreads) ;
         (*done_in_place) = true ;
     }
     return (info) ;
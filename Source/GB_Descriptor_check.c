@@ -166,7 +166,11 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("    d.sort     = true\n") ;
     }
 
-    if (D->import != GxB_DEFAULT)
+    if (D->import == GxB_SHALLOW_IMPORT)
+    { 
+        GBPR0 ("    d.import   = shallow\n") ;
+    }
+    else if (D->import != GxB_DEFAULT)
     { 
         GBPR0 ("    d.import   = secure\n") ;
     }
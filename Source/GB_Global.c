@@ -15,6 +15,14 @@
 
 #include "GB_atomics.h"
 
+// aligned_alloc is ANSI C11, but it is not provided by MS Visual Studio
+#if defined ( _WIN32 ) || !defined ( __STDC_VERSION__ ) || \
+    ( __STDC_VERSION__ < 201112L )
+#define GB_HAS_ALIGNED_ALLOC 0
+#else
+#define GB_HAS_ALIGNED_ALLOC 1
+#endif
+
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
 //------------------------------------------------------------------------------
@@ -105,6 +113,49 @@ typedef struct
     bool print_one_based ;          // if true, print 1-based indices
     bool print_mem_shallow ;        // if true, print # shallow bytes
 
+    //--------------------------------------------------------------------------
+    // telemetry
+    //--------------------------------------------------------------------------
+
+    GxB_telemetry_function_t telemetry_func ;   // telemetry callback
+    uint64_t telemetry_ncalls ;     // # of calls reported to telemetry_func
+
+    //--------------------------------------------------------------------------
+    // thread sharing between concurrent calls from user threads
+    //--------------------------------------------------------------------------
+
+    bool thread_sharing ;           // if true, calls share nthreads_max
+    int64_t thread_share_ncalls ;   // # of calls currently sharing threads
+
+    //--------------------------------------------------------------------------
+    // NUMA placement of large blocks
+    //--------------------------------------------------------------------------
+
+    int numa_policy ;               // GxB_NUMA_DEFAULT, _FIRST_TOUCH, or
+                                    // _INTERLEAVE
+    uint64_t numa_nodes ;           // online nodes, for GxB_NUMA_INTERLEAVE
+
+    //--------------------------------------------------------------------------
+    // aligned allocation and huge pages
+    //--------------------------------------------------------------------------
+
+    size_t memory_alignment ;       // alignment of all new blocks, or 0 to
+                                    // use the alignment of malloc_function
+    size_t huge_page_threshold ;    // new blocks at least this large use
+                                    // transparent huge pages (0: never)
+
+    //--------------------------------------------------------------------------
+    // memory budget of the process, and blocks spilled to files
+    //--------------------------------------------------------------------------
+
+    int64_t memory_budget ;         // max # of bytes in use (0: no limit)
+    int64_t memory_used ;           // # of bytes in use by GraphBLAS
+    char spill_directory [GB_SPILL_PATH_MAX] ;  // "" if spilling is disabled
+    size_t spill_threshold ;        // only blocks this large can be spilled
+    int64_t nspill ;                // # of blocks spilled to files
+    void *spill_p [GB_SPILL_MAX] ;  // the blocks spilled to files
+    size_t spill_size [GB_SPILL_MAX] ;  // their sizes
+
     //--------------------------------------------------------------------------
     // timing: for code development only
     //--------------------------------------------------------------------------
@@ -137,6 +188,18 @@ typedef struct
     int64_t free_pool_nblocks [64] ;
     int64_t free_pool_limit [64] ;
 
+    // Each thread also uses one of a set of shards, each with a small cache of
+    // free blocks in front of the shared free_pool (see GB_free_pool_shard
+    // below), with at most free_pool_cache_limit [k] blocks of size 2^k.
+    // free_pool_nshards is the # of threads that have been assigned a shard.
+    // free_pool_hits and free_pool_misses count the gets that were satisfied
+    // by the shared free_pool, or not satisfied at all.
+
+    int64_t free_pool_cache_limit [64] ;
+    int64_t free_pool_nshards ;
+    int64_t free_pool_hits ;
+    int64_t free_pool_misses ;
+
     //--------------------------------------------------------------------------
     // CPU features
     //--------------------------------------------------------------------------
@@ -221,6 +284,29 @@ GB_Global_struct GB_Global =
     .print_one_based = false,   // if true, print 1-based indices
     .print_mem_shallow = false, // for @GrB interface only
 
+    // telemetry
+    .telemetry_func = NULL,
+    .telemetry_ncalls = 0,
+
+    // thread sharing
+    .thread_sharing = false,
+    .thread_share_ncalls = 0,
+
+    // NUMA placement
+    .numa_policy = GxB_NUMA_DEFAULT,
+    .numa_nodes = 0,
+
+    // aligned allocation and huge pages
+    .memory_alignment = 0,
+    .huge_page_threshold = 0,
+
+    // memory budget and spilling
+    .memory_budget = 0,
+    .memory_used = 0,
+    .spill_directory = "",
+    .spill_threshold = GB_SPILL_THRESHOLD_DEFAULT,
+    .nspill = 0,
+
     .timing = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
                 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 
@@ -787,18 +873,42 @@ void GB_Global_malloc_function_set (void * (* malloc_function) (size_t))
     GB_Global.malloc_function = malloc_function ;
 }
 
+// GB_Global_malloc_aligned: allocate a block with the ANSI C11 aligned_alloc
+// if an alignment has been requested, or with the malloc_function otherwise.
+// Blocks for huge pages are aligned on a huge page boundary.  Both kinds of
+// blocks can be freed by the ANSI C free.
+
+static inline void *GB_Global_malloc_aligned (size_t size)
+{
+    #if GB_HAS_ALIGNED_ALLOC
+    size_t alignment = GB_Global.memory_alignment ;
+    size_t threshold = GB_Global.huge_page_threshold ;
+    if (threshold > 0 && size >= threshold && GB_Global_malloc_is_ansi ( ))
+    { 
+        alignment = GB_HUGE_PAGE_SIZE ;
+    }
+    if (alignment > 0)
+    { 
+        // the size must be a multiple of the alignment
+        size_t asize = ((size + alignment - 1) / alignment) * alignment ;
+        return (aligned_alloc (alignment, asize)) ;
+    }
+    #endif
+    return (GB_Global.malloc_function (size)) ;
+}
+
 void * GB_Global_malloc_function (size_t size)
 { 
     void *p = NULL ;
     if (GB_Global.malloc_is_thread_safe)
     {
-        p = GB_Global.malloc_function (size) ;
+        p = GB_Global_malloc_aligned (size) ;
     }
     else
     {
         #pragma omp critical(GB_malloc_protection)
         {
-            p = GB_Global.malloc_function (size) ;
+            p = GB_Global_malloc_aligned (size) ;
         }
     }
     GB_Global_memtable_add (p, size) ;
@@ -819,7 +929,10 @@ void GB_Global_realloc_function_set
 
 bool GB_Global_have_realloc_function (void)
 { 
-    return (GB_Global.realloc_function != NULL) ;
+    // realloc does not preserve the alignment of a block, so it is not used
+    // if an alignment has been requested
+    return (GB_Global.realloc_function != NULL &&
+            GB_Global.memory_alignment == 0) ;
 }
 
 void * GB_Global_realloc_function (void *p, size_t size)
@@ -1015,6 +1128,509 @@ void GB_Global_flush_set (GB_flush_function_t fl_func)
     GB_Global.flush_func = fl_func ;
 }
 
+//------------------------------------------------------------------------------
+// telemetry
+//------------------------------------------------------------------------------
+
+// The telemetry function is read once by each user-callable method, when it
+// starts.  The # of bytes allocated is counted separately for each thread, so
+// that each call can report its own allocations (those made by the thread
+// that called it).  This requires thread-local storage.
+
+#if GB_HAS_THREAD_LOCAL
+static GB_THREAD_LOCAL int64_t GB_telemetry_bytes = 0 ;
+#endif
+
+GB_PUBLIC
+void GB_Global_telemetry_set (GxB_telemetry_function_t telemetry_func)
+{ 
+    GB_Global.telemetry_func = telemetry_func ;
+}
+
+GB_PUBLIC
+GxB_telemetry_function_t GB_Global_telemetry_get (void)
+{ 
+    return (GB_Global.telemetry_func) ;
+}
+
+// get a unique id for a call to a user-callable method
+GB_PUBLIC
+uint64_t GB_Global_telemetry_call_id (void)
+{
+    uint64_t call_id ;
+    #ifdef _OPENMP
+    #pragma omp critical(GB_telemetry)
+    #endif
+    { 
+        call_id = ++(GB_Global.telemetry_ncalls) ;
+    }
+    return (call_id) ;
+}
+
+// count the bytes allocated by this thread
+GB_PUBLIC
+void GB_Global_telemetry_bytes_add (int64_t nbytes)
+{ 
+    #if GB_HAS_THREAD_LOCAL
+    GB_telemetry_bytes += nbytes ;
+    #endif
+}
+
+// get the total # of bytes allocated by this thread, or -1 if not known
+GB_PUBLIC
+int64_t GB_Global_telemetry_bytes_get (void)
+{ 
+    #if GB_HAS_THREAD_LOCAL
+    return (GB_telemetry_bytes) ;
+    #else
+    return (-1) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// thread sharing
+//------------------------------------------------------------------------------
+
+// If thread sharing is enabled, each user-callable method that reports to the
+// burble registers itself when it starts (GB_BURBLE_START) and unregisters
+// when it finishes (GB_BURBLE_END).  GB_GET_NTHREADS_MAX then limits each
+// parallel region to an equal share of the global nthreads_max, so that
+// calls made concurrently from several user threads do not oversubscribe
+// the cores.  A method that returns an error may skip GB_BURBLE_END, so each
+// user thread holds at most one registration (a thread is in at most one
+// user-callable method at a time); the registration is released when the
+// next method called by the thread finishes.  This requires thread-local
+// storage.
+
+#if GB_HAS_THREAD_LOCAL
+static GB_THREAD_LOCAL bool GB_thread_share_registered = false ;
+#endif
+
+GB_PUBLIC
+bool GB_Global_thread_sharing_set (bool thread_sharing)
+{
+    #if GB_HAS_THREAD_LOCAL
+    GB_Global.thread_sharing = thread_sharing ;
+    return (true) ;
+    #else
+    return (!thread_sharing) ;
+    #endif
+}
+
+GB_PUBLIC
+bool GB_Global_thread_sharing_get (void)
+{ 
+    return (GB_Global.thread_sharing) ;
+}
+
+// register the call made by this thread
+GB_PUBLIC
+void GB_Global_thread_share_begin (void)
+{
+    #if GB_HAS_THREAD_LOCAL
+    if (GB_Global.thread_sharing && !GB_thread_share_registered)
+    { 
+        GB_ATOMIC_UPDATE
+        GB_Global.thread_share_ncalls++ ;
+        GB_thread_share_registered = true ;
+    }
+    #endif
+}
+
+// unregister the call made by this thread
+GB_PUBLIC
+void GB_Global_thread_share_end (void)
+{
+    #if GB_HAS_THREAD_LOCAL
+    if (GB_thread_share_registered)
+    { 
+        GB_ATOMIC_UPDATE
+        GB_Global.thread_share_ncalls-- ;
+        GB_thread_share_registered = false ;
+    }
+    #endif
+}
+
+// limit nthreads_max to the share of the global nthreads_max of one call
+GB_PUBLIC
+int GB_Global_thread_share_get (int nthreads_max)
+{
+    int64_t ncalls ;
+    GB_ATOMIC_READ
+    ncalls = GB_Global.thread_share_ncalls ;
+    if (ncalls > 1)
+    { 
+        int64_t share = GB_IMAX (GB_Global.nthreads_max / ncalls, 1) ;
+        nthreads_max = (int) GB_IMIN (nthreads_max, share) ;
+    }
+    return (nthreads_max) ;
+}
+
+//------------------------------------------------------------------------------
+// NUMA policy
+//------------------------------------------------------------------------------
+
+// The policy is used by GB_numa_place, for large blocks allocated by
+// GB_malloc_memory and GB_calloc_memory.  Returns false if the policy is
+// GxB_NUMA_INTERLEAVE and the NUMA nodes cannot be determined.
+
+GB_PUBLIC
+bool GB_Global_numa_policy_set (int numa_policy)
+{
+    if (numa_policy == GxB_NUMA_INTERLEAVE)
+    {
+        uint64_t nodes = GB_numa_online_nodes ( ) ;
+        if (nodes == 0)
+        { 
+            // mbind is not available, or the nodes are unknown
+            return (false) ;
+        }
+        GB_Global.numa_nodes = nodes ;
+    }
+    GB_Global.numa_policy = numa_policy ;
+    return (true) ;
+}
+
+GB_PUBLIC
+int GB_Global_numa_policy_get (void)
+{ 
+    return (GB_Global.numa_policy) ;
+}
+
+GB_PUBLIC
+uint64_t GB_Global_numa_nodes_get (void)
+{ 
+    return (GB_Global.numa_nodes) ;
+}
+
+//------------------------------------------------------------------------------
+// aligned allocation and huge pages
+//------------------------------------------------------------------------------
+
+// Blocks can be aligned only if GraphBLAS uses the ANSI C malloc and free
+// (the default, with GrB_init), since aligned_alloc is paired with free.
+
+GB_PUBLIC
+bool GB_Global_malloc_is_ansi (void)
+{ 
+    return (GB_Global.malloc_function == malloc &&
+            GB_Global.free_function == free) ;
+}
+
+// memory_alignment_set returns false if the alignment cannot be guaranteed.
+// Blocks already allocated, or held in the free_pool, keep their alignment.
+
+GB_PUBLIC
+bool GB_Global_memory_alignment_set (size_t alignment)
+{
+    #if GB_HAS_ALIGNED_ALLOC
+    if (alignment > 0 && !GB_Global_malloc_is_ansi ( ))
+    { 
+        return (false) ;
+    }
+    GB_Global.memory_alignment = alignment ;
+    return (true) ;
+    #else
+    return (alignment == 0) ;
+    #endif
+}
+
+GB_PUBLIC
+size_t GB_Global_memory_alignment_get (void)
+{ 
+    return (GB_Global.memory_alignment) ;
+}
+
+GB_PUBLIC
+void GB_Global_huge_page_threshold_set (size_t threshold)
+{ 
+    GB_Global.huge_page_threshold = threshold ;
+}
+
+GB_PUBLIC
+size_t GB_Global_huge_page_threshold_get (void)
+{ 
+    return (GB_Global.huge_page_threshold) ;
+}
+
+//------------------------------------------------------------------------------
+// memory budget of the process
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void GB_Global_memory_budget_set (int64_t memory_budget)
+{ 
+    GB_Global.memory_budget = memory_budget ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_memory_budget_get (void)
+{ 
+    return (GB_Global.memory_budget) ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_memory_used_get (void)
+{ 
+    int64_t memory_used ;
+    GB_ATOMIC_READ
+    memory_used = GB_Global.memory_used ;
+    // blocks imported from the user application were never charged, but
+    // are returned when freed
+    return (GB_IMAX (memory_used, 0)) ;
+}
+
+// GB_Global_memory_add charges nbytes to the memory budget of the process and
+// to the budget of the GxB_Context engaged by this thread, if any (or returns
+// it, if nbytes < 0).  If check is true, the charge fails (and false is
+// returned) if either budget would be exceeded.  The process budget is not
+// checked and charged in a single atomic step, so concurrent calls can exceed
+// it by the size of the blocks they allocate at the same time.
+
+GB_PUBLIC
+bool GB_Global_memory_add (int64_t nbytes, bool check)
+{
+    if (nbytes == 0)
+    { 
+        return (true) ;
+    }
+    int64_t memory_budget = GB_Global.memory_budget ;
+    if (check && nbytes > 0 && memory_budget > 0 &&
+        GB_Global_memory_used_get ( ) + nbytes > memory_budget)
+    { 
+        // the memory budget of the process would be exceeded
+        return (false) ;
+    }
+    GB_ATOMIC_UPDATE
+    GB_Global.memory_used += nbytes ;
+    if (!GB_Global_context_memory_add (nbytes, check))
+    { 
+        // the memory budget of the engaged GxB_Context would be exceeded
+        GB_ATOMIC_UPDATE
+        GB_Global.memory_used -= nbytes ;
+        return (false) ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// blocks spilled to files
+//------------------------------------------------------------------------------
+
+// The spill_directory is set by GB_spill_directory_set.  It is an empty string
+// if spilling is disabled.
+
+GB_PUBLIC
+void GB_Global_spill_directory_set (const char *spill_directory)
+{ 
+    strncpy (GB_Global.spill_directory, spill_directory, GB_SPILL_PATH_MAX-1) ;
+    GB_Global.spill_directory [GB_SPILL_PATH_MAX-1] = '\0' ;
+}
+
+GB_PUBLIC
+const char *GB_Global_spill_directory_get (void)
+{ 
+    return (GB_Global.spill_directory) ;
+}
+
+GB_PUBLIC
+void GB_Global_spill_threshold_set (size_t spill_threshold)
+{ 
+    GB_Global.spill_threshold = spill_threshold ;
+}
+
+GB_PUBLIC
+size_t GB_Global_spill_threshold_get (void)
+{ 
+    return (GB_Global.spill_threshold) ;
+}
+
+// spill_ok: true if a block of the given size can be spilled to a file
+GB_PUBLIC
+bool GB_Global_spill_ok (size_t size)
+{ 
+    return (GB_Global.spill_directory [0] != '\0' &&
+        size >= GB_Global.spill_threshold) ;
+}
+
+// spill_add: add a block to the table of spilled blocks; false if full
+GB_PUBLIC
+bool GB_Global_spill_add (void *p, size_t size)
+{
+    bool ok = false ;
+    #ifdef _OPENMP
+    #pragma omp critical(GB_spill)
+    #endif
+    {
+        int64_t n = GB_Global.nspill ;
+        if (n < GB_SPILL_MAX)
+        { 
+            GB_Global.spill_p [n] = p ;
+            GB_Global.spill_size [n] = size ;
+            GB_Global.nspill = n + 1 ;
+            ok = true ;
+        }
+    }
+    return (ok) ;
+}
+
+// spill_remove: remove a block from the table; return its size, or 0 if the
+// block is not in the table
+GB_PUBLIC
+size_t GB_Global_spill_remove (void *p)
+{
+    size_t size = 0 ;
+    if (GB_Global.nspill == 0 || p == NULL)
+    { 
+        // quick return: no blocks have been spilled
+        return (0) ;
+    }
+    #ifdef _OPENMP
+    #pragma omp critical(GB_spill)
+    #endif
+    {
+        int64_t n = GB_Global.nspill ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            if (GB_Global.spill_p [k] == p)
+            { 
+                size = GB_Global.spill_size [k] ;
+                GB_Global.spill_p [k] = GB_Global.spill_p [n-1] ;
+                GB_Global.spill_size [k] = GB_Global.spill_size [n-1] ;
+                GB_Global.nspill = n - 1 ;
+                break ;
+            }
+        }
+    }
+    return (size) ;
+}
+
+// spill_find: true if the block has been spilled to a file
+GB_PUBLIC
+bool GB_Global_spill_find (void *p)
+{
+    bool found = false ;
+    if (GB_Global.nspill == 0 || p == NULL)
+    { 
+        // quick return: no blocks have been spilled
+        return (false) ;
+    }
+    #ifdef _OPENMP
+    #pragma omp critical(GB_spill)
+    #endif
+    {
+        int64_t n = GB_Global.nspill ;
+        for (int64_t k = 0 ; k < n && !found ; k++)
+        { 
+            found = (GB_Global.spill_p [k] == p) ;
+        }
+    }
+    return (found) ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_spill_nblocks (void)
+{ 
+    return (GB_Global.nspill) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_Context: the execution context engaged by each user thread
+//------------------------------------------------------------------------------
+
+// A user thread can engage a GxB_Context, which then provides the number of
+// threads, the chunk size, and the memory budget for all GraphBLAS methods
+// that thread calls.  Settings of GxB_DEFAULT in the context, or no engaged
+// context at all, defer to the global settings.  This requires thread-local
+// storage.
+
+#if GB_HAS_THREAD_LOCAL
+static GB_THREAD_LOCAL GxB_Context GB_context_engaged = NULL ;
+#endif
+
+// engage a context for this thread (or disengage it, if NULL)
+GB_PUBLIC
+bool GB_Global_context_engage (GxB_Context context)
+{
+    #if GB_HAS_THREAD_LOCAL
+    GB_context_engaged = context ;
+    return (true) ;
+    #else
+    return (context == NULL) ;
+    #endif
+}
+
+// get the context engaged by this thread, or NULL if none
+GB_PUBLIC
+GxB_Context GB_Global_context_get (void)
+{
+    #if GB_HAS_THREAD_LOCAL
+    return (GB_context_engaged) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+// get the max # of threads to use, from the context or the global setting
+GB_PUBLIC
+int GB_Global_context_nthreads_max_get (void)
+{
+    GxB_Context context = GB_Global_context_get ( ) ;
+    if (context != NULL && context->nthreads_max > GxB_DEFAULT)
+    {
+        return (context->nthreads_max) ;
+    }
+    return (GB_Global.nthreads_max) ;
+}
+
+// get the chunk size, from the context or the global setting
+GB_PUBLIC
+double GB_Global_context_chunk_get (void)
+{
+    GxB_Context context = GB_Global_context_get ( ) ;
+    if (context != NULL && context->chunk > GxB_DEFAULT)
+    {
+        return (context->chunk) ;
+    }
+    return (GB_Global.chunk) ;
+}
+
+// Charge nbytes to the memory used by the context engaged by this thread, or
+// return them if nbytes < 0.  If check is true and the charge would exceed
+// the budget of the context, nothing is charged and false is returned, and
+// the allocation must fail.  Blocks are charged to the context engaged by the
+// thread that allocates them, and returned to the context engaged by the
+// thread that frees them, so the count is exact only if these are the same.
+// Blocks imported from (or exported to) the user application are not
+// charged (or returned), so the count is kept from dropping below zero.
+
+GB_PUBLIC
+bool GB_Global_context_memory_add (int64_t nbytes, bool check)
+{
+    GxB_Context context = GB_Global_context_get ( ) ;
+    if (context == NULL || nbytes == 0)
+    {
+        return (true) ;
+    }
+    bool ok = true ;
+    #ifdef _OPENMP
+    #pragma omp critical(GB_context)
+    #endif
+    {
+        if (check && nbytes > 0 && context->max_memory > 0 &&
+            context->memory_used + nbytes > context->max_memory)
+        {
+            // the memory budget would be exceeded
+            ok = false ;
+        }
+        else
+        {
+            context->memory_used = GB_IMAX (context->memory_used + nbytes, 0);
+        }
+    }
+    return (ok) ;
+}
+
 //------------------------------------------------------------------------------
 // for printing matrices in 1-based index notation (@GrB and Julia)
 //------------------------------------------------------------------------------
@@ -1221,6 +1837,88 @@ double GB_Global_timing_get (int k)
 // the free block to be at least 8 bytes in size.
 #define GB_NEXT(p) ((void **) p) [0]
 
+//------------------------------------------------------------------------------
+// GB_free_pool_shard: caches of free blocks in front of the shared free_pool
+//------------------------------------------------------------------------------
+
+// The shared free_pool is protected by an OpenMP critical section, which
+// serializes the allocations of small blocks when many user threads call
+// GraphBLAS at the same time.  To avoid this, the free_pool has a set of
+// shards, each with its own small cache of free blocks of each size and its
+// own spin lock.  Each thread is assigned a shard the first time it uses the
+// free_pool, round-robin, so that each thread has a shard of its own unless
+// there are more than GB_FREE_POOL_NSHARDS threads.
+
+// A get from an empty cache takes up to half the cache limit from the shared
+// free_pool at once, and a put to a full cache moves up to half of the cache
+// to the shared free_pool, so the critical section is entered at most once
+// for every few gets or puts.  The blocks in the caches are always reachable,
+// and are freed by GrB_finalize, even if the threads that freed them have
+// terminated.  If thread-local storage is not available, the shards are not
+// used.
+
+#if defined ( _OPENMP ) && GB_HAS_THREAD_LOCAL
+
+#define GB_FREE_POOL_SHARDS 1
+#define GB_FREE_POOL_NSHARDS 64
+
+typedef struct
+{
+    int64_t lock ;              // 1 if locked, 0 if not
+    int64_t nhits ;             // # of gets satisfied by this shard
+    void *list [64] ;           // list [k]: link list of blocks of size 2^k
+    int64_t nblocks [64] ;      // # of blocks in list [k]
+    int64_t pad [8] ;           // keep the locks in separate cache lines
+}
+GB_free_pool_shard_struct ;
+
+static GB_free_pool_shard_struct GB_free_pool_shard [GB_FREE_POOL_NSHARDS] ;
+
+// shard id of this thread, plus one (zero if not yet assigned)
+static GB_THREAD_LOCAL int GB_free_pool_shard_id = 0 ;
+
+// get the shard of this thread
+static inline GB_free_pool_shard_struct *GB_free_pool_shard_get (void)
+{
+    if (GB_free_pool_shard_id == 0)
+    {
+        // first use of the free_pool by this thread
+        int id ;
+        #pragma omp critical(GB_free_pool)
+        {
+            id = (int) (GB_Global.free_pool_nshards++ % GB_FREE_POOL_NSHARDS) ;
+        }
+        GB_free_pool_shard_id = id + 1 ;
+    }
+    return (&(GB_free_pool_shard [GB_free_pool_shard_id - 1])) ;
+}
+
+// lock a shard
+static inline void GB_free_pool_shard_lock (GB_free_pool_shard_struct *shard)
+{
+    int64_t locked ;
+    do
+    { 
+        GB_ATOMIC_CAPTURE_INT64 (locked, shard->lock, 1) ;
+    }
+    while (locked) ;
+    GB_OMP_FLUSH
+}
+
+// unlock a shard
+static inline void GB_free_pool_shard_unlock (GB_free_pool_shard_struct *shard)
+{ 
+    GB_OMP_FLUSH
+    GB_ATOMIC_WRITE
+    shard->lock = 0 ;
+}
+
+#else
+
+#define GB_FREE_POOL_SHARDS 0
+
+#endif
+
 // free_pool_init: initialize the free_pool
 GB_PUBLIC
 void GB_Global_free_pool_init (bool clear)
@@ -1236,23 +1934,47 @@ void GB_Global_free_pool_init (bool clear)
                     GB_Global.free_pool [k] = NULL ;
                     GB_Global.free_pool_nblocks [k] = 0 ;
                 }
+                GB_Global.free_pool_hits = 0 ;
+                GB_Global.free_pool_misses = 0 ;
             }
             // set the default free_pool_limit
             for (int k = 0 ; k < 64 ; k++)
             {
+                GB_ATOMIC_WRITE
                 GB_Global.free_pool_limit [k] = 0 ;
             }
             int64_t n = 16384 ;
             for (int k = 3 ; k <= 8 ; k++)
             {
+                GB_ATOMIC_WRITE
                 GB_Global.free_pool_limit [k] = n ;
             }
             for (int k = 9 ; k <= 19 ; k++)
             {
                 n = n/2 ;
+                GB_ATOMIC_WRITE
                 GB_Global.free_pool_limit [k] = n ;
             }
         }
+        if (clear)
+        { 
+            #if GB_FREE_POOL_SHARDS
+            // clear the caches of all shards
+            for (int s = 0 ; s < GB_FREE_POOL_NSHARDS ; s++)
+            {
+                GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+                GB_free_pool_shard_lock (shard) ;
+                for (int k = 0 ; k < 64 ; k++)
+                {
+                    shard->list [k] = NULL ;
+                    shard->nblocks [k] = 0 ;
+                }
+                shard->nhits = 0 ;
+                GB_free_pool_shard_unlock (shard) ;
+            }
+            #endif
+            GB_Global_free_pool_cache_init ( ) ;
+        }
     #else
         // OpenMP not available: disable the free pool
         for (int k = 0 ; k < 64 ; k++)
@@ -1282,16 +2004,74 @@ void *GB_Global_free_pool_get (int k)
     #ifdef _OPENMP
         void *p = NULL ;
         ASSERT (k >= 3 && k < 64) ;
-        #pragma omp critical(GB_free_pool)
+
+        #if GB_FREE_POOL_SHARDS
+        GB_free_pool_shard_struct *shard = GB_free_pool_shard_get ( ) ;
+        GB_free_pool_shard_lock (shard) ;
+        p = shard->list [k] ;
+        if (p != NULL)
         {
-            p = GB_Global.free_pool [k] ;
-            if (p != NULL)
+            // remove the block from the kth list of the shard
+            shard->list [k] = GB_NEXT (p) ;
+            shard->nblocks [k]-- ;
+            shard->nhits++ ;
+        }
+        GB_free_pool_shard_unlock (shard) ;
+        #endif
+
+        if (p == NULL)
+        {
+            #if GB_FREE_POOL_SHARDS
+            // take up to half the cache limit, in addition to p
+            void *refill = NULL ;
+            int64_t nrefill, nmoved = 0 ;
+            GB_ATOMIC_READ
+            nrefill = GB_Global.free_pool_cache_limit [k] / 2 ;
+            #endif
+            #pragma omp critical(GB_free_pool)
+            {
+                p = GB_Global.free_pool [k] ;
+                if (p != NULL)
+                {
+                    // remove the block from the kth free_pool
+                    GB_Global.free_pool_nblocks [k]-- ;
+                    GB_Global.free_pool [k] = GB_NEXT (p) ;
+                    GB_Global.free_pool_hits++ ;
+                    #if GB_FREE_POOL_SHARDS
+                    while (nmoved < nrefill && GB_Global.free_pool [k] != NULL)
+                    {
+                        void *q = GB_Global.free_pool [k] ;
+                        GB_Global.free_pool [k] = GB_NEXT (q) ;
+                        GB_NEXT (q) = refill ;
+                        refill = q ;
+                        nmoved++ ;
+                    }
+                    GB_Global.free_pool_nblocks [k] -= nmoved ;
+                    #endif
+                }
+                else
+                { 
+                    GB_Global.free_pool_misses++ ;
+                }
+            }
+            #if GB_FREE_POOL_SHARDS
+            if (refill != NULL)
             {
-                // remove the block from the kth free_pool
-                GB_Global.free_pool_nblocks [k]-- ;
-                GB_Global.free_pool [k] = GB_NEXT (p) ;
+                // add the refill blocks to the kth list of the shard
+                GB_free_pool_shard_lock (shard) ;
+                for (int64_t t = 0 ; t < nmoved ; t++)
+                {
+                    void *q = refill ;
+                    refill = GB_NEXT (q) ;
+                    GB_NEXT (q) = shard->list [k] ;
+                    shard->list [k] = q ;
+                }
+                shard->nblocks [k] += nmoved ;
+                GB_free_pool_shard_unlock (shard) ;
             }
+            #endif
         }
+
         if (p != NULL)
         {
             // clear the next pointer inside the block, since the block needs
@@ -1315,6 +2095,47 @@ bool GB_Global_free_pool_put (void *p, int k)
         #ifdef GB_DEBUG
         GB_Global_free_pool_check (p, k, "put") ;
         #endif
+
+        #if GB_FREE_POOL_SHARDS
+        int64_t cache_limit, limit ;
+        GB_ATOMIC_READ
+        cache_limit = GB_Global.free_pool_cache_limit [k] ;
+        GB_ATOMIC_READ
+        limit = GB_Global.free_pool_limit [k] ;
+        cache_limit = GB_IMIN (cache_limit, limit) ;
+        void *flush = NULL ;
+        int64_t nflush = 0 ;
+        bool cached = false ;
+        GB_free_pool_shard_struct *shard = GB_free_pool_shard_get ( ) ;
+        GB_free_pool_shard_lock (shard) ;
+        if (shard->nblocks [k] < cache_limit)
+        { 
+            // add the block to the head of the kth list of the shard
+            GB_NEXT (p) = shard->list [k] ;
+            shard->list [k] = p ;
+            shard->nblocks [k]++ ;
+            cached = true ;
+        }
+        else
+        {
+            // the cache is full: move half of it to the shared free_pool
+            while (nflush < cache_limit / 2)
+            {
+                void *q = shard->list [k] ;
+                shard->list [k] = GB_NEXT (q) ;
+                GB_NEXT (q) = flush ;
+                flush = q ;
+                nflush++ ;
+            }
+            shard->nblocks [k] -= nflush ;
+        }
+        GB_free_pool_shard_unlock (shard) ;
+        if (cached)
+        { 
+            return (true) ;
+        }
+        #endif
+
         bool returned_to_pool = false ;
         #pragma omp critical(GB_free_pool)
         {
@@ -1328,6 +2149,18 @@ bool GB_Global_free_pool_put (void *p, int k)
                 GB_NEXT (p) = GB_Global.free_pool [k] ;
                 GB_Global.free_pool [k] = p ;
             }
+            #if GB_FREE_POOL_SHARDS
+            // add the blocks flushed from the shard, even if this exceeds the
+            // limit, since they are already held in the free_pool
+            while (flush != NULL)
+            {
+                void *q = flush ;
+                flush = GB_NEXT (q) ;
+                GB_NEXT (q) = GB_Global.free_pool [k] ;
+                GB_Global.free_pool [k] = q ;
+            }
+            GB_Global.free_pool_nblocks [k] += nflush ;
+            #endif
         }
         return (returned_to_pool) ;
     #else
@@ -1336,6 +2169,38 @@ bool GB_Global_free_pool_put (void *p, int k)
 }
 
 // free_pool_dump: check the validity of the free_pool
+#ifdef GB_DEBUG
+// check a list of free blocks of size 2^k
+static bool GB_Global_free_pool_list_check
+(
+    void *p,            // head of the list
+    int k,              // size of each block is 2^k
+    int64_t nblocks,    // # of blocks in the list
+    int pr
+)
+{
+    bool fail = false ;
+    int64_t nblocks_actual = 0 ;
+    for ( ; p != NULL && !fail ; p = GB_NEXT (p))
+    {
+        if (pr > 1) printf ("  %16p ", p) ;
+        size_t size = GB_Global_memtable_size (p) ;
+        if (pr > 1) printf ("size: %ld\n", size) ;
+        nblocks_actual++ ;
+        fail = fail || (size != ((size_t) 1) << k) ;
+        if (fail && pr > 0) printf ("    fail\n") ;
+        fail = fail || (nblocks_actual > nblocks) ;
+    }
+    if (nblocks_actual != nblocks)
+    {
+        if (pr > 0) printf ("fail: # blocks " GBd " " GBd " \n",
+            nblocks_actual, nblocks) ;
+        fail = true ;
+    }
+    return (fail) ;
+}
+#endif
+
 GB_PUBLIC
 void GB_Global_free_pool_dump (int pr)
 {
@@ -1353,43 +2218,46 @@ void GB_Global_free_pool_dump (int pr)
                 printf ("pool %2d: " GBd " blocks, " GBd " limit\n",
                     k, nblocks, limit) ;
             }
-            int64_t nblocks_actual = 0 ;
-            void *p = GB_Global.free_pool [k] ;
-            for ( ; p != NULL && !fail ; p = GB_NEXT (p))
-            {
-                if (pr > 1) printf ("  %16p ", p) ;
-                size_t size = GB_Global_memtable_size (p) ;
-                if (pr > 1) printf ("size: %ld\n", size) ;
-                nblocks_actual++ ;
-                fail = fail || (size != ((size_t) 1) << k) ;
-                if (fail && pr > 0) printf ("    fail\n") ;
-                fail = fail || (nblocks_actual > nblocks) ;
-            }
-            if (nblocks_actual != nblocks)
+            fail = GB_Global_free_pool_list_check (GB_Global.free_pool [k], k,
+                nblocks, pr) ;
+        }
+    }
+    #if GB_FREE_POOL_SHARDS
+    for (int s = 0 ; s < GB_FREE_POOL_NSHARDS && !fail ; s++)
+    {
+        GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+        GB_free_pool_shard_lock (shard) ;
+        for (int k = 0 ; k < 64 && !fail ; k++)
+        {
+            int64_t nblocks = shard->nblocks [k] ;
+            if (nblocks != 0 && pr > 0)
             {
-                if (pr > 0) printf ("fail: # blocks " GBd " " GBd " \n",
-                    nblocks_actual, nblocks) ;
-                fail = true ;
+                printf ("pool %2d shard %2d: " GBd " blocks\n", k, s, nblocks) ;
             }
+            fail = GB_Global_free_pool_list_check (shard->list [k], k,
+                nblocks, pr) ;
         }
+        GB_free_pool_shard_unlock (shard) ;
     }
+    #endif
     ASSERT (!fail) ;
     #endif
     #endif
 }
 
 // free_pool_limit_get: get the limit on the # of blocks in the kth pool
+// This is called for each allocation and free, so it does not use the
+// critical section.
+
 GB_PUBLIC
 int64_t GB_Global_free_pool_limit_get (int k)
 { 
     #ifdef _OPENMP
         int64_t nblocks = 0 ;
         if (k >= 3 && k < 64)
-        {
-            #pragma omp critical(GB_free_pool)
-            {
-                nblocks = GB_Global.free_pool_limit [k] ;
-            }
+        { 
+            GB_ATOMIC_READ
+            nblocks = GB_Global.free_pool_limit [k] ;
         }
         return (nblocks) ;
     #else
@@ -1406,6 +2274,7 @@ void GB_Global_free_pool_limit_set (int k, int64_t nblocks)
         #ifdef _OPENMP
             #pragma omp critical(GB_free_pool)
             {
+                GB_ATOMIC_WRITE
                 GB_Global.free_pool_limit [k] = nblocks ;
             }
         #else
@@ -1416,6 +2285,134 @@ void GB_Global_free_pool_limit_set (int k, int64_t nblocks)
     }
 }
 
+// free_pool_cache_init: set the default limits of the shard caches
+// By default, each shard caches up to 32 blocks of each size up to 2 KB, and
+// fewer blocks of larger sizes (never more than 1/64th of the limit of the
+// shared free_pool).  This is at most about 450 KB for each shard.
+
+GB_PUBLIC
+void GB_Global_free_pool_cache_init (void)
+{
+    for (int k = 0 ; k < 64 ; k++)
+    { 
+        int64_t limit = GB_Global_free_pool_limit_get (k) ;
+        GB_Global_free_pool_cache_limit_set (k, GB_IMIN (32, limit / 64)) ;
+    }
+}
+
+// free_pool_cache_limit_get: get the limit on the # of blocks in each cache
+GB_PUBLIC
+int64_t GB_Global_free_pool_cache_limit_get (int k)
+{ 
+    int64_t nblocks = 0 ;
+    #if GB_FREE_POOL_SHARDS
+    if (k >= 3 && k < 64)
+    { 
+        GB_ATOMIC_READ
+        nblocks = GB_Global.free_pool_cache_limit [k] ;
+    }
+    #endif
+    return (nblocks) ;
+}
+
+// free_pool_cache_limit_set: set the limit on the # of blocks in each cache
+// If the limit is reduced, the caches are trimmed as blocks are freed.
+
+GB_PUBLIC
+void GB_Global_free_pool_cache_limit_set (int k, int64_t nblocks)
+{ 
+    if (k >= 3 && k < 64)
+    { 
+        #if GB_FREE_POOL_SHARDS
+        nblocks = GB_IMAX (nblocks, 0) ;
+        #else
+        nblocks = 0 ;
+        #endif
+        GB_ATOMIC_WRITE
+        GB_Global.free_pool_cache_limit [k] = nblocks ;
+    }
+}
+
+// free_pool_stats_get: get the free_pool hit/miss counters
+// stats [0]: # of blocks obtained from the cache of a shard
+// stats [1]: # of blocks obtained from the shared free_pool
+// stats [2]: # of misses (no block of the right size was available)
+
+GB_PUBLIC
+void GB_Global_free_pool_stats_get (int64_t stats [3])
+{
+    stats [0] = 0 ;
+    #if GB_FREE_POOL_SHARDS
+    for (int s = 0 ; s < GB_FREE_POOL_NSHARDS ; s++)
+    { 
+        GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+        GB_free_pool_shard_lock (shard) ;
+        stats [0] += shard->nhits ;
+        GB_free_pool_shard_unlock (shard) ;
+    }
+    #endif
+    #ifdef _OPENMP
+    #pragma omp critical(GB_free_pool)
+    #endif
+    { 
+        stats [1] = GB_Global.free_pool_hits ;
+        stats [2] = GB_Global.free_pool_misses ;
+    }
+}
+
+// free_pool_stats_clear: clear the free_pool hit/miss counters
+GB_PUBLIC
+void GB_Global_free_pool_stats_clear (void)
+{
+    #if GB_FREE_POOL_SHARDS
+    for (int s = 0 ; s < GB_FREE_POOL_NSHARDS ; s++)
+    { 
+        GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+        GB_free_pool_shard_lock (shard) ;
+        shard->nhits = 0 ;
+        GB_free_pool_shard_unlock (shard) ;
+    }
+    #endif
+    #ifdef _OPENMP
+    #pragma omp critical(GB_free_pool)
+    #endif
+    { 
+        GB_Global.free_pool_hits = 0 ;
+        GB_Global.free_pool_misses = 0 ;
+    }
+}
+
+// free_pool_flush: move the blocks in all shards to the shared free_pool
+// This is used by GrB_finalize, so that all blocks can be freed.  The limit of
+// the shared free_pool may be exceeded.
+GB_PUBLIC
+void GB_Global_free_pool_flush (void)
+{
+    #if GB_FREE_POOL_SHARDS
+    for (int s = 0 ; s < GB_FREE_POOL_NSHARDS ; s++)
+    {
+        GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+        GB_free_pool_shard_lock (shard) ;
+        #pragma omp critical(GB_free_pool)
+        {
+            for (int k = 0 ; k < 64 ; k++)
+            {
+                while (shard->list [k] != NULL)
+                { 
+                    void *q = shard->list [k] ;
+                    shard->list [k] = GB_NEXT (q) ;
+                    GB_NEXT (q) = GB_Global.free_pool [k] ;
+                    GB_Global.free_pool [k] = q ;
+                }
+                GB_Global.free_pool_nblocks [k] += shard->nblocks [k] ;
+                shard->nblocks [k] = 0 ;
+            }
+        }
+        GB_free_pool_shard_unlock (shard) ;
+    }
+    #endif
+}
+
 // free_pool_nblocks_total:  total # of blocks in free_pool (for debug only)
 GB_PUBLIC
 int64_t GB_Global_free_pool_nblocks_total (void)
@@ -1430,6 +2427,18 @@ int64_t GB_Global_free_pool_nblocks_total (void)
         }
     }
     #endif
+    #if GB_FREE_POOL_SHARDS
+    for (int s = 0 ; s < GB_FREE_POOL_NSHARDS ; s++)
+    {
+        GB_free_pool_shard_struct *shard = &(GB_free_pool_shard [s]) ;
+        GB_free_pool_shard_lock (shard) ;
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            nblocks += shard->nblocks [k] ;
+        }
+        GB_free_pool_shard_unlock (shard) ;
+    }
+    #endif
     return (nblocks) ;
 }
 
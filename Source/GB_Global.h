@@ -129,6 +129,12 @@ GB_PUBLIC bool     GB_Global_free_pool_put (void *p, int k) ;
 GB_PUBLIC void     GB_Global_free_pool_dump (int pr) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_limit_get (int k) ;
 GB_PUBLIC void     GB_Global_free_pool_limit_set (int k, int64_t nblocks) ;
+GB_PUBLIC void     GB_Global_free_pool_cache_init (void) ;
+GB_PUBLIC int64_t  GB_Global_free_pool_cache_limit_get (int k) ;
+GB_PUBLIC void     GB_Global_free_pool_cache_limit_set (int k, int64_t nblocks);
+GB_PUBLIC void     GB_Global_free_pool_stats_get (int64_t stats [3]) ;
+GB_PUBLIC void     GB_Global_free_pool_stats_clear (void) ;
+GB_PUBLIC void     GB_Global_free_pool_flush (void) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_nblocks_total (void) ;
 
 typedef int (* GB_flush_function_t) (void) ;
@@ -140,6 +146,49 @@ GB_PUBLIC void     GB_Global_printf_set (GB_printf_function_t p) ;
 GB_PUBLIC GB_flush_function_t GB_Global_flush_get (void) ;
 GB_PUBLIC void     GB_Global_flush_set (GB_flush_function_t p) ;
 
+GB_PUBLIC void     GB_Global_telemetry_set (GxB_telemetry_function_t f) ;
+GB_PUBLIC GxB_telemetry_function_t GB_Global_telemetry_get (void) ;
+GB_PUBLIC uint64_t GB_Global_telemetry_call_id (void) ;
+GB_PUBLIC void     GB_Global_telemetry_bytes_add (int64_t nbytes) ;
+GB_PUBLIC int64_t  GB_Global_telemetry_bytes_get (void) ;
+
+GB_PUBLIC bool     GB_Global_thread_sharing_set (bool thread_sharing) ;
+GB_PUBLIC bool     GB_Global_thread_sharing_get (void) ;
+GB_PUBLIC void     GB_Global_thread_share_begin (void) ;
+GB_PUBLIC void     GB_Global_thread_share_end (void) ;
+GB_PUBLIC int      GB_Global_thread_share_get (int nthreads_max) ;
+
+GB_PUBLIC bool     GB_Global_numa_policy_set (int numa_policy) ;
+GB_PUBLIC int      GB_Global_numa_policy_get (void) ;
+GB_PUBLIC uint64_t GB_Global_numa_nodes_get (void) ;
+
+GB_PUBLIC bool     GB_Global_malloc_is_ansi (void) ;
+GB_PUBLIC bool     GB_Global_memory_alignment_set (size_t alignment) ;
+GB_PUBLIC size_t   GB_Global_memory_alignment_get (void) ;
+GB_PUBLIC void     GB_Global_huge_page_threshold_set (size_t threshold) ;
+GB_PUBLIC size_t   GB_Global_huge_page_threshold_get (void) ;
+
+GB_PUBLIC void     GB_Global_memory_budget_set (int64_t memory_budget) ;
+GB_PUBLIC int64_t  GB_Global_memory_budget_get (void) ;
+GB_PUBLIC int64_t  GB_Global_memory_used_get (void) ;
+GB_PUBLIC bool     GB_Global_memory_add (int64_t nbytes, bool check) ;
+
+GB_PUBLIC void     GB_Global_spill_directory_set (const char *spill_directory);
+GB_PUBLIC const char *GB_Global_spill_directory_get (void) ;
+GB_PUBLIC void     GB_Global_spill_threshold_set (size_t spill_threshold) ;
+GB_PUBLIC size_t   GB_Global_spill_threshold_get (void) ;
+GB_PUBLIC bool     GB_Global_spill_ok (size_t size) ;
+GB_PUBLIC bool     GB_Global_spill_add (void *p, size_t size) ;
+GB_PUBLIC size_t   GB_Global_spill_remove (void *p) ;
+GB_PUBLIC bool     GB_Global_spill_find (void *p) ;
+GB_PUBLIC int64_t  GB_Global_spill_nblocks (void) ;
+
+GB_PUBLIC bool     GB_Global_context_engage (GxB_Context context) ;
+GB_PUBLIC GxB_Context GB_Global_context_get (void) ;
+GB_PUBLIC int      GB_Global_context_nthreads_max_get (void) ;
+GB_PUBLIC double   GB_Global_context_chunk_get (void) ;
+GB_PUBLIC bool     GB_Global_context_memory_add (int64_t nbytes, bool check) ;
+
 GB_PUBLIC double   GB_Global_get_wtime (void) ;
 #endif
 
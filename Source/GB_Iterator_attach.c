@@ -78,6 +78,10 @@ GrB_Info GB_Iterator_attach
     iterator->iso = A->iso ;
     iterator->by_col = A->is_csc ;
 
+    // a row/col iterator can traverse all of the matrix
+    iterator->kend = iterator->anvec ;
+    iterator->plast = iterator->pmax ;
+
     return (GrB_SUCCESS) ;
 }
 
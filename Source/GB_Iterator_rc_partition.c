@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_partition: seek a row/col iterator to a partition of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The entries held in the matrix, in positions 0 to pmax-1, are split into
+// ntasks contiguous slices of nearly equal size, just as GB_ek_slice does for
+// the parallel methods inside GraphBLAS.  The tid-th slice holds positions
+// pfirst to plast-1.  The iterator is restricted to that slice: it starts at
+// the vector kfirst that contains pfirst, and is exhausted when it reaches
+// the vector kend, so that each vector is visited by just one task.  The only
+// exception is a vector split between two or more slices; it is visited by
+// each of those tasks, each of which sees a disjoint subset of its entries.
+
+// Empty vectors are visited by the task whose slice ends after them, just as
+// they would be visited by GxB_rowIterator_nextRow for a single iterator.
+
+#include "GB.h"
+#include "GB_search_for_vector_template.c"
+
+//------------------------------------------------------------------------------
+// GB_rc_partition_kfirst: find the first vector of the tid-th slice
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_rc_partition_kfirst
+(
+    GxB_Iterator iterator,
+    int64_t pfirst,             // first position in the slice
+    int tid
+)
+{
+    if (tid == 0)
+    {
+        // the first slice always starts at the first vector
+        return (0) ;
+    }
+    else if (pfirst >= iterator->pmax)
+    {
+        // the slice is empty, and at the end of the matrix
+        return (iterator->anvec) ;
+    }
+    else
+    {
+        // find the vector k that contains the position pfirst
+        return (GB_search_for_vector (pfirst, iterator->Ap, 0,
+            iterator->anvec, iterator->avlen)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_partition
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Iterator_rc_partition
+(
+    GxB_Iterator iterator,
+    int tid,
+    int ntasks
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the iterator is exhausted
+    //--------------------------------------------------------------------------
+
+    iterator->pstart = 0 ;
+    iterator->pend = 0 ;
+    iterator->p = 0 ;
+    iterator->k = iterator->anvec ;
+    iterator->kend = iterator->anvec ;
+    iterator->plast = iterator->pmax ;
+    if (ntasks <= 0 || tid < 0 || tid >= ntasks)
+    {
+        return (GxB_EXHAUSTED) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the slice pfirst:plast-1 for this task
+    //--------------------------------------------------------------------------
+
+    int64_t pmax = iterator->pmax ;
+    int64_t pfirst, plast ;
+    GB_PARTITION (pfirst, plast, pmax, tid, ntasks) ;
+    if (tid > 0 && pfirst >= plast)
+    {
+        // this slice is empty; all of its vectors are visited by other tasks
+        return (GxB_EXHAUSTED) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the first vector of this slice and the first vector of the next
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = iterator->Ap ;
+    const int64_t avlen = iterator->avlen ;
+    int64_t kfirst = GB_rc_partition_kfirst (iterator, pfirst, tid) ;
+    int64_t kend = (tid == ntasks-1) ? iterator->anvec :
+        GB_rc_partition_kfirst (iterator, plast, tid+1) ;
+    if (kend < iterator->anvec)
+    {
+        // If the next slice starts in the middle of the vector kend, that
+        // vector is split, and the first part of it is in this slice.
+        int64_t pnext = (Ap == NULL) ? (kend * avlen) : Ap [kend] ;
+        if (pnext < plast)
+        {
+            kend++ ;
+        }
+    }
+
+    if (kfirst >= kend)
+    {
+        // no vectors in this slice
+        return (GxB_EXHAUSTED) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // attach the iterator to the part of the vector kfirst in this slice
+    //--------------------------------------------------------------------------
+
+    int64_t pstart, pend ;
+    if (Ap == NULL)
+    {
+        // bitmap or full
+        pstart = kfirst * avlen ;
+        pend = pstart + avlen ;
+    }
+    else
+    {
+        // sparse or hypersparse
+        pstart = Ap [kfirst] ;
+        pend = Ap [kfirst+1] ;
+    }
+
+    // pstart is kept as the start of the vector, since it is needed to
+    // compute the index of an entry in a bitmap or full matrix.
+    iterator->pstart = pstart ;
+    iterator->pend = GB_IMIN (pend, plast) ;
+    iterator->p = GB_IMAX (pstart, pfirst) ;
+    iterator->k = kfirst ;
+    iterator->kend = kend ;
+    iterator->plast = plast ;
+
+    if (iterator->A_sparsity == GxB_BITMAP)
+    {
+        return (GB_Iterator_rc_bitmap_next (iterator)) ;
+    }
+    return ((iterator->p >= iterator->pend) ? GrB_NO_VALUE : GrB_SUCCESS) ;
+}
+
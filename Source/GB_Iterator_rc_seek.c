@@ -23,6 +23,13 @@ GrB_Info GB_Iterator_rc_seek
 )
 {
 
+    //--------------------------------------------------------------------------
+    // remove any restriction from GB_Iterator_rc_partition
+    //--------------------------------------------------------------------------
+
+    iterator->kend = iterator->anvec ;
+    iterator->plast = iterator->pmax ;
+
     //--------------------------------------------------------------------------
     // check if the iterator is exhausted
     //--------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// GB_Iterator_rc_span: get the span of the current vector of a row/col iterator
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The span is the set of positions p to pend-1 in the current vector, where p
+// is the current entry.  Pointers into the matrix are returned, so that the
+// span can be traversed by the caller without any function call per entry.
+
+#include "GB.h"
+
+GrB_Info GB_Iterator_rc_span
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,           // # of positions in the span
+    const GrB_Index **Indices,  // indices, or NULL if bitmap or full
+    GrB_Index *first,           // index of the first position
+    const int8_t **Bitmap,      // bitmap of the span, or NULL if not bitmap
+    const void **Values,        // values of the span, or the iso value
+    bool *iso                   // true if all entries have the value Values[0]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the range of the span
+    //--------------------------------------------------------------------------
+
+    int64_t p = iterator->p ;
+    int64_t n = GB_IMAX (iterator->pend - p, 0) ;
+    const int64_t *restrict Ai = iterator->Ai ;
+    const int8_t  *restrict Ab = iterator->Ab ;
+    const GB_void *restrict Ax = (GB_void *) iterator->Ax ;
+
+    //--------------------------------------------------------------------------
+    // return the span
+    //--------------------------------------------------------------------------
+
+    (*count) = (GrB_Index) n ;
+    if (Ai != NULL)
+    {
+        // sparse or hypersparse: the indices are held explicitly
+        (*Indices) = (const GrB_Index *) (Ai + p) ;
+        (*first) = (n == 0) ? 0 : Ai [p] ;
+    }
+    else
+    {
+        // bitmap or full: the indices are implicit
+        (*Indices) = NULL ;
+        (*first) = p - iterator->pstart ;
+    }
+    (*Bitmap) = (Ab == NULL) ? NULL : (Ab + p) ;
+    (*iso) = iterator->iso ;
+    (*Values) = (iterator->iso) ? Ax : (Ax + p * iterator->type_size) ;
+    return ((n == 0) ? GrB_NO_VALUE : GrB_SUCCESS) ;
+}
+
@@ -22,12 +22,27 @@ bool GB_aliased             // determine if A and B are aliased
     GrB_Matrix B            // input B matrix
 ) ;
 
-// matrices returned to the user are never shallow; internal matrices may be
+// GB_same_pattern checks if A and B are aliases with the same pattern
+GB_PUBLIC
+bool GB_same_pattern        // true if A and B are known to have same pattern
+(
+    GrB_Matrix A,           // input A matrix
+    GrB_Matrix B            // input B matrix
+) ;
+
+// matrices returned to the user are never shallow, except for those from
+// GxB_Matrix_deserialize with GxB_SHALLOW_IMPORT; internal matrices may be
 GB_PUBLIC
 bool GB_is_shallow              // true if any component of A is shallow
 (
     GrB_Matrix A                // matrix to query
 ) ;
 
+GrB_Info GB_unshallow           // replace shallow components of A with copies
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+) ;
+
 #endif
 
@@ -276,6 +276,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         && GB_nnz (C) > 0)
     {
         GBURBLE ("(in-place-op) ") ;
+        GB_OK (GB_unshallow (C, Context)) ;
         // C = op (C), operating on the values in-place, with no typecasting
         // of the output of the operator with the matrix C.
         // No work to do if the op is identity.
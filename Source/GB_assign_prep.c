@@ -110,7 +110,6 @@ GrB_Info GB_assign_prep
     GrB_Matrix A = A_in ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_assign_prep", GB0) ;
-    ASSERT (!GB_is_shallow (C)) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_assign_prep", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_assign_prep", GB0) ;
     ASSERT (scode <= GB_UDT_code) ;
@@ -149,6 +148,13 @@ GrB_Info GB_assign_prep
     (*nJ_handle) = 0 ;
     (*Jkind_handle) = 0 ;
 
+    //--------------------------------------------------------------------------
+    // C is modified in-place, so it must own all of its content
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_unshallow (C, Context)) ;
+    ASSERT (!GB_is_shallow (C)) ;
+
     //--------------------------------------------------------------------------
     // determine the type of A or the scalar
     //--------------------------------------------------------------------------
@@ -107,6 +107,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
         //----------------------------------------------------------------------
 
         GBURBLE ("(iso bitmap saxpy) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "saxpy:bitmap", 0, 0) ;
         memcpy (C->x, cscalar, ctype->size) ;
         info = GB (_AsaxbitB__any_pair_iso) (C, M, Mask_comp, Mask_struct, A,
             B, Context) ;
@@ -120,6 +121,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
         //----------------------------------------------------------------------
 
         GBURBLE ("(bitmap saxpy) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_METHOD, "saxpy:bitmap", 0, 0) ;
         bool done = false ;
 
         #ifndef GBCUDA_DEV
@@ -42,6 +42,7 @@ static inline void *GB_calloc_helper
         #endif
     }
 
+    bool place = false ;
     if (p == NULL)
     {
         // no block in the free_pool, so allocate it
@@ -49,6 +50,15 @@ static inline void *GB_calloc_helper
         #ifdef GB_MEMDUMP
         printf ("hard calloc %p %ld\n", p, *size) ;
         #endif
+        // back a large new block with huge pages, if requested
+        size_t threshold = GB_Global_huge_page_threshold_get ( ) ;
+        if (p != NULL && threshold > 0 && (*size) >= threshold)
+        { 
+            GB_huge_page_advise (p, *size) ;
+        }
+        // place a large new block on the NUMA nodes, if requested
+        place = (*size) >= GB_NUMA_MIN_SIZE &&
+            GB_Global_numa_policy_get ( ) != GxB_NUMA_DEFAULT ;
     }
 
     #ifdef GB_MEMDUMP
@@ -56,10 +66,17 @@ static inline void *GB_calloc_helper
     #endif
 
     if (p != NULL)
-    { 
+    {
         // clear the block of memory with a parallel memset
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
-        GB_memset (p, 0, size_requested, nthreads_max) ;
+        if (place)
+        { 
+            GB_numa_place (p, *size, size_requested, nthreads_max) ;
+        }
+        else
+        { 
+            GB_memset (p, 0, size_requested, nthreads_max) ;
+        }
     }
 
     return (p) ;
@@ -103,11 +120,30 @@ void *GB_calloc_memory      // pointer to allocated block of memory
         return (NULL) ;
     }
 
+    // charge the block to the memory budgets of the process and the engaged
+    // GxB_Context.  If a budget would be exceeded, a large block can still be
+    // spilled to a file.
+    size_t size_charged = size ;
+    bool charged = GB_Global_memory_add ((int64_t) size_charged, true) ;
+    bool spill_ok = GB_Global_spill_ok (size) ;
+    if (!charged && !spill_ok)
+    { 
+        // memory budget exceeded
+        (*size_allocated) = 0 ;
+        return (NULL) ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate the memory block
     //--------------------------------------------------------------------------
 
-    if (GB_Global_malloc_tracking_get ( ))
+    bool pretend_to_fail = false ;
+    if (!charged)
+    { 
+        // memory budget exceeded; spill the block to a file instead
+        p = NULL ;
+    }
+    else if (GB_Global_malloc_tracking_get ( ))
     {
 
         //----------------------------------------------------------------------
@@ -115,7 +151,6 @@ void *GB_calloc_memory      // pointer to allocated block of memory
         //----------------------------------------------------------------------
 
         // brutal memory debug; pretend to fail if (count-- <= 0).
-        bool pretend_to_fail = false ;
         if (GB_Global_malloc_debug_get ( ))
         {
             pretend_to_fail = GB_Global_malloc_debug_count_decrement ( ) ;
@@ -142,11 +177,32 @@ void *GB_calloc_memory      // pointer to allocated block of memory
         p = GB_calloc_helper (&size, Context) ;
     }
 
+    //--------------------------------------------------------------------------
+    // spill the block to a file if it could not be allocated
+    //--------------------------------------------------------------------------
+
+    bool spilled = false ;
+    if (p == NULL && spill_ok && !pretend_to_fail)
+    { 
+        // the block is already zero, since its file is new
+        size = size_charged ;
+        p = GB_spill_malloc (size) ;
+        spilled = (p != NULL) ;
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
 
     (*size_allocated) = (p == NULL) ? 0 : size ;
+    GB_Global_telemetry_bytes_add ((int64_t) (*size_allocated)) ;
+    if (charged)
+    { 
+        // adjust the charge for the size actually allocated (none if failed,
+        // or if the block was spilled to a file)
+        int64_t size_used = spilled ? 0 : ((int64_t) (*size_allocated)) ;
+        GB_Global_memory_add (size_used - (int64_t) size_charged, false) ;
+    }
     ASSERT (GB_IMPLIES (p != NULL, size == GB_Global_memtable_size (p))) ;
     return (p) ;
 }
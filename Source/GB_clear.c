@@ -52,7 +52,7 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
     if (((sparsity_control & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0)
-        && GB_IS_BITMAP (A))
+        && GB_IS_BITMAP (A) && !A->b_shallow)
     { 
         // A should remain bitmap
         GB_memset (A->b, 0, GB_nnz_held (A), nthreads_max) ;
@@ -247,6 +247,46 @@
 
 #endif
 
+//------------------------------------------------------------------------------
+// thread-local storage
+//------------------------------------------------------------------------------
+
+// GB_THREAD_LOCAL declares a variable with one instance for each thread.  It
+// is used only in GB_Global.c, to select the shard of the free_pool used by
+// each thread and to count the bytes allocated by each thread for the
+// telemetry.  Both are disabled if it is not available.
+
+#if GB_COMPILER_NVCC || defined ( __cplusplus )
+
+    // not used in CUDA or C++ code
+    #define GB_HAS_THREAD_LOCAL 0
+    #define GB_THREAD_LOCAL
+
+#elif GB_COMPILER_MSC
+
+    // MS Visual Studio
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL __declspec (thread)
+
+#elif GxB_STDC_VERSION >= 201112L
+
+    // ANSI C11 and later
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL _Thread_local
+
+#elif GB_COMPILER_GCC || GB_COMPILER_CLANG || GB_COMPILER_ICC || GB_COMPILER_ICX
+
+    // gcc extension, also supported by clang and the Intel compilers
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL __thread
+
+#else
+
+    #define GB_HAS_THREAD_LOCAL 0
+    #define GB_THREAD_LOCAL
+
+#endif
+
 //------------------------------------------------------------------------------
 // AVX2 and AVX512F support for the x86_64 architecture
 //------------------------------------------------------------------------------
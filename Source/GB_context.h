@@ -39,6 +39,13 @@ typedef struct
     size_t *logger_size_handle ;
     int nthreads_max ;              // max # of threads to use
     int pwerk ;                     // top of Werk stack, initially zero
+    // telemetry (only used if Context->operation is not NULL):
+    const char *operation ;         // user-callable method being timed
+    uint64_t call_id ;              // unique id of this call
+    double telemetry_time ;         // time when the method started
+    double telemetry_flops ;        // flop count from the last analysis
+    int64_t telemetry_bytes ;       // bytes allocated when it started
+    int telemetry_nthreads ;        // max # of threads used by any event
 }
 GB_Context_struct ;
 
@@ -60,14 +67,17 @@ typedef GB_Context_struct *GB_Context ;
     GB_Context Context = &Context_struct ;                          \
     /* set Context->where so GrB_error can report it if needed */   \
     Context->where = where_string ;                                 \
-    /* get the default max # of threads and default chunk size */   \
-    Context->nthreads_max = GB_Global_nthreads_max_get ( ) ;        \
-    Context->chunk = GB_Global_chunk_get ( ) ;                      \
+    /* get the max # of threads and chunk size, from the */         \
+    /* GxB_Context engaged by this thread, or global settings */    \
+    Context->nthreads_max = GB_Global_context_nthreads_max_get ( ) ; \
+    Context->chunk = GB_Global_context_chunk_get ( ) ;              \
     /* get the pointer to where any error will be logged */         \
     Context->logger_handle = NULL ;                                 \
     Context->logger_size_handle = NULL ;                            \
     /* initialize the Werk stack */                                 \
-    Context->pwerk = 0 ;
+    Context->pwerk = 0 ;                                            \
+    /* no telemetry until GB_BURBLE_START */                        \
+    Context->operation = NULL ;
 
 // C is a matrix, vector, scalar, or descriptor
 #define GB_WHERE(C,where_string)                                    \
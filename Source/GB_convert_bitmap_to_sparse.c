@@ -37,6 +37,7 @@ GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
     ASSERT (!GB_JUMBLED (A)) ;      // bitmap is never jumbled
     ASSERT (!GB_ZOMBIES (A)) ;      // bitmap never has zomies
     GBURBLE ("(bitmap to sparse) ") ;
+    GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "bitmap to sparse", 0, 0) ;
 
     //--------------------------------------------------------------------------
     // allocate Ap, Ai, and Ax
@@ -29,6 +29,7 @@ GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
     ASSERT (!GB_JUMBLED (A)) ;
     ASSERT (!GB_PENDING (A)) ;
     GBURBLE ("(full to bitmap) ") ;
+    GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "full to bitmap", 0, 0) ;
 
     //--------------------------------------------------------------------------
     // allocate A->b
@@ -29,6 +29,7 @@ GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
     ASSERT (!GB_JUMBLED (A)) ;
     ASSERT (!GB_PENDING (A)) ;
     GBURBLE ("(full to sparse) ") ;
+    GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "full to sparse", 0, 0) ;
 
     //--------------------------------------------------------------------------
     // allocate A->p and A->i
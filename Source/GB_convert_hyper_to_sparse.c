@@ -50,6 +50,7 @@ GrB_Info GB_convert_hyper_to_sparse // convert hypersparse to sparse
         //----------------------------------------------------------------------
 
         GBURBLE ("(hyper to sparse) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "hyper to sparse", 0, 0) ;
         int64_t n = A->vdim ;
 
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
@@ -48,6 +48,7 @@ GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
     ASSERT (GB_JUMBLED_OK (A)) ;        // A can be jumbled on input
     ASSERT (GB_ZOMBIES_OK (A)) ;        // A can have zombies on input
     GBURBLE ("(sparse to bitmap) ") ;
+    GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "sparse to bitmap", 0, 0) ;
 
     //--------------------------------------------------------------------------
     // determine the maximum number of threads to use
@@ -50,6 +50,7 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         //----------------------------------------------------------------------
 
         GBURBLE ("(sparse to hyper) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_CONVERT, "sparse to hyper", 0, 0) ;
         int64_t n = A->vdim ;
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
         int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
@@ -29,7 +29,18 @@ void GB_dealloc_memory      // free memory, return to free_pool or free it
     {
         bool returned_to_free_pool = false ;
 
-        if (GB_IS_POWER_OF_TWO (size_allocated))
+        // a block spilled to a file was not charged to the memory budgets,
+        // and is never returned to the free_pool
+        bool spilled = GB_Global_spill_find (*p) ;
+
+        if (!spilled)
+        { 
+            // return the block to the memory budgets of the process and the
+            // engaged GxB_Context
+            GB_Global_memory_add (-((int64_t) size_allocated), false) ;
+        }
+
+        if (!spilled && GB_IS_POWER_OF_TWO (size_allocated))
         { 
 
             //------------------------------------------------------------------
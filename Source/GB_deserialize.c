@@ -9,11 +9,25 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If shallow is true, any array of C held in the blob without compression,
+// and suitably aligned, is not copied.  Instead, that component of C is a
+// shallow pointer into the blob (C->p_shallow, C->x_shallow, etc, are true).
+// The blob must not be modified or freed until C is freed.  GraphBLAS makes
+// its own copy of any shallow component of C before modifying C (see
+// GB_unshallow), so C can be used in any GraphBLAS method.
+
+// If reader is not NULL, the blob is not in memory, but is read in order from
+// a stream via the user's reader function (for GxB_Matrix_deserialize_stream),
+// and the blob and blob_size inputs are ignored.  Only the header and the
+// compressed block sizes are held in memory (in the workspace H); each array
+// is then read and decompressed directly into C (see GB_deserialize_from_blob).
+
 #include "GB.h"
 #include "GB_serialize.h"
 
 #define GB_FREE_ALL                         \
 {                                           \
+    GB_FREE (&H, H_size) ;                  \
     GB_Matrix_free (&T) ;                   \
     GB_Matrix_free (&C) ;                   \
 }
@@ -26,6 +40,9 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
     size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, C may be shallow in the blob
+    GxB_serialize_read_function reader, // if not NULL, read C from a stream
+    void *stream,                   // stream for the reader
     GB_Context Context
 )
 {
@@ -35,9 +52,33 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    ASSERT (blob != NULL && Chandle != NULL) ;
+    ASSERT ((blob != NULL || reader != NULL) && Chandle != NULL) ;
     (*Chandle) = NULL ;
     GrB_Matrix C = NULL, T = NULL ;
+    GB_void *H = NULL ; size_t H_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the header from the stream, if present
+    //--------------------------------------------------------------------------
+
+    if (reader != NULL)
+    {
+        H = GB_MALLOC (GB_BLOB_HEADER_SIZE, GB_void, &H_size) ;
+        if (H == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (!reader (stream, H, GB_BLOB_HEADER_SIZE))
+        { 
+            // stream is invalid or truncated
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        // the header holds the size of the entire blob
+        blob = H ;
+        memcpy (&blob_size, H, sizeof (size_t)) ;
+    }
 
     //--------------------------------------------------------------------------
     // read the content of the header (160 bytes)
@@ -48,6 +89,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     if (blob_size < GB_BLOB_HEADER_SIZE)
     { 
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_INVALID_OBJECT)  ;
     }
 
@@ -60,6 +102,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
     { 
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_INVALID_OBJECT)  ;
     }
 
@@ -89,6 +132,48 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     bool iso = ((sparsity_iso_csc & 2) == 2) ;
     bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
 
+    //--------------------------------------------------------------------------
+    // read the type name and compressed block sizes from the stream
+    //--------------------------------------------------------------------------
+
+    if (reader != NULL)
+    {
+        if (Cp_nblocks < 0 || Ch_nblocks < 0 || Cb_nblocks < 0 ||
+            Ci_nblocks < 0 || Cx_nblocks < 0)
+        { 
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        size_t hsize = GB_BLOB_HEADER_SIZE
+            + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0)
+            + sizeof (int64_t) * ((size_t) Cp_nblocks + (size_t) Ch_nblocks
+                + (size_t) Cb_nblocks + (size_t) Ci_nblocks
+                + (size_t) Cx_nblocks) ;
+        if (hsize > blob_size)
+        { 
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        bool ok = true ;
+        GB_REALLOC (H, hsize, GB_void, &H_size, &ok, Context) ;
+        if (!ok)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        blob = H ;
+        if (!reader (stream, H + GB_BLOB_HEADER_SIZE,
+            hsize - GB_BLOB_HEADER_SIZE))
+        { 
+            // stream is invalid or truncated
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the matrix type
     //--------------------------------------------------------------------------
@@ -100,6 +185,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     if (ctype == NULL || ctype->size != typesize)
     { 
         // blob is invalid; type is missing or the wrong size
+        GB_FREE_ALL ;
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
@@ -112,6 +198,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             GxB_MAX_NAME_LEN) != 0)
         { 
             // blob is invalid
+            GB_FREE_ALL ;
             return (GrB_DOMAIN_MISMATCH) ;
         }
         s += GxB_MAX_NAME_LEN ;
@@ -120,6 +207,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     { 
         // built-in type must match type_expected
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
@@ -163,36 +251,42 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         case GxB_HYPERSPARSE : 
             // decompress Cp, Ch, and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s, Context)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, shallow, sizeof (int64_t), reader,
+                stream, &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s, Context)) ;
+                &(C->h_shallow), Ch_len, blob, blob_size, Ch_Sblocks,
+                Ch_nblocks, Ch_method, shallow, sizeof (int64_t), reader,
+                stream, &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s, Context)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, shallow, sizeof (int64_t), reader,
+                stream, &s, Context)) ;
             break ;
 
         case GxB_SPARSE : 
 
             // decompress Cp and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s, Context)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, shallow, sizeof (int64_t), reader,
+                stream, &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s, Context)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, shallow, sizeof (int64_t), reader,
+                stream, &s, Context)) ;
             break ;
 
         case GxB_BITMAP : 
 
             // decompress Cb
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s, Context)) ;
+                &(C->b_shallow), Cb_len, blob, blob_size, Cb_Sblocks,
+                Cb_nblocks, Cb_method, shallow, 1, reader, stream, &s,
+                Context)) ;
             break ;
 
         case GxB_FULL : 
@@ -200,10 +294,18 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         default: ;
     }
 
-    // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s, Context)) ;
+    // decompress Cx; if shallow, it must be aligned to the largest power of
+    // 2 that divides the typesize (up to 8 bytes)
+    size_t Cx_align = 1 ;
+    while (Cx_align < 8 && typesize % (2 * Cx_align) == 0)
+    { 
+        Cx_align = 2 * Cx_align ;
+    }
+    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size),
+        &(C->x_shallow), Cx_len, blob, blob_size, Cx_Sblocks, Cx_nblocks,
+        Cx_method, shallow, Cx_align, reader, stream, &s, Context)) ;
     C->magic = GB_MAGIC ;
+    GB_FREE (&H, H_size) ;
 
     //--------------------------------------------------------------------------
     // return result
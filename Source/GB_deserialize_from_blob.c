@@ -13,13 +13,30 @@
 // However, the contents of output array are not fully checked.  This step is
 // done by GB_deserialize, if requested.
 
+// If shallow is true, the array is held in the blob with no compression, and
+// its first byte is aligned to X_align bytes, then X is returned as a shallow
+// pointer into the blob itself, and no memory is allocated.  In that case,
+// (*X_shallow_handle) is returned as true, and the caller must not free X.
+
+// If reader is not NULL, the array is read from a stream instead, via the
+// user's reader function (for GxB_Matrix_deserialize_stream), and the blob
+// is not accessed.  Compressed blocks are read and decompressed in batches of
+// at most nthreads_max blocks each, so only a small workspace is needed.
+
+// If the method includes GxB_COMPRESSION_DELTA, X is an int64_t array, and
+// each block is decompressed into workspace and then decoded into X (see
+// GB_delta_decode).  The blocks partition the entries of X, not its bytes.
+// These blocks are also decompressed in batches, to limit the workspace.
+
 #include "GB.h"
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE (&X, X_size) ;  \
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE (&X, X_size) ;          \
+    GB_FREE_WORK (&W, W_size) ;     \
+    GB_FREE_WORK (&D, D_size) ;     \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -27,6 +44,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X is a shallow pointer into blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -34,6 +52,10 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    bool shallow,               // if true, X may be returned as shallow
+    size_t X_align,             // required alignment of X if shallow
+    GxB_serialize_read_function reader, // if not NULL, read X from a stream
+    void *stream,               // stream for the reader
     // input/output:
     size_t *s_handle,           // where to read from the blob
     GB_Context Context
@@ -49,20 +71,44 @@ GrB_Info GB_deserialize_from_blob
     ASSERT (s_handle != NULL) ;
     ASSERT (X_handle != NULL) ;
     ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow_handle != NULL) ;
     (*X_handle) = NULL ;
     (*X_size_handle) = 0 ;
+    (*X_shallow_handle) = false ;
 
     //--------------------------------------------------------------------------
     // parse the method
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
-    GB_serialize_method (&algo, &level, method) ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
+
+    size_t s = (*s_handle) ;
+
+    //--------------------------------------------------------------------------
+    // return X as a shallow pointer into the blob, if possible
+    //--------------------------------------------------------------------------
+
+    if (shallow && reader == NULL && algo == GxB_COMPRESSION_NONE
+        && nblocks == 1
+        && X_len > 0 && Sblocks [0] == X_len && s + X_len <= blob_size
+        && ((uintptr_t) (blob + s)) % X_align == 0)
+    { 
+        // X is held as-is in the blob, and is suitably aligned
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = (size_t) X_len ;
+        (*X_shallow_handle) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the output array
     //--------------------------------------------------------------------------
 
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    uint8_t *D = NULL ; size_t D_size = 0 ;
     size_t X_size = 0 ;
     GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
     if (X == NULL)
@@ -81,10 +127,14 @@ GrB_Info GB_deserialize_from_blob
     // decompress the blocks from the blob
     //--------------------------------------------------------------------------
 
-    size_t s = (*s_handle) ;
     bool ok = true ;
 
-    if (algo == GxB_COMPRESSION_NONE)
+    if (nblocks == 0)
+    { 
+        // the array is empty
+        ok = (X_len == 0) ;
+    }
+    else if (algo == GxB_COMPRESSION_NONE)
     {
 
         //----------------------------------------------------------------------
@@ -96,6 +146,11 @@ GrB_Info GB_deserialize_from_blob
             // blob is invalid: guard against an unsafe memcpy
             ok = false ;
         }
+        else if (reader != NULL)
+        { 
+            // read the array directly from the stream into X
+            ok = reader (stream, X, X_len) ;
+        }
         else
         { 
             // copy the blob into the array X.  This is now safe and secure.
@@ -111,46 +166,143 @@ GrB_Info GB_deserialize_from_blob
         // LZ4 / LZ4HC compression
         //----------------------------------------------------------------------
 
+        // The blocks are decompressed in batches.  If the array is held in
+        // the blob and is not delta encoded, all blocks are in a single
+        // batch.  Otherwise, each batch of nthreads blocks is read from the
+        // stream into the workspace W, and/or decompressed into the
+        // workspace D and then decoded.
+
+        // the blocks partition the bytes of X, or its entries if delta is true
+        int64_t n = (delta) ? (X_len / sizeof (int64_t)) : X_len ;
+        int64_t *restrict X64 = (int64_t *) X ;
+        if (delta && (X_len % sizeof (int64_t) != 0 || nblocks > n))
+        { 
+            // blob is invalid
+            ok = false ;
+        }
+
         int nthreads = GB_IMIN (nthreads_max, nblocks) ;
-        int32_t blockid ;
-        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
-            reduction(&&:ok)
-        for (blockid = 0 ; blockid < nblocks ; blockid++)
+        int32_t batchsize = (reader == NULL && !delta) ? nblocks : nthreads ;
+        for (int32_t first = 0 ; first < nblocks && ok ; first += batchsize)
         {
-            // get the start and end of the compressed and uncompressed blocks
-            int64_t kstart, kend ;
-            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
-            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
-            int64_t s_end   = Sblocks [blockid] ;
-            size_t  s_size  = s_end - s_start ;
-            size_t  d_size  = kend - kstart ;
-            // ensure s_start, s_end, kstart, and kend are all valid,
-            // to avoid accessing arrays out of bounds, if input is corrupted.
-            if (kstart < 0 || kend < 0 || s_start < 0 || s_end < 0 ||
-                kstart >= kend || s_start >= s_end || s_size > INT32_MAX ||
-                s + s_start > blob_size || s + s_end > blob_size ||
-                kstart > X_len || kend > X_len || d_size > INT32_MAX)
-            {
+
+            //------------------------------------------------------------------
+            // get the compressed blocks first:last-1 of this batch
+            //------------------------------------------------------------------
+
+            int32_t last = GB_IMIN (first + batchsize, nblocks) ;
+            int64_t s_first = (first == 0) ? 0 : Sblocks [first-1] ;
+            int64_t s_last  = Sblocks [last-1] ;
+            if (s_first < 0 || s_last <= s_first || s + s_last > blob_size)
+            { 
                 // blob is invalid
                 ok = false ;
+                break ;
             }
-            else
-            { 
-                // uncompress the compressed block of size s_size
-                // from blob [s + s_start:s_end-1] into X [kstart:kend-1].
-                // This is safe and secure so far.  The contents of X are
-                // not yet checked, however.  That step is done in
-                // GB_deserialize, if requested.
-                const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
-                int src_size = (int) s_size ;
-                int dst_size = (int) d_size ;
-                int u = LZ4_decompress_safe (src, dst, src_size, dst_size) ;
-                if (u != dst_size)
+
+            const GB_void *src_batch = blob + s + s_first ;
+            if (reader != NULL)
+            {
+                // read the batch from the stream into the workspace W
+                size_t w = (size_t) (s_last - s_first) ;
+                if (w > W_size)
+                { 
+                    GB_FREE_WORK (&W, W_size) ;
+                    W = GB_MALLOC_WORK (w, GB_void, &W_size) ;
+                    if (W == NULL)
+                    { 
+                        // out of memory
+                        GB_FREE_ALL ;
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                }
+                ok = reader (stream, W, w) ;
+                if (!ok) break ;
+                src_batch = W ;
+            }
+
+            int64_t k_first, k_last, ignore ;
+            GB_PARTITION (k_first, ignore, n, first, nblocks) ;
+            GB_PARTITION (ignore, k_last, n, last-1, nblocks) ;
+            if (delta)
+            {
+                // allocate space to decompress the encoded blocks of the batch
+                size_t d = GB_DELTA_BOUND (k_last - k_first) ;
+                if (d > D_size)
+                { 
+                    GB_FREE_WORK (&D, D_size) ;
+                    D = GB_MALLOC_WORK (d, uint8_t, &D_size) ;
+                    if (D == NULL)
+                    { 
+                        // out of memory
+                        GB_FREE_ALL ;
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // decompress the blocks of this batch in parallel
+            //------------------------------------------------------------------
+
+            int32_t blockid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+                reduction(&&:ok)
+            for (blockid = first ; blockid < last ; blockid++)
+            {
+                // get the start and end of the compressed and uncompressed
+                // blocks
+                int64_t kstart, kend ;
+                GB_PARTITION (kstart, kend, n, blockid, nblocks) ;
+                int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+                int64_t s_end   = Sblocks [blockid] ;
+                size_t  s_size  = s_end - s_start ;
+                size_t  d_size  = (delta) ? GB_DELTA_BOUND (kend - kstart) :
+                    (kend - kstart) ;
+                // ensure s_start, s_end, kstart, and kend are all valid,
+                // to avoid accessing arrays out of bounds, if input is
+                // corrupted.
+                if (kstart < 0 || kend < 0 || s_start < s_first ||
+                    s_end > s_last || kstart >= kend || s_start >= s_end ||
+                    s_size > INT32_MAX || kstart > n || kend > n ||
+                    d_size > INT32_MAX)
                 {
                     // blob is invalid
                     ok = false ;
                 }
+                else
+                { 
+                    // uncompress the compressed block of size s_size from
+                    // blob [s + s_start:s_end-1] (or from the workspace W)
+                    // into X [kstart:kend-1].  This is safe and secure so
+                    // far.  The contents of X are not yet checked, however.
+                    // That step is done in GB_deserialize, if requested.
+                    const char *src = (const char *)
+                        (src_batch + (s_start - s_first)) ;
+                    int src_size = (int) s_size ;
+                    int dst_size = (int) d_size ;
+                    if (delta)
+                    {
+                        // decompress the encoded block into D, then decode
+                        // it into X [kstart:kend-1]
+                        uint8_t *E = D + GB_DELTA_BOUND (kstart - k_first) ;
+                        int u = LZ4_decompress_safe (src, (char *) E,
+                            src_size, dst_size) ;
+                        ok = ok && (u > 0) && GB_delta_decode (X64 + kstart,
+                            kend - kstart, E, (size_t) u) ;
+                    }
+                    else
+                    {
+                        char *dst = (char *) (X + kstart) ;
+                        int u = LZ4_decompress_safe (src, dst, src_size,
+                            dst_size) ;
+                        if (u != dst_size)
+                        {
+                            // blob is invalid
+                            ok = false ;
+                        }
+                    }
+                }
             }
         }
     }
@@ -171,6 +323,8 @@ GrB_Info GB_deserialize_from_blob
     // return result: X, its size, and updated index into the blob
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORK (&W, W_size) ;
+    GB_FREE_WORK (&D, D_size) ;
     (*X_handle) = X ;
     (*X_size_handle) = X_size ;
     if (nblocks > 0)
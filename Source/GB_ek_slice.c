@@ -79,12 +79,37 @@ void GB_ek_slice            // slice a matrix
         return ;
     }
 
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    // GB_ek_slice is called at the start of most kernels, outside of any
+    // parallel region.  Each task takes O(log (anvec)) time to slice, so
+    // this is only worth doing in parallel if there are many thousands of
+    // tasks, which can occur with fine-grained tasking on many threads.
+
+    int nthreads = GB_nthreads (ntasks, GB_EK_SLICE_CHUNK,
+        GB_Global_context_nthreads_max_get ( )) ;
+
     //--------------------------------------------------------------------------
     // find the first and last entries in each slice
     //--------------------------------------------------------------------------
 
-    // FUTURE: this can be done in parallel if there are many tasks
-    GB_eslice (pstart_slice, anz, ntasks) ;
+    int taskid ;
+    if (nthreads == 1)
+    { 
+        GB_eslice (pstart_slice, anz, ntasks) ;
+    }
+    else
+    { 
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (taskid = 1 ; taskid < ntasks ; taskid++)
+        { 
+            pstart_slice [taskid] = (int64_t) GB_PART (taskid, anz, ntasks) ;
+        }
+        pstart_slice [0] = 0 ;
+        pstart_slice [ntasks] = anz ;
+    }
 
     //--------------------------------------------------------------------------
     // find the first and last vectors in each slice
@@ -98,8 +123,10 @@ void GB_ek_slice            // slice a matrix
     // pstart_slice [taskid+1]-1 is in the range Ap [k]...A[k+1]-1, and this
     // is vector is k = klast_slice [taskid].
 
-    // FUTURE: this can be done in parallel if there are many tasks
-    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    // Each search is independent of all the others.
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
     { 
         GB_ek_slice_search (taskid, ntasks, pstart_slice, Ap, anvec, avlen,
             kfirst_slice, klast_slice) ;
@@ -77,6 +77,15 @@ static inline void GB_ek_slice_ntasks
     const int64_t *klast_  ## X ## slice = X ## _ek_slicing + X ## _ntasks ;  \
     const int64_t *pstart_ ## X ## slice = X ## _ek_slicing + X ## _ntasks*2 ;
 
+//------------------------------------------------------------------------------
+// GB_EK_SLICE_CHUNK: # of tasks each thread slices in GB_ek_slice
+//------------------------------------------------------------------------------
+
+// GB_ek_slice uses a single thread unless there are at least
+// 2*GB_EK_SLICE_CHUNK tasks.
+
+#define GB_EK_SLICE_CHUNK 4096
+
 //------------------------------------------------------------------------------
 // GB_ek_slice prototypes
 //------------------------------------------------------------------------------
@@ -339,9 +339,30 @@ GrB_Info GB_emult           // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
     GB_MATRIX_WAIT (A) ;
     GB_MATRIX_WAIT (B) ;
 
+    //--------------------------------------------------------------------------
+    // exploit the M==A and M==B aliases
+    //--------------------------------------------------------------------------
+
+    // If the structural mask M has the same pattern as A or B, as in
+    // C<A,struct>=A.*B, then the pattern of A.*B is already a subset of the
+    // pattern of M.  The mask has no effect and need not be merged with A and
+    // B, but it is reported as having been applied, so that GB_accum_mask
+    // does not apply it again.  Method9 and Method10 require the mask, since
+    // one of A or B is bitmap or full.
+
+    bool mask_redundant = false ;
+    if (ewise_method == GB_EMULT_METHOD8 && apply_mask && Mask_struct &&
+        !Mask_comp &&
+        (GB_same_pattern (M, A) || GB_same_pattern (M, B)))
+    {
+        GBURBLE ("(mask aliased) ") ;
+        apply_mask = false ;
+        mask_redundant = true ;
+    }
+
     GBURBLE ("emult:(%s<%s>=%s.*%s) ",
         GB_sparsity_char (C_sparsity),
-        GB_sparsity_char_matrix (M),
+        GB_sparsity_char_matrix ((apply_mask) ? M : NULL),
         GB_sparsity_char_matrix (A),
         GB_sparsity_char_matrix (B)) ;
 
@@ -421,7 +442,7 @@ GrB_Info GB_emult           // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
 
     GB_FREE_WORKSPACE ;
     ASSERT_MATRIX_OK (C, "C output for emult phased", GB0) ;
-    (*mask_applied) = apply_mask ;
+    (*mask_applied) = apply_mask || mask_redundant ;
     return (GrB_SUCCESS) ;
 }
 
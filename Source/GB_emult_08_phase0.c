@@ -34,7 +34,10 @@
 //      If j does not appear in M, then C_to_M [k] = -1.  Otherwise, C_to_M is
 //      returned as NULL.  C is always hypersparse in this case.
 
-// FUTURE:: exploit A==M, B==M, and A==B aliases
+// If A and B have the same hyperlist (A==B, or both aliased to the same Ah),
+// then Ch is Ah and neither C_to_A nor C_to_B is constructed.  GB_emult drops
+// a structural mask M that has the same pattern as A or B, and the A==B case
+// is exploited by Method8(e) in GB_emult_08_template.
 
 #include "GB_emult.h"
 
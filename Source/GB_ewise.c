@@ -332,6 +332,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
             // C_replace is ignored
             GBURBLE ("dense C+=A+B ") ;
+            GB_OK (GB_unshallow (C, Context)) ;
             GB_dense_ewise3_accum (C, A1, B1, op, Context) ;    // cannot fail
             GB_FREE_ALL ;
             ASSERT_MATRIX_OK (C, "C output for GB_ewise, dense C+=A+B", GB0) ;
@@ -347,6 +348,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
             // C_replace is ignored
             GBURBLE ("dense C=A+B ") ;
+            GB_OK (GB_unshallow (C, Context)) ;
             info = GB_dense_ewise3_noaccum (C, C_as_if_full, A1, B1, op,
                 Context) ;
             GB_FREE_ALL ;
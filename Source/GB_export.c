@@ -109,6 +109,9 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    // the content of A is given to the user, so A must own all of its content
+    GB_OK (GB_unshallow (*A, Context)) ;
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
@@ -158,6 +161,24 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         }
     }
 
+    //--------------------------------------------------------------------------
+    // move any arrays spilled to files back into memory
+    //--------------------------------------------------------------------------
+
+    // The user application frees the exported arrays with its own free
+    // function, so they cannot be left in memory-mapped files.
+
+    if (!GB_spill_unspill ((void **) &((*A)->p), (*A)->p_size) ||
+        !GB_spill_unspill ((void **) &((*A)->h), (*A)->h_size) ||
+        !GB_spill_unspill ((void **) &((*A)->b), (*A)->b_size) ||
+        !GB_spill_unspill ((void **) &((*A)->i), (*A)->i_size) ||
+        !GB_spill_unspill ((void **) &((*A)->x), (*A)->x_size))
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
     //--------------------------------------------------------------------------
     // export the matrix
     //--------------------------------------------------------------------------
@@ -95,5 +95,36 @@ GrB_Info GB_export      // export/unpack a matrix in any format
     GB_Context Context
 ) ;
 
+GrB_Info GB_import32        // pack a CSR or CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,           // matrix to pack (type, nrows, ncols unchanged)
+    uint32_t **Ap,          // pointers, of size at least vdim+1
+    GrB_Index Ap_size,      // size of Ap in bytes
+    uint32_t **Ai,          // indices, of size at least Ap [vdim]
+    GrB_Index Ai_size,      // size of Ai in bytes
+    void **Ax,              // values
+    GrB_Index Ax_size,      // size of Ax in bytes
+    bool iso,               // if true, A is iso
+    bool jumbled,           // if true, indices in each vector may be unsorted
+    bool is_csc,            // if true, A is packed by column, else by row
+    bool fast_import,       // if true: trust the data, if false: check it
+    GB_Context Context
+) ;
+
+GrB_Info GB_export32        // unpack a CSR or CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,           // matrix to unpack (type, nrows, ncols unchanged)
+    uint32_t **Ap,          // pointers
+    GrB_Index *Ap_size,     // size of Ap in bytes
+    uint32_t **Ai,          // indices
+    GrB_Index *Ai_size,     // size of Ai in bytes
+    void **Ax,              // values
+    GrB_Index *Ax_size,     // size of Ax in bytes
+    bool *iso,              // if true, A is iso
+    bool *jumbled,          // if true, indices in each vector may be unsorted
+    bool is_csc,            // if true, A is unpacked by column, else by row
+    GB_Context Context
+) ;
+
 #endif
 
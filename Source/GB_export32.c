@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+// GB_export32: unpack a CSR or CSC matrix with 32-bit indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_unpack_CSR32, GxB_Matrix_unpack_CSC32
+// CALLS:     GB_export
+
+// The matrix is converted to sparse, by row or by column as requested, and
+// its pointers and indices are narrowed in parallel into new 32-bit arrays.
+// It is then unpacked with GB_export, and the 64-bit arrays are freed.  The
+// values Ax are unpacked as-is, with no copy.  The method fails with
+// GrB_INVALID_VALUE, and A is not unpacked, if the pointers or indices do not
+// fit in 32 bits.
+
+#include "GB_export.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Ap32, Ap32_size) ;        \
+    GB_FREE (&Ai32, Ai32_size) ;        \
+}
+
+GrB_Info GB_export32        // unpack a CSR or CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,           // matrix to unpack (type, nrows, ncols unchanged)
+    uint32_t **Ap,          // pointers
+    GrB_Index *Ap_size,     // size of Ap in bytes
+    uint32_t **Ai,          // indices
+    GrB_Index *Ai_size,     // size of Ai in bytes
+    void **Ax,              // values
+    GrB_Index *Ax_size,     // size of Ax in bytes
+    bool *iso,              // if true, A is iso
+    bool *jumbled,          // if true, indices in each vector may be unsorted
+    bool is_csc,            // if true, A is unpacked by column, else by row
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    uint32_t *Ap32 = NULL ; size_t Ap32_size = 0 ;
+    uint32_t *Ai32 = NULL ; size_t Ai32_size = 0 ;
+    ASSERT_MATRIX_OK (A, "A to unpack with 32-bit indices", GB0) ;
+    GB_RETURN_IF_NULL (Ap) ;
+    GB_RETURN_IF_NULL (Ap_size) ;
+    GB_RETURN_IF_NULL (Ai) ;
+    GB_RETURN_IF_NULL (Ai_size) ;
+    GB_RETURN_IF_NULL (Ax) ;
+    GB_RETURN_IF_NULL (Ax_size) ;
+
+    // each index must be less than the vector length
+    int64_t vlen = (is_csc) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    if (vlen > ((int64_t) UINT32_MAX) + 1)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Matrix dimension " GBd " is too large "
+            "for 32-bit indices", vlen) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure the matrix is sparse, in the requested format
+    //--------------------------------------------------------------------------
+
+    if (A->is_csc != is_csc)
+    { 
+        // A = A', done in-place, to put A in the requested format
+        GBURBLE ("(transpose) ") ;
+        GB_OK (GB_transpose_in_place (A, is_csc, Context)) ;
+    }
+
+    if (jumbled == NULL)
+    { 
+        // the unpacked matrix cannot be jumbled
+        GB_MATRIX_WAIT (A) ;
+    }
+    else
+    { 
+        // the unpacked matrix is allowed to be jumbled
+        GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    }
+
+    GB_OK (GB_convert_any_to_sparse (A, Context)) ;
+    ASSERT (GB_IS_SPARSE (A)) ;
+    ASSERT (A->is_csc == is_csc) ;
+
+    int64_t vdim = A->vdim ;
+    int64_t nvals = GB_nnz (A) ;
+    if (nvals > (int64_t) UINT32_MAX)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Matrix with " GBd " entries is too "
+            "large for 32-bit indices", nvals) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // narrow A->p and A->i in parallel into the 32-bit arrays
+    //--------------------------------------------------------------------------
+
+    Ap32 = GB_MALLOC (vdim+1, uint32_t, &Ap32_size) ;
+    Ai32 = GB_MALLOC (GB_IMAX (nvals, 1), uint32_t, &Ai32_size) ;
+    // Ap32 and Ai32 are given to the user application, so they cannot be left
+    // in memory-mapped files
+    if (Ap32 == NULL || Ai32 == NULL ||
+        !GB_spill_unspill ((void **) &Ap32, Ap32_size) ||
+        !GB_spill_unspill ((void **) &Ai32, Ai32_size))
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    const int64_t *restrict Ap64 = A->p ;
+    const int64_t *restrict Ai64 = A->i ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (vdim + 1 + nvals, chunk, nthreads_max) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= vdim ; k++)
+    { 
+        Ap32 [k] = (uint32_t) Ap64 [k] ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nvals ; k++)
+    { 
+        Ai32 [k] = (uint32_t) Ai64 [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the matrix, and free its 64-bit arrays
+    //--------------------------------------------------------------------------
+
+    GrB_Type type ;
+    GrB_Index vlen2, vdim2 ;
+    GrB_Index *Ap64_export = NULL, Ap64_size = 0 ;
+    GrB_Index *Ai64_export = NULL, Ai64_size = 0 ;
+    GB_OK (GB_export (true, &A, &type, &vlen2, &vdim2, false,
+        &Ap64_export, &Ap64_size,       // Ap
+        NULL, NULL,                     // Ah
+        NULL, NULL,                     // Ab
+        &Ai64_export, &Ai64_size,       // Ai
+        Ax,   Ax_size,                  // Ax
+        NULL, jumbled, NULL,            // jumbled or not
+        NULL, NULL,                     // sparse by row or by column
+        iso, Context)) ;
+
+    // GB_export has removed the 64-bit arrays from the debug memtable
+    GB_Global_memtable_add (Ap64_export, Ap64_size) ;
+    GB_FREE (&Ap64_export, Ap64_size) ;
+    GB_Global_memtable_add (Ai64_export, Ai64_size) ;
+    GB_FREE (&Ai64_export, Ai64_size) ;
+
+    //--------------------------------------------------------------------------
+    // return the 32-bit arrays to the user
+    //--------------------------------------------------------------------------
+
+    GB_Global_memtable_remove (Ap32) ;
+    GB_Global_memtable_remove (Ai32) ;
+    (*Ap) = Ap32 ; (*Ap_size) = Ap32_size ;
+    (*Ai) = Ai32 ; (*Ai_size) = Ai32_size ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -18,13 +18,11 @@
 
 // Tf A is iso and X is not NULL, the iso scalar Ax [0] is expanded into X.
 
-#include "GB.h"
+// If A is bitmap, GB_extractTuples_ordered extracts the tuples and typecasts
+// them in a single pass, with no workspace of size nnz(A).
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK (&Ap, Ap_size) ;               \
-    GB_FREE_WORK (&X_bitmap, X_bitmap_size) ;   \
-}
+#include "GB.h"
+#define GB_FREE_ALL ;
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
 (
@@ -43,8 +41,6 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    GB_void *restrict X_bitmap = NULL ; size_t X_bitmap_size = 0 ;
-    int64_t *restrict Ap       = NULL ; size_t Ap_size = 0 ;
 
     ASSERT_MATRIX_OK (A, "A to extract", GB0) ;
     ASSERT (p_nvals != NULL) ;
@@ -107,52 +103,15 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     //--------------------------------------------------------------------------
 
     if (GB_IS_BITMAP (A))
-    {
-
-        //----------------------------------------------------------------------
-        // allocate workspace
-        //----------------------------------------------------------------------
-
-        bool need_typecast = (X != NULL) && (xcode != acode) ;
-        if (need_typecast)
-        { 
-            // X must be typecasted
-            int64_t anzmax = GB_IMAX (anz, 1) ;
-            X_bitmap = GB_MALLOC_WORK (anzmax*asize, GB_void, &X_bitmap_size) ;
-        }
-        Ap = GB_MALLOC_WORK (A->vdim+1, int64_t, &Ap_size) ;
-        if (Ap == NULL || (need_typecast && X_bitmap == NULL))
-        { 
-            // out of memory
-            GB_FREE_ALL ;
-            return (GrB_OUT_OF_MEMORY) ;
-        }
-
-        //----------------------------------------------------------------------
-        // extract the tuples
-        //----------------------------------------------------------------------
-
-        // TODO: pass xcode to GB_convert_bitmap_worker and let it do the
-        // typecasting.  This works for now, however.
-
-        // if A is iso, GB_convert_bitmap_worker expands the iso scalar
-        // into its result, X or X_bitmap
-
-        GB_OK (GB_convert_bitmap_worker (Ap, (int64_t *) I, (int64_t *) J,
-            (GB_void *) (need_typecast ? X_bitmap : X), NULL, A, Context)) ;
+    { 
 
         //----------------------------------------------------------------------
-        // typecast X if needed
+        // extract the tuples and typecast them in a single pass
         //----------------------------------------------------------------------
 
-        if (need_typecast)
-        { 
-            // typecast the values from X_bitmap into X
-            ASSERT (X != NULL) ;
-            ASSERT (xcode != acode) ;
-            GB_cast_array ((GB_void *) X, xcode, X_bitmap, acode, NULL, anz,
-                nthreads) ;
-        }
+        // if A is iso, GB_extractTuples_ordered expands the iso scalar into X
+        GB_OK (GB_extractTuples_ordered (I_out, J_out, X, p_nvals, xcode,
+            GxB_NO_FORMAT, A, Context)) ;
 
     }
     else
@@ -224,11 +183,10 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     }
 
     //--------------------------------------------------------------------------
-    // free workspace and return result 
+    // return result
     //--------------------------------------------------------------------------
 
     *p_nvals = anz ;            // number of tuples extracted
-    GB_FREE_ALL ;
     return (GrB_SUCCESS) ;
 }
 
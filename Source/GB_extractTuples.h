@@ -30,5 +30,17 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     GB_Context Context
 ) ;
 
+GrB_Info GB_extractTuples_ordered   // extract all tuples, in a given order
+(
+    GrB_Index *I_out,           // array for returning row indices of tuples
+    GrB_Index *J_out,           // array for returning col indices of tuples
+    void *X,                    // array for returning values of tuples
+    GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
+    const GB_Type_code xcode,   // type of array X
+    const int order,            // GxB_BY_ROW, GxB_BY_COL, or GxB_NO_FORMAT
+    const GrB_Matrix A,         // matrix to extract tuples from
+    GB_Context Context
+) ;
+
 #endif
 
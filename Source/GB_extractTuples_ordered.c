@@ -0,0 +1,508 @@
+//------------------------------------------------------------------------------
+// GB_extractTuples_ordered: extract all tuples from a matrix, in a given order
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// [I,J,X] = find (A), with the tuples returned in row-major order (sorted by
+// row index and then by column index) if order is GxB_BY_ROW, or in
+// column-major order if order is GxB_BY_COL, regardless of the CSR/CSC format
+// of A.  If order is GxB_NO_FORMAT, the tuples are returned in the order they
+// are held in A, which may be jumbled.  Any of I, J, and X may be NULL.
+
+// The tuples are written in a single parallel pass directly into I, J, and X,
+// and the values are typecasted from A->type into xcode as they are written.
+// No workspace of size nnz(A) is needed, except for the rare case described
+// below.  If A is iso, its iso value is expanded into X.
+
+// If the tuples are returned in the same order they are held in A, each task
+// writes its own slice of I, J, and X.  If A is bitmap, the size of each slice
+// is found first, by counting the entries in each slice of A->b.  Otherwise,
+// the tuples are returned in the transposed order.  A bitmap or full matrix
+// is then traversed in that order directly.  For a sparse or hypersparse
+// matrix, the non-atomic bucket method of GB_transpose_bucket is used: each
+// task counts the entries in each row of its slice of A, and then each task
+// writes its entries directly into their final positions.  If
+// GB_transpose_method selects the GB_builder method instead (if A is very
+// sparse or hypersparse), the tuples are sorted with GB_msort_3.
+
+#include "GB_ek_slice.h"
+#include "GB_transpose.h"
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&W, W_size) ;             \
+    GB_WERK_POP (T_slice, int64_t) ;        \
+    GB_WERK_POP (A_ek_slicing, int64_t) ;   \
+}
+
+GrB_Info GB_extractTuples_ordered   // extract all tuples, in a given order
+(
+    GrB_Index *I_out,           // array for returning row indices of tuples
+    GrB_Index *J_out,           // array for returning col indices of tuples
+    void *X,                    // array for returning values of tuples
+    GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
+    const GB_Type_code xcode,   // type of array X
+    const int order,            // GxB_BY_ROW, GxB_BY_COL, or GxB_NO_FORMAT
+    const GrB_Matrix A,         // matrix to extract tuples from
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict W = NULL ; size_t W_size = 0 ;
+    GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+    GB_WERK_DECLARE (T_slice, int64_t) ;
+
+    ASSERT_MATRIX_OK (A, "A to extract in order", GB0) ;
+    ASSERT (p_nvals != NULL) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+    ASSERT (order == GxB_BY_ROW || order == GxB_BY_COL ||
+            order == GxB_NO_FORMAT) ;
+
+    // if A is a single vector, its tuples are in the requested order as held
+    bool transposed = (order != GxB_NO_FORMAT) &&
+        ((order == GxB_BY_COL) != A->is_csc) && (A->vdim > 1) ;
+
+    // delete any lingering zombies and assemble any pending tuples.  A may
+    // remain jumbled if its vectors are transposed, or if the order is not
+    // specified.
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    if (order != GxB_NO_FORMAT && !transposed)
+    {
+        GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+    }
+
+    GB_BURBLE_DENSE (A, "(A %s) ") ;
+    const GB_Type_code acode = A->type->code ;
+    const size_t asize = A->type->size ;
+    const size_t xsize = GB_code_size (xcode, asize) ;
+
+    // xcode and A must be compatible
+    if (!GB_code_compatible (xcode, acode))
+    {
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    const int64_t anz = GB_nnz (A) ;
+    if (anz == 0)
+    {
+        // no work to do
+        (*p_nvals) = 0 ;
+        return (GrB_SUCCESS) ;
+    }
+
+    int64_t nvals = *p_nvals ;          // size of I,J,X on input
+    if (nvals < anz && (I_out != NULL || J_out != NULL || X != NULL))
+    {
+        // output arrays are not big enough
+        return (GrB_INSUFFICIENT_SPACE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    const bool A_iso = A->iso ;
+
+    //--------------------------------------------------------------------------
+    // handle the CSR/CSC format
+    //--------------------------------------------------------------------------
+
+    // I holds the indices within each vector of A, and J the vector indices
+
+    GrB_Index *restrict I, *restrict J ;
+    if (A->is_csc)
+    {
+        I = I_out ;
+        J = J_out ;
+    }
+    else
+    {
+        I = J_out ;
+        J = I_out ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the typecast function and the iso value
+    //--------------------------------------------------------------------------
+
+    GB_void *restrict Xout = (GB_void *) X ;
+    GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+    GB_void xiso [GB_VLA(xsize)] ;
+    if (A_iso)
+    {
+        GB_cast_scalar (xiso, xcode, A->x, acode, asize) ;
+    }
+
+    // X [q] = (xtype) A(pA), or the iso value of A
+    #define GB_COPY_X(q,pA)                                                 \
+    {                                                                       \
+        if (A_iso)                                                          \
+        {                                                                   \
+            memcpy (Xout + (q)*xsize, xiso, xsize) ;                        \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            cast_A_to_X (Xout + (q)*xsize, Ax + (pA)*asize, asize) ;        \
+        }                                                                   \
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + A->nvec, chunk, nthreads_max) ;
+
+    if (GB_IS_BITMAP (A) || GB_IS_FULL (A))
+    {
+
+        //======================================================================
+        // bitmap or full case
+        //======================================================================
+
+        // The entries are traversed in the output order, as the vlen-by-vdim
+        // matrix A (in its native order) or the vdim-by-vlen matrix A' (in the
+        // transposed order).  The position q in the output order is the
+        // entry A(i,j) in the outer vector o and inner index n, where (i,j) is
+        // (n,o) for the native order, or (o,n) for the transposed order.
+
+        const int64_t nouter = transposed ? avlen : avdim ;
+        const int64_t ninner = transposed ? avdim : avlen ;
+        const int64_t ostride = transposed ? 1 : avlen ;
+        const int64_t nstride = transposed ? avlen : 1 ;
+        const int64_t anz_held = GB_nnz_held (A) ;
+        const bool A_is_bitmap = (Ab != NULL) ;
+        int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+        ntasks = (int) GB_IMIN (ntasks, anz_held) ;
+        ntasks = GB_IMAX (ntasks, 1) ;
+
+        //----------------------------------------------------------------------
+        // count the entries in each slice, if A is bitmap
+        //----------------------------------------------------------------------
+
+        // T_slice [tid] is the position in the output of the first entry in
+        // the tid-th slice of the output, of positions qstart to qend-1.
+
+        GB_WERK_PUSH (T_slice, ntasks+1, int64_t) ;
+        if (T_slice == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int tid ;
+        if (A_is_bitmap)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t qstart, qend, count = 0 ;
+                GB_PARTITION (qstart, qend, anz_held, tid, ntasks) ;
+                int64_t o = qstart / ninner ;
+                int64_t n = qstart % ninner ;
+                for (int64_t q = qstart ; q < qend ; q++)
+                {
+                    count += Ab [o*ostride + n*nstride] ;
+                    if (++n == ninner) { n = 0 ; o++ ; }
+                }
+                T_slice [tid] = count ;
+            }
+            GB_cumsum (T_slice, ntasks, NULL, 1, Context) ;
+        }
+        else
+        {
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t qstart, qend ;
+                GB_PARTITION (qstart, qend, anz_held, tid, ntasks) ;
+                T_slice [tid] = qstart ;
+            }
+            T_slice [ntasks] = anz_held ;
+        }
+        ASSERT (T_slice [ntasks] == anz) ;
+
+        //----------------------------------------------------------------------
+        // extract the tuples
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t qstart, qend ;
+            GB_PARTITION (qstart, qend, anz_held, tid, ntasks) ;
+            int64_t o = qstart / ninner ;
+            int64_t n = qstart % ninner ;
+            int64_t pX = T_slice [tid] ;
+            for (int64_t q = qstart ; q < qend ; q++)
+            {
+                int64_t pA = o*ostride + n*nstride ;
+                if (!A_is_bitmap || Ab [pA])
+                {
+                    int64_t i = transposed ? o : n ;
+                    int64_t j = transposed ? n : o ;
+                    if (I != NULL) I [pX] = i ;
+                    if (J != NULL) J [pX] = j ;
+                    if (Xout != NULL) GB_COPY_X (pX, pA) ;
+                    pX++ ;
+                }
+                if (++n == ninner) { n = 0 ; o++ ; }
+            }
+        }
+
+    }
+    else if (!transposed)
+    {
+
+        //======================================================================
+        // sparse or hypersparse case, in the order A is held
+        //======================================================================
+
+        int A_ntasks, A_nthreads ;
+        GB_SLICE_MATRIX (A, 2, chunk) ;
+
+        int tid ;
+        #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < A_ntasks ; tid++)
+        {
+
+            //------------------------------------------------------------------
+            // extract the indices of the entries in this slice
+            //------------------------------------------------------------------
+
+            int64_t kfirst = kfirst_Aslice [tid] ;
+            int64_t klast  = klast_Aslice  [tid] ;
+            for (int64_t k = kfirst ; k <= klast ; k++)
+            {
+                int64_t j = GBH (Ah, k) ;
+                int64_t pA_start, pA_end ;
+                GB_get_pA (&pA_start, &pA_end, tid, k,
+                    kfirst, klast, pstart_Aslice, Ap, avlen) ;
+                for (int64_t p = pA_start ; p < pA_end ; p++)
+                {
+                    if (I != NULL) I [p] = Ai [p] ;
+                    if (J != NULL) J [p] = j ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // copy and typecast the values of the entries in this slice
+            //------------------------------------------------------------------
+
+            int64_t pstart = pstart_Aslice [tid] ;
+            int64_t n = pstart_Aslice [tid+1] - pstart ;
+            if (Xout == NULL || n <= 0)
+            {
+                // nothing to do
+            }
+            else if (A_iso)
+            {
+                for (int64_t p = pstart ; p < pstart + n ; p++)
+                {
+                    memcpy (Xout + p*xsize, xiso, xsize) ;
+                }
+            }
+            else if (xcode == acode)
+            {
+                memcpy (Xout + pstart*xsize, Ax + pstart*asize, n*asize) ;
+            }
+            else
+            {
+                GB_cast_array (Xout + pstart*xsize, xcode,
+                    (GB_void *) (Ax + pstart*asize), acode, NULL, n, 1) ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //======================================================================
+        // sparse or hypersparse case, in the transposed order
+        //======================================================================
+
+        int nworkspaces_bucket, nthreads_bucket ;
+        bool use_builder = GB_transpose_method (A,
+            &nworkspaces_bucket, &nthreads_bucket, Context) ;
+
+        if (use_builder)
+        {
+
+            //------------------------------------------------------------------
+            // sort the tuples
+            //------------------------------------------------------------------
+
+            // W holds three arrays of size anz: the indices, vector indices,
+            // and positions in A of each entry.  They are sorted by index and
+            // then by vector index.
+
+            W = GB_MALLOC_WORK (3*anz, int64_t, &W_size) ;
+            if (W == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            int64_t *restrict W_i = W ;
+            int64_t *restrict W_j = W + anz ;
+            int64_t *restrict W_p = W + 2*anz ;
+
+            int A_ntasks, A_nthreads ;
+            GB_SLICE_MATRIX (A, 2, chunk) ;
+
+            int tid ;
+            #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+            for (tid = 0 ; tid < A_ntasks ; tid++)
+            {
+                int64_t kfirst = kfirst_Aslice [tid] ;
+                int64_t klast  = klast_Aslice  [tid] ;
+                for (int64_t k = kfirst ; k <= klast ; k++)
+                {
+                    int64_t j = GBH (Ah, k) ;
+                    int64_t pA_start, pA_end ;
+                    GB_get_pA (&pA_start, &pA_end, tid, k,
+                        kfirst, klast, pstart_Aslice, Ap, avlen) ;
+                    for (int64_t p = pA_start ; p < pA_end ; p++)
+                    {
+                        W_i [p] = Ai [p] ;
+                        W_j [p] = j ;
+                        W_p [p] = p ;
+                    }
+                }
+            }
+
+            GB_OK (GB_msort_3 (W_i, W_j, W_p, anz, nthreads)) ;
+
+            int64_t q ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (q = 0 ; q < anz ; q++)
+            {
+                if (I != NULL) I [q] = W_i [q] ;
+                if (J != NULL) J [q] = W_j [q] ;
+                if (Xout != NULL) GB_COPY_X (q, W_p [q]) ;
+            }
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // bucket method
+            //------------------------------------------------------------------
+
+            // Each task owns a contiguous set of vectors of A, and a workspace
+            // W [tid*(avlen+1) ...] of size avlen+1.  The number of tasks is
+            // limited so that the total workspace is not more than O(anz).
+            // The entries in each row of A' are written in increasing order
+            // of their vector index, since the tasks handle the vectors of A
+            // in order.  This does not depend on A being unjumbled.
+
+            int ntasks = nthreads_bucket ;
+            ntasks = (int) GB_IMIN (ntasks, anz / GB_IMAX (avlen, 1)) ;
+            ntasks = (int) GB_IMIN (ntasks, A->nvec) ;
+            ntasks = GB_IMAX (ntasks, 1) ;
+            int nth = GB_nthreads (avlen * ntasks, chunk, nthreads_max) ;
+
+            GB_WERK_PUSH (T_slice, ntasks+1, int64_t) ;
+            W = GB_MALLOC_WORK ((ntasks+1) * (avlen+1), int64_t, &W_size) ;
+            if (T_slice == NULL || W == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_pslice (T_slice, Ap, A->nvec, ntasks, true) ;
+            GB_memset (W, 0, (ntasks+1) * (avlen+1) * sizeof (int64_t), nth) ;
+
+            // Wp = W [ntasks*(avlen+1) ...] will hold the row pointers of A'
+            int64_t *restrict Wp = W + ntasks * (avlen+1) ;
+
+            //------------------------------------------------------------------
+            // phase1: each task counts the entries in each row of its slice
+            //------------------------------------------------------------------
+
+            int tid ;
+            #pragma omp parallel for num_threads(ntasks) schedule(static)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t *restrict Wt = W + tid * (avlen+1) ;
+                int64_t pA_start = Ap [T_slice [tid]] ;
+                int64_t pA_end   = Ap [T_slice [tid+1]] ;
+                for (int64_t p = pA_start ; p < pA_end ; p++)
+                {
+                    Wt [Ai [p]]++ ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // cumulative sum of the counts
+            //------------------------------------------------------------------
+
+            // Wp [i] = # of entries in the ith row of A, and Wt [i] becomes
+            // the offset of the first entry of task tid within that row
+
+            int64_t i ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (i = 0 ; i < avlen ; i++)
+            {
+                int64_t s = 0 ;
+                for (int t = 0 ; t < ntasks ; t++)
+                {
+                    int64_t *restrict Wt = W + t * (avlen+1) ;
+                    int64_t c = Wt [i] ;
+                    Wt [i] = s ;
+                    s += c ;
+                }
+                Wp [i] = s ;
+            }
+            GB_cumsum (Wp, avlen, NULL, nth, Context) ;
+
+            //------------------------------------------------------------------
+            // phase2: each task writes its entries in their final positions
+            //------------------------------------------------------------------
+
+            #pragma omp parallel for num_threads(ntasks) schedule(static)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t *restrict Wt = W + tid * (avlen+1) ;
+                for (int64_t k = T_slice [tid] ; k < T_slice [tid+1] ; k++)
+                {
+                    int64_t j = GBH (Ah, k) ;
+                    for (int64_t p = Ap [k] ; p < Ap [k+1] ; p++)
+                    {
+                        int64_t i = Ai [p] ;
+                        int64_t q = Wp [i] + Wt [i]++ ;
+                        if (I != NULL) I [q] = i ;
+                        if (J != NULL) J [q] = j ;
+                        if (Xout != NULL) GB_COPY_X (q, p) ;
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*p_nvals) = anz ;          // number of tuples extracted
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
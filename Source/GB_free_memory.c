@@ -11,6 +11,7 @@
 
 // The memory is freed using the free() function pointer passed in to GrB_init,
 // which is typically the ANSI C free function.  The free_pool is bypassed.
+// A block spilled to a file is unmapped instead, which deletes its file.
 
 #include "GB.h"
 
@@ -30,7 +31,11 @@ void GB_free_memory         // free memory, bypassing the free_pool
         #ifdef GB_MEMDUMP
         printf ("\nhard free %p %ld\n", *p, size_allocated) ;
         #endif
-        GB_Global_free_function (*p) ;
+        if (!GB_spill_free (*p))
+        { 
+            // *p is not spilled to a file, so free it
+            GB_Global_free_function (*p) ;
+        }
         #ifdef GB_MEMDUMP
         GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
         #endif
@@ -16,6 +16,9 @@ void GB_free_pool_finalize (void)
     // free all memory pools
     //--------------------------------------------------------------------------
 
+    // move the blocks cached in the shards of all threads to the shared pool
+    GB_Global_free_pool_flush ( ) ;
+
     for (int k = 3 ; k < 64 ; k++)
     {
         size_t size = (((size_t) 1) << k) ;
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_huge_page: back large blocks of memory with transparent huge pages
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_huge_page_advise asks the operating system to back a newly allocated
+// block with transparent huge pages of GB_HUGE_PAGE_SIZE bytes (madvise with
+// MADV_HUGEPAGE, Linux only), so that kernels that access a large array at
+// random (the Gustavson and bitmap saxpy3 methods, for example) take fewer
+// TLB misses.  Only the huge pages entirely inside the block are advised.
+// This is done before the block is first touched, so the pages are allocated
+// as huge pages from the start.  With the ANSI C malloc, these blocks are
+// also aligned on a huge page boundary (see GB_Global_malloc_function), so
+// all of the block except its last partial huge page is advised.
+
+// Explicit hugetlbfs mappings (mmap with MAP_HUGETLB) are not used, since the
+// pages must be reserved by the system administrator and the block could not
+// then be freed with the free function given to GxB_init.
+
+#include "GB.h"
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#endif
+
+#if defined ( __linux__ ) && defined ( MADV_HUGEPAGE )
+#define GB_HAS_MADV_HUGEPAGE 1
+#else
+#define GB_HAS_MADV_HUGEPAGE 0
+#endif
+
+//------------------------------------------------------------------------------
+// GB_huge_page_supported: return true if huge pages can be requested
+//------------------------------------------------------------------------------
+
+bool GB_huge_page_supported (void)
+{
+    return (GB_HAS_MADV_HUGEPAGE) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_huge_page_advise: advise the use of huge pages for a block
+//------------------------------------------------------------------------------
+
+void GB_huge_page_advise
+(
+    void *p,                // block to advise
+    size_t size             // size of the block, in bytes
+)
+{
+    #if GB_HAS_MADV_HUGEPAGE
+    size_t pstart = (size_t) p ;
+    size_t pend = pstart + size ;
+    pstart = ((pstart + GB_HUGE_PAGE_SIZE - 1) / GB_HUGE_PAGE_SIZE) ;
+    pstart *= GB_HUGE_PAGE_SIZE ;
+    pend = (pend / GB_HUGE_PAGE_SIZE) * GB_HUGE_PAGE_SIZE ;
+    if (pstart < pend)
+    { 
+        // failure is not an error; the block uses normal pages instead
+        (void) madvise ((void *) pstart, pend - pstart, MADV_HUGEPAGE) ;
+    }
+    #endif
+}
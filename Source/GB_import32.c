@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+// GB_import32: pack a CSR or CSC matrix with 32-bit indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_pack_CSR32, GxB_Matrix_pack_CSC32
+// CALLS:     GB_import
+
+// The 32-bit arrays Ap and Ai are widened in parallel into new 64-bit arrays,
+// which are then packed into A by GB_import, along with Ax (which is packed
+// as-is, with no copy).  If successful, Ap and Ai are freed and returned as
+// NULL, just as GB_import does with the 64-bit arrays it takes over.  If the
+// method fails, Ap and Ai are not modified, and remain owned by the caller.
+// Otherwise, failures are handled just as GB_import does.
+
+#include "GB_export.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Ap64, Ap64_size) ;        \
+    GB_FREE (&Ai64, Ai64_size) ;        \
+}
+
+GrB_Info GB_import32        // pack a CSR or CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,           // matrix to pack (type, nrows, ncols unchanged)
+    uint32_t **Ap,          // pointers, of size at least vdim+1
+    GrB_Index Ap_size,      // size of Ap in bytes
+    uint32_t **Ai,          // indices, of size at least Ap [vdim]
+    GrB_Index Ai_size,      // size of Ai in bytes
+    void **Ax,              // values
+    GrB_Index Ax_size,      // size of Ax in bytes
+    bool iso,               // if true, A is iso
+    bool jumbled,           // if true, indices in each vector may be unsorted
+    bool is_csc,            // if true, A is packed by column, else by row
+    bool fast_import,       // if true: trust the data, if false: check it
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *Ap64 = NULL ; size_t Ap64_size = 0 ;
+    int64_t *Ai64 = NULL ; size_t Ai64_size = 0 ;
+    ASSERT_MATRIX_OK (A, "A to pack with 32-bit indices", GB0) ;
+    GB_RETURN_IF_NULL (Ap) ;
+    GB_RETURN_IF_NULL (*Ap) ;
+    if (Ai_size > 0)
+    { 
+        // Ai and (*Ai) are ignored if Ai_size is zero
+        GB_RETURN_IF_NULL (Ai) ;
+        GB_RETURN_IF_NULL (*Ai) ;
+    }
+
+    int64_t vlen = (is_csc) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t vdim = (is_csc) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    if (Ap_size < (vdim+1) * sizeof (uint32_t))
+    { 
+        // Ap is too small
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    const uint32_t *restrict Ap32 = (*Ap) ;
+    const uint32_t *restrict Ai32 = (Ai == NULL) ? NULL : (*Ai) ;
+    int64_t nvals = Ap32 [vdim] ;
+    if (Ai_size < nvals * sizeof (uint32_t))
+    { 
+        // Ai is too small
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the 64-bit arrays
+    //--------------------------------------------------------------------------
+
+    Ap64 = GB_MALLOC (vdim+1, int64_t, &Ap64_size) ;
+    Ai64 = GB_MALLOC (GB_IMAX (nvals, 1), int64_t, &Ai64_size) ;
+    if (Ap64 == NULL || Ai64 == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // widen Ap and Ai in parallel
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (vdim + 1 + nvals, chunk, nthreads_max) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= vdim ; k++)
+    { 
+        Ap64 [k] = Ap32 [k] ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nvals ; k++)
+    { 
+        Ai64 [k] = Ai32 [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the 64-bit arrays and Ax into A
+    //--------------------------------------------------------------------------
+
+    // GB_import adds the arrays it packs into A to the debug memtable, so
+    // Ap64 and Ai64 are removed from it first.
+    GB_Global_memtable_remove (Ap64) ;
+    GB_Global_memtable_remove (Ai64) ;
+    info = GB_import (true, &A, A->type, vlen, vdim, false,
+        (GrB_Index **) &Ap64, Ap64_size,    // Ap
+        NULL, 0,                            // Ah
+        NULL, 0,                            // Ab
+        (GrB_Index **) &Ai64, Ai64_size,    // Ai
+        Ax,   Ax_size,                      // Ax
+        0, jumbled, 0,                      // jumbled or not
+        GxB_SPARSE, is_csc,                 // sparse by row or by column
+        iso, fast_import, true, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // Ap64 and Ai64 are freed here, unless GB_import has taken them
+        if (Ap64 != NULL) GB_Global_memtable_add (Ap64, Ap64_size) ;
+        if (Ai64 != NULL) GB_Global_memtable_add (Ai64, Ai64_size) ;
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+    ASSERT (Ap64 == NULL && Ai64 == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // free the 32-bit arrays, which are owned by GraphBLAS once packed
+    //--------------------------------------------------------------------------
+
+    GB_Global_memtable_add (*Ap, Ap_size) ;
+    GB_FREE (Ap, Ap_size) ;
+    if (Ai != NULL && (*Ai) != NULL)
+    { 
+        GB_Global_memtable_add (*Ai, Ai_size) ;
+        GB_FREE (Ai, Ai_size) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
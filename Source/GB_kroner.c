@@ -12,20 +12,18 @@
 // different.  The type of C is the type of z.  C is hypersparse if either A
 // or B are hypersparse.
 
-// FUTURE: this would be faster with built-in types and operators.
-
-// FUTURE: at most one thread is used for each vector of C=kron(A,B).  The
-// matrix C is normally very large, but if both A and B are n-by-1, then C is
-// n^2-by-1 and only a single thread is used.  A better method for this case
-// would construct vectors of C in parallel.
-
-// FUTURE: each vector C(:,k) takes O(nnz(C(:,k))) work, but this is not
-// accounted for in the parallel load-balancing.
-
-#define GB_FREE_WORKSPACE   \
-{                           \
-    GB_Matrix_free (&A2) ;  \
-    GB_Matrix_free (&B2) ;  \
+// The entries of C are sliced with GB_ek_slice once the pattern of C is
+// known, so the work is balanced by nnz(C) and a single vector C(:,k) can be
+// computed by many threads.  This matters when A and B have few vectors; if
+// both are n-by-1, for example, C is n^2-by-1.  Built-in operators on
+// built-in types use the factory kernels in Generated2/GB_binop__*.c, which
+// share GB_kroner_template.c with the generic method below.
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (C_ek_slicing, int64_t) ;   \
+    GB_Matrix_free (&A2) ;                  \
+    GB_Matrix_free (&B2) ;                  \
 }
 
 #define GB_FREE_ALL         \
@@ -36,6 +34,11 @@
 
 #include "GB_kron.h"
 #include "GB_emult.h"
+#include "GB_ek_slice.h"
+#include "GB_binop.h"
+#ifndef GBCUDA_DEV
+#include "GB_binop__include.h"
+#endif
 
 GrB_Info GB_kroner                  // C = kron (A,B)
 (
@@ -59,6 +62,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     struct GB_Matrix_opaque A2_header, B2_header ;
     GrB_Matrix A2 = NULL, B2 = NULL ;
+    GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
 
     ASSERT_MATRIX_OK (A_in, "A_in for kron (A,B)", GB0) ;
     ASSERT_MATRIX_OK (B_in, "B_in for kron (A,B)", GB0) ;
@@ -107,8 +111,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *restrict Ap = A->p ;
     const int64_t *restrict Ah = A->h ;
-    const int64_t *restrict Ai = A->i ;
-    const GB_void *restrict Ax = A_is_pattern ? NULL : ((GB_void *) A->x) ;
     const int64_t asize = A->type->size ;
     const int64_t avlen = A->vlen ;
     const int64_t avdim = A->vdim ;
@@ -117,8 +119,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bh = B->h ;
-    const int64_t *restrict Bi = B->i ;
-    const GB_void *restrict Bx = B_is_pattern ? NULL : ((GB_void *) B->x) ;
     const int64_t bsize = B->type->size ;
     const int64_t bvlen = B->vlen ;
     const int64_t bvdim = B->vdim ;
@@ -183,32 +183,10 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     int64_t *restrict Cp = C->p ;
     int64_t *restrict Ch = C->h ;
-    int64_t *restrict Ci = C->i ;
-    GB_void *restrict Cx = (GB_void *) C->x ;
-    int64_t *restrict Cx_int64 = NULL ;
-    int32_t *restrict Cx_int32 = NULL ;
 
-    GxB_binary_function fmult = op->binop_function ;
     GB_Opcode opcode = op->opcode ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
-    GB_cast_function cast_A = NULL, cast_B = NULL ;
-    if (!A_is_pattern)
-    { 
-        cast_A = GB_cast_factory (op->xtype->code, A->type->code) ;
-    }
-    if (!B_is_pattern)
-    { 
-        cast_B = GB_cast_factory (op->ytype->code, B->type->code) ;
-    }
-
-    int64_t offset = 0 ;
-    if (op_is_positional)
-    { 
-        offset = GB_positional_offset (opcode, NULL) ;
-        Cx_int64 = (int64_t *) Cx ;
-        Cx_int32 = (int32_t *) Cx ;
-    }
-    bool is64 = (ctype == GrB_INT64) ;
+    GB_Type_code ccode = ctype->code ;
 
     //--------------------------------------------------------------------------
     // compute the column counts of C, and C->h if C is hypersparse
@@ -265,135 +243,175 @@ GrB_Info GB_kroner                  // C = kron (A,B)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // slice the entries of C
+    //--------------------------------------------------------------------------
+
+    // Each task computes a contiguous slice of the entries of C, and any
+    // vector C(:,k) can be split across multiple tasks.
+
+    int C_nthreads, C_ntasks ;
+    GB_SLICE_MATRIX (C, 8, chunk) ;
+
     //--------------------------------------------------------------------------
     // C = kron (A,B)
     //--------------------------------------------------------------------------
 
-    const bool A_iso = A->iso ;
-    const bool B_iso = B->iso ;
+    bool done = false ;
+
+    if (C_iso)
+    { 
+
+        //----------------------------------------------------------------------
+        // C is iso and sparse/hyper: only the pattern of C is computed
+        //----------------------------------------------------------------------
+
+        #define GB_ISO_KRON
+        #define GB_GETA(aij,Ax,pA,A_iso)
+        #define GB_GETB(bij,Bx,pB,B_iso)
+        #define GB_BINOP(cij,aij,bij,i,j)
+        #include "GB_kroner_template.c"
+        #undef  GB_GETA
+        #undef  GB_GETB
+        #undef  GB_BINOP
+        done = true ;
 
-    #pragma omp parallel for num_threads(nthreads) schedule(guided)
-    for (kC = 0 ; kC < cnvec ; kC++)
+    }
+    else
     {
-        int64_t kA = kC / bnvec ;
-        int64_t kB = kC % bnvec ;
-
-        // get B(:,jB), the (kB)th vector of B
-        int64_t jB = GBH (Bh, kB) ;
-        int64_t pB_start = GBP (Bp, kB, bvlen) ;
-        int64_t pB_end   = GBP (Bp, kB+1, bvlen) ;
-        int64_t bknz = pB_start - pB_end ;
-        if (bknz == 0) continue ;
-        GB_void bwork [GB_VLA(bsize)] ;
-        if (!B_is_pattern && B_iso)
-        { 
-            cast_B (bwork, Bx, bsize) ;
-        }
 
-        // get C(:,jC), the (kC)th vector of C
-        // int64_t kC = kA * bnvec + kB ;
-        int64_t pC = GBP (Cp, kC, cvlen) ;
+        #ifndef GBCUDA_DEV
 
-        // get A(:,jA), the (kA)th vector of A
-        int64_t jA = GBH (Ah, kA) ;
-        int64_t pA_start = GBP (Ap, kA, avlen) ;
-        int64_t pA_end   = GBP (Ap, kA+1, avlen) ;
-        GB_void awork [GB_VLA(asize)] ;
-        if (!A_is_pattern && A_iso)
-        { 
-            cast_A (awork, Ax, asize) ;
-        }
+            //------------------------------------------------------------------
+            // define the worker for the switch factory
+            //------------------------------------------------------------------
 
-        for (int64_t pA = pA_start ; pA < pA_end ; pA++)
-        {
-            // awork = A(iA,jA), typecasted to op->xtype
-            int64_t iA = GBI (Ai, pA, avlen) ;
-            int64_t iAblock = iA * bvlen ;
-            if (!A_is_pattern && !A_iso)
+            #define GB_AkronB(mult,xname) GB (_AkronB_ ## mult ## xname)
+
+            #define GB_BINOP_WORKER(mult,xname)                         \
+            {                                                           \
+                info = GB_AkronB(mult,xname) (C, A, B,                  \
+                    C_ek_slicing, C_ntasks, C_nthreads) ;               \
+                done = (info != GrB_NO_VALUE) ;                         \
+            }                                                           \
+            break ;
+
+            //------------------------------------------------------------------
+            // launch the switch factory
+            //------------------------------------------------------------------
+
+            GB_Type_code xcode, ycode, zcode ;
+            if (!op_is_positional &&
+                GB_binop_builtin (A->type, A_is_pattern, B->type, B_is_pattern,
+                op, false, &opcode, &xcode, &ycode, &zcode) && ccode == zcode)
             { 
-                cast_A (awork, Ax + (pA*asize), asize) ;
+                #define GB_NO_PAIR
+                #include "GB_binop_factory.c"
             }
-            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
-            {
-                // bwork = B(iB,jB), typecasted to op->ytype
-                int64_t iB = GBI (Bi, pB, bvlen) ;
-                if (!B_is_pattern && !B_iso)
-                { 
-                    cast_B (bwork, Bx +(pB*bsize), bsize) ;
-                }
-                // C(iC,jC) = A(iA,jA) * B(iB,jB)
-                if (!C_is_full)
-                { 
-                    int64_t iC = iAblock + iB ;
-                    Ci [pC] = iC ;
-                }
-                if (op_is_positional)
-                {
-                    // positional binary operator
-                    switch (opcode)
-                    {
-                        case GB_FIRSTI_binop_code   : 
-                            // z = first_i(A(iA,jA),y) == iA
-                        case GB_FIRSTI1_binop_code  : 
-                            // z = first_i1(A(iA,jA),y) == iA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iA + offset) ;
-                            }
-                            break ;
-                        case GB_FIRSTJ_binop_code   : 
-                            // z = first_j(A(iA,jA),y) == jA
-                        case GB_FIRSTJ1_binop_code  : 
-                            // z = first_j1(A(iA,jA),y) == jA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jA + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDI_binop_code  : 
-                            // z = second_i(x,B(iB,jB)) == iB
-                        case GB_SECONDI1_binop_code : 
-                            // z = second_i1(x,B(iB,jB)) == iB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iB + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDJ_binop_code  : 
-                            // z = second_j(x,B(iB,jB)) == jB
-                        case GB_SECONDJ1_binop_code : 
-                            // z = second_j1(x,B(iB,jB)) == jB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jB + offset) ;
-                            }
-                            break ;
-                        default: ;
-                    }
+
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    // generic worker
+    //--------------------------------------------------------------------------
+
+    if (!done)
+    {
+        GB_BURBLE_MATRIX (C, "(generic kron: %s) ", op->name) ;
+
+        //----------------------------------------------------------------------
+        // get the operator and the typecasting functions
+        //----------------------------------------------------------------------
+
+        const GxB_binary_function fmult = op->binop_function ;
+        const size_t xsize = (A_is_pattern) ? 1 : op->xtype->size ;
+        const size_t ysize = (B_is_pattern) ? 1 : op->ytype->size ;
+        const GB_cast_function cast_A = (A_is_pattern) ? NULL :
+            GB_cast_factory (op->xtype->code, A->type->code) ;
+        const GB_cast_function cast_B = (B_is_pattern) ? NULL :
+            GB_cast_factory (op->ytype->code, B->type->code) ;
+
+        #define GB_ATYPE GB_void
+        #define GB_BTYPE GB_void
+        #define GB_CTYPE GB_void
+
+        // address of Cx [p]
+        #define GB_CX(p) Cx +((p)*csize)
+
+        if (op_is_positional)
+        {
+
+            //------------------------------------------------------------------
+            // C(iC,jC) = positional_op (A(iA,jA), B(iB,jB))
+            //------------------------------------------------------------------
+
+            // The positional index is computed in GB_GETA if the op depends
+            // on A(iA,jA), or in GB_GETB if it depends on B(iB,jB).
+
+            const int64_t pos_offset = GB_positional_offset (opcode, NULL) ;
+            const bool is64 = (ctype == GrB_INT64) ;
+            const bool op_is_first =
+                (opcode == GB_FIRSTI_binop_code  ) ||
+                (opcode == GB_FIRSTI1_binop_code ) ||
+                (opcode == GB_FIRSTJ_binop_code  ) ||
+                (opcode == GB_FIRSTJ1_binop_code ) ;
+            const bool index_is_i =
+                (opcode == GB_FIRSTI_binop_code  ) ||
+                (opcode == GB_FIRSTI1_binop_code ) ||
+                (opcode == GB_SECONDI_binop_code ) ||
+                (opcode == GB_SECONDI1_binop_code) ;
+
+            #define GB_GETA(aij,Ax,pA,A_iso)                            \
+                const int64_t aij = ((index_is_i) ? iA : jA) + pos_offset ;
+            #define GB_GETB(bij,Bx,pB,B_iso)                            \
+                const int64_t bij = ((index_is_i) ? iB : jB) + pos_offset ;
+            #define GB_BINOP(cij,aij,bij,i,j)                           \
+            {                                                           \
+                int64_t z = (op_is_first) ? aij : bij ;                 \
+                if (is64)                                               \
+                {                                                       \
+                    memcpy (cij, &z, sizeof (int64_t)) ;                \
+                }                                                       \
+                else                                                    \
+                {                                                       \
+                    int32_t z32 = (int32_t) z ;                         \
+                    memcpy (cij, &z32, sizeof (int32_t)) ;              \
+                }                                                       \
+            }
+            #include "GB_kroner_template.c"
+            #undef  GB_GETA
+            #undef  GB_GETB
+            #undef  GB_BINOP
+
+        }
+        else
+        { 
+
+            //------------------------------------------------------------------
+            // C(iC,jC) = op (A(iA,jA), B(iB,jB))
+            //------------------------------------------------------------------
+
+            // aij = (xtype) A(iA,jA), located in Ax [pA]
+            #define GB_GETA(aij,Ax,pA,A_iso)                                \
+                GB_void aij [GB_VLA(xsize)] ;                               \
+                if (cast_A != NULL)                                         \
+                {                                                           \
+                    cast_A (aij, Ax +((A_iso) ? 0:(pA)*asize), asize) ;     \
                 }
-                else if (!C_iso)
-                { 
-                    // standard binary operator
-                    fmult (Cx +(pC*csize), awork, bwork) ;
+
+            // bij = (ytype) B(iB,jB), located in Bx [pB]
+            #define GB_GETB(bij,Bx,pB,B_iso)                                \
+                GB_void bij [GB_VLA(ysize)] ;                               \
+                if (cast_B != NULL)                                         \
+                {                                                           \
+                    cast_B (bij, Bx +((B_iso) ? 0:(pB)*bsize), bsize) ;     \
                 }
-                pC++ ;
-            }
+
+            #define GB_BINOP(cij,aij,bij,i,j)                               \
+                fmult (cij, aij, bij) ;
+
+            #include "GB_kroner_template.c"
         }
     }
 
@@ -88,6 +88,54 @@ void *GB_xalloc_memory      // return the newly-allocated space
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// NUMA placement
+//------------------------------------------------------------------------------
+
+// blocks smaller than GB_NUMA_MIN_SIZE are not placed by GB_numa_place
+#define GB_NUMA_MIN_SIZE (1024*1024)
+
+uint64_t GB_numa_online_nodes (void) ;
+
+void GB_numa_place
+(
+    void *p,                // block to place
+    size_t size,            // size of the block, in bytes
+    size_t nzero,           // # of leading bytes to set to zero
+    int nthreads_max        // max # of threads to use
+) ;
+
+//------------------------------------------------------------------------------
+// huge pages
+//------------------------------------------------------------------------------
+
+// size of a transparent huge page on x86_64 and most aarch64 systems
+#define GB_HUGE_PAGE_SIZE (2*1024*1024)
+
+bool GB_huge_page_supported (void) ;
+
+void GB_huge_page_advise
+(
+    void *p,                // block to advise
+    size_t size             // size of the block, in bytes
+) ;
+
+//------------------------------------------------------------------------------
+// spilling large blocks to files
+//------------------------------------------------------------------------------
+
+#define GB_SPILL_MAX 1024           // max # of blocks spilled at one time
+#define GB_SPILL_PATH_MAX 4096      // max length of the spill directory + 1
+#define GB_SPILL_THRESHOLD_DEFAULT (64*1024*1024)
+
+GrB_Info GB_spill_directory_set (const char *dir) ;
+
+void *GB_spill_malloc (size_t size) ;
+
+bool GB_spill_free (void *p) ;
+
+bool GB_spill_unspill (void **p, size_t size) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
@@ -25,7 +25,9 @@
 // Some GrB_Matrix and GrB_Vector methods do not take a descriptor, however
 // (GrB_*_dup, _build, _exportTuples, _clear, _nvals, _wait, and GxB_*_resize).
 // For those methods the default rule is always used (nthreads_max =
-// GxB_DEFAULT), which then relies on the global nthreads_max.
+// GxB_DEFAULT), which then relies on the nthreads_max of the GxB_Context
+// engaged by the calling thread, or the global nthreads_max if the thread has
+// not engaged a context (or the setting in the context is GxB_DEFAULT).
 
 //------------------------------------------------------------------------------
 // GB_GET_NTHREADS_MAX:  determine max # of threads for OpenMP parallelism.
@@ -37,18 +39,25 @@
 //      automatically: between 1 and nthreads_max, depending on the problem
 //      size.  Below is the default rule.  Any function can use its own rule
 //      instead, based on Context, chunk, nthreads_max, and the problem size.
-//      No rule can exceed nthreads_max.
+//      No rule can exceed nthreads_max.  If GxB_THREAD_SHARING is enabled,
+//      nthreads_max is also limited to the share of the global nthreads_max
+//      of each of the user-callable methods currently running (see
+//      GB_Global_thread_share_get).
 
 #define GB_GET_NTHREADS_MAX(nthreads_max,chunk,Context)                     \
     int nthreads_max = (Context == NULL) ? 1 : Context->nthreads_max ;      \
     if (nthreads_max <= GxB_DEFAULT)                                        \
     {                                                                       \
-        nthreads_max = GB_Global_nthreads_max_get ( ) ;                     \
+        nthreads_max = GB_Global_context_nthreads_max_get ( ) ;             \
+    }                                                                       \
+    if (GB_Global_thread_sharing_get ( ))                                   \
+    {                                                                       \
+        nthreads_max = GB_Global_thread_share_get (nthreads_max) ;          \
     }                                                                       \
     double chunk = (Context == NULL) ? GxB_DEFAULT : Context->chunk ;       \
     if (chunk <= GxB_DEFAULT)                                               \
     {                                                                       \
-        chunk = GB_Global_chunk_get ( ) ;                                   \
+        chunk = GB_Global_context_chunk_get ( ) ;                           \
     }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+// GB_numa: NUMA placement of large blocks of memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_numa_place places the pages of a newly allocated block of memory, of at
+// least GB_NUMA_MIN_SIZE bytes, on the NUMA nodes of the system according to
+// the global GxB_NUMA_POLICY:
+
+// GxB_NUMA_INTERLEAVE: the pages are interleaved round-robin across all online
+//      nodes, with mbind (Linux only).  Each thread then reads about the
+//      same amount of local and remote memory, regardless of the partition of
+//      the work.
+
+// GxB_NUMA_FIRST_TOUCH: the block is split into nthreads contiguous slices of
+//      equal size, and each thread touches the pages of its own slice, so that
+//      the operating system places them on the node of that thread.  This is
+//      the same partition that GB_ek_slice and GB_pslice compute for the Ai
+//      and Ax arrays of a matrix with ntasks = nthreads (equal # of entries
+//      per task), and that the static-scheduled loops over bitmap and full
+//      matrices use.  Kernels with that partition then mostly read local
+//      memory.  This has no effect unless the OpenMP threads are bound to
+//      cores (OMP_PROC_BIND) and the pages have not yet been touched; blocks
+//      reused from the free_pool are not large enough to be placed here.
+
+// If nzero > 0, the first nzero bytes of the block are also set to zero, with
+// the same partition (this replaces the GB_memset in GB_calloc_memory).
+
+#include "GB.h"
+#if defined ( __linux__ )
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined ( __linux__ ) && defined ( SYS_mbind )
+#define GB_HAS_MBIND 1
+#define GB_MPOL_INTERLEAVE 3
+#else
+#define GB_HAS_MBIND 0
+#endif
+
+#define GB_NUMA_PAGE 4096
+
+//------------------------------------------------------------------------------
+// GB_numa_online_nodes: return the set of online NUMA nodes
+//------------------------------------------------------------------------------
+
+// Returns a bit mask of the online nodes 0 to 63, from a list such as "0-3,5"
+// in /sys/devices/system/node/online, or zero if the nodes cannot be
+// determined or mbind is not available.
+
+uint64_t GB_numa_online_nodes (void)
+{
+    uint64_t nodes = 0 ;
+    #if GB_HAS_MBIND
+    FILE *f = fopen ("/sys/devices/system/node/online", "r") ;
+    if (f != NULL)
+    {
+        int first, last ;
+        char sep ;
+        while (fscanf (f, "%d", &first) == 1)
+        {
+            last = first ;
+            sep = (char) fgetc (f) ;
+            if (sep == '-')
+            { 
+                if (fscanf (f, "%d", &last) != 1) break ;
+                sep = (char) fgetc (f) ;
+            }
+            for (int node = GB_IMAX (first, 0) ; node <= GB_IMIN (last, 63) ;
+                node++)
+            { 
+                nodes |= ((uint64_t) 1) << node ;
+            }
+            if (sep != ',') break ;
+        }
+        fclose (f) ;
+    }
+    #endif
+    return (nodes) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_numa_place: place a newly allocated block on the NUMA nodes
+//------------------------------------------------------------------------------
+
+void GB_numa_place
+(
+    void *p,                // block to place
+    size_t size,            // size of the block, in bytes
+    size_t nzero,           // # of leading bytes to set to zero
+    int nthreads_max        // max # of threads to use
+)
+{
+
+    int policy = GB_Global_numa_policy_get ( ) ;
+    GB_void *restrict pb = (GB_void *) p ;
+    nzero = GB_IMIN (nzero, size) ;
+
+    if (policy == GxB_NUMA_FIRST_TOUCH)
+    {
+
+        //----------------------------------------------------------------------
+        // each thread touches its own slice of the block
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads ((double) size, GB_NUMA_MIN_SIZE,
+            nthreads_max) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, (int64_t) size, tid, nthreads) ;
+            // set the part of the slice in [0:nzero-1] to zero
+            int64_t zend = GB_IMIN (pend, (int64_t) nzero) ;
+            if (pstart < zend)
+            { 
+                memset (pb + pstart, 0, (size_t) (zend - pstart)) ;
+            }
+            // touch each page of the rest of the slice
+            for (int64_t k = GB_IMAX (pstart, zend) ; k < pend ;
+                k += GB_NUMA_PAGE)
+            { 
+                pb [k] = 0 ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // interleave the pages across the nodes, then clear the block
+        //----------------------------------------------------------------------
+
+        #if GB_HAS_MBIND
+        if (policy == GxB_NUMA_INTERLEAVE)
+        {
+            // mbind applies only to whole pages inside the block
+            uint64_t nodes = GB_Global_numa_nodes_get ( ) ;
+            size_t pstart = (size_t) pb ;
+            size_t pend = pstart + size ;
+            pstart = ((pstart + GB_NUMA_PAGE - 1) / GB_NUMA_PAGE) ;
+            pstart *= GB_NUMA_PAGE ;
+            pend = (pend / GB_NUMA_PAGE) * GB_NUMA_PAGE ;
+            if (nodes != 0 && pstart < pend)
+            { 
+                // failure is not an error; the pages are placed as usual
+                (void) syscall (SYS_mbind, (void *) pstart, pend - pstart,
+                    GB_MPOL_INTERLEAVE, &nodes, 8 * sizeof (uint64_t) + 1, 0) ;
+            }
+        }
+        #endif
+        if (nzero > 0)
+        { 
+            GB_memset (p, 0, nzero, nthreads_max) ;
+        }
+    }
+}
+
@@ -460,6 +460,24 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int import ;            // if zero (default), trust input data
 } ;
 
+//------------------------------------------------------------------------------
+// GxB_Context: execution context engaged by a user thread
+//------------------------------------------------------------------------------
+
+struct GB_Context_opaque    // content of GxB_Context
+{
+    // first 4 items exactly match GrB_Matrix, GrB_Vector, GrB_Scalar structs:
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    char *logger ;          // error logger string
+    size_t logger_size ;    // size of the malloc'd block for logger, or 0
+    // specific to the context struct:
+    double chunk ;          // chunk size for # of threads for small problems
+    int64_t max_memory ;    // memory budget in bytes (0: no limit)
+    int64_t memory_used ;   // bytes currently charged to this context
+    int nthreads_max ;      // max # threads to use
+} ;
+
 //------------------------------------------------------------------------------
 // GB_Pending data structure: for scalars, vectors, and matrices
 //------------------------------------------------------------------------------
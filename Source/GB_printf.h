@@ -122,7 +122,9 @@
 
 // GBBURBLE and the GB_BURBLE_* methods provide diagnostic output.
 // Use GxB_set (GxB_BURBLE, true) to turn it on
-// and GxB_set (GxB_BURBLE, false) to turn it off.
+// and GxB_set (GxB_BURBLE, false) to turn it off.  GB_BURBLE_START and
+// GB_BURBLE_END also start and end the telemetry (see GB_telemetry.h), and
+// register the method for thread sharing (see GB_Global.c).
 
 void GB_burble_assign
 (
@@ -174,6 +176,8 @@ void GB_burble_assign
             GBURBLE (" [ " func " ") ;                  \
             t_burble = GB_OPENMP_GET_WTIME ;            \
         }                                               \
+        GB_TELEMETRY_START (func) ;                     \
+        GB_Global_thread_share_begin ( ) ;              \
     }
 
     #define GB_BURBLE_END                               \
@@ -183,6 +187,8 @@ void GB_burble_assign
             t_burble = GB_OPENMP_GET_WTIME - t_burble ; \
             GBURBLE ("\n   %.3g sec ]\n", t_burble) ;   \
         }                                               \
+        GB_TELEMETRY_END ;                              \
+        GB_Global_thread_share_end ( ) ;                \
     }
 
 #else
@@ -190,10 +196,18 @@ void GB_burble_assign
     // burble with no timing
 
     #define GB_BURBLE_START(func)                       \
-        GBURBLE (" [ " func " ")
+    {                                                   \
+        GBURBLE (" [ " func " ") ;                      \
+        GB_TELEMETRY_START (func) ;                     \
+        GB_Global_thread_share_begin ( ) ;              \
+    }
 
     #define GB_BURBLE_END                               \
-        GBURBLE ("]\n")
+    {                                                   \
+        GBURBLE ("]\n") ;                               \
+        GB_TELEMETRY_END ;                              \
+        GB_Global_thread_share_end ( ) ;                \
+    }
 
 #endif
 
@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// GB_read.h: definitions for reading a matrix from a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_READ_H
+#define GB_READ_H
+
+// The file is read in chunks of GB_READ_CHUNK bytes, with a single fread per
+// chunk.  Each chunk is then parsed in parallel.
+#ifndef GB_READ_CHUNK
+#define GB_READ_CHUNK (64 * 1024 * 1024)
+#endif
+
+// the longest line permitted in the header of a Matrix Market file
+#define GB_MM_LINE 1024
+
+GrB_Info GB_read_MatrixMarket       // read a Matrix Market file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type type,                  // type of C, or NULL to use the file
+    FILE *f,                        // file to read
+    GB_Context Context
+) ;
+
+GrB_Info GB_read_binary_COO         // read a binary COO file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type type,                  // type of C and of the values in the file
+    GrB_Index nrows,                // # of rows of C
+    GrB_Index ncols,                // # of columns of C
+    int index_size,                 // size of each index (4 or 8 bytes)
+    FILE *f,                        // file to read
+    GB_Context Context
+) ;
+
+GrB_Info GB_read_build              // build a matrix from tuples read from a file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type ctype,                 // type of C
+    int64_t nrows,                  // # of rows of C
+    int64_t ncols,                  // # of columns of C
+    int64_t **I_handle,             // row indices of the tuples, size ijslen
+    size_t *I_size_handle,
+    int64_t **J_handle,             // column indices of the tuples, size ijslen
+    size_t *J_size_handle,
+    GB_void **X_handle,             // values of the tuples, or NULL if iso
+    size_t *X_size_handle,
+    const GB_void *iso_value,       // value of all tuples if X is NULL
+    int64_t ijslen,                 // allocated size of I and J
+    int64_t nvals,                  // # of tuples
+    GrB_Type xtype,                 // type of X or iso_value
+    GB_Context Context
+) ;
+
+//------------------------------------------------------------------------------
+// GB_read_*: parse a number from a line of text
+//------------------------------------------------------------------------------
+
+// Each method skips leading spaces and tabs, parses a number, and returns a
+// pointer to the first character after the number, or NULL if the text does
+// not hold a valid number.  The number must be followed by white space or the
+// end of the line.  The text must be terminated by a newline.
+
+#define GB_READ_BLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r')
+#define GB_READ_END(c) (GB_READ_BLANK (c) || (c) == '\n')
+
+static inline const char *GB_read_uint64    // parse an unsigned integer
+(
+    uint64_t *x,
+    const char *p
+)
+{
+    while (GB_READ_BLANK (*p)) p++ ;
+    if (*p == '+') p++ ;
+    uint64_t t = 0 ;
+    const char *start = p ;
+    while (*p >= '0' && *p <= '9')
+    {
+        uint64_t d = (uint64_t) (*p - '0') ;
+        if (t > (UINT64_MAX - d) / 10) return (NULL) ;     // overflow
+        t = 10 * t + d ;
+        p++ ;
+    }
+    if (p == start || !GB_READ_END (*p)) return (NULL) ;
+    (*x) = t ;
+    return (p) ;
+}
+
+static inline const char *GB_read_int64     // parse a signed integer
+(
+    int64_t *x,
+    const char *p
+)
+{
+    while (GB_READ_BLANK (*p)) p++ ;
+    bool neg = (*p == '-') ;
+    if (neg) p++ ;
+    uint64_t t ;
+    p = GB_read_uint64 (&t, p) ;
+    if (p == NULL || t > ((uint64_t) INT64_MAX) + (neg ? 1 : 0)) return (NULL);
+    (*x) = (neg) ? (int64_t) (0 - t) : (int64_t) t ;
+    return (p) ;
+}
+
+static inline const char *GB_read_double    // parse a double
+(
+    double *x,
+    const char *p
+)
+{
+    // exact powers of 10 that can be held in a double
+    static const double pow10 [23] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6,
+        1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+        1e19, 1e20, 1e21, 1e22 } ;
+
+    while (GB_READ_BLANK (*p)) p++ ;
+    const char *start = p ;
+    bool neg = (*p == '-') ;
+    if (*p == '-' || *p == '+') p++ ;
+
+    // parse the mantissa, of up to 19 significant digits
+    uint64_t m = 0 ;
+    int nsig = 0, ndigits = 0, e = 0 ;
+    for ( ; *p >= '0' && *p <= '9' ; p++, ndigits++)
+    {
+        if (nsig < 19) { m = 10 * m + (*p - '0') ; nsig += (m > 0) ; }
+        else { e++ ; nsig = 20 ; }
+    }
+    if (*p == '.')
+    {
+        for (p++ ; *p >= '0' && *p <= '9' ; p++, ndigits++)
+        {
+            if (nsig < 19) { m = 10 * m + (*p - '0') ; nsig += (m > 0) ; e--;}
+            else { nsig = 20 ; }
+        }
+    }
+
+    // parse the exponent
+    if (ndigits > 0 && (*p == 'e' || *p == 'E'))
+    {
+        int64_t ex ;
+        const char *q = GB_read_int64 (&ex, p+1) ;
+        if (q == NULL || ex < -9999 || ex > 9999) return (NULL) ;
+        e += (int) ex ;
+        p = q ;
+    }
+
+    if (ndigits > 0 && GB_READ_END (*p) && nsig <= 19
+        && m <= (((uint64_t) 1) << 53) && e >= -22 && e <= 22)
+    {
+        // fast path: the result is exact, with a single rounding
+        double t = (double) m ;
+        t = (e < 0) ? (t / pow10 [-e]) : (t * pow10 [e]) ;
+        (*x) = (neg) ? (-t) : t ;
+        return (p) ;
+    }
+
+    // slow path: more digits, a large exponent, inf, or nan.  The text is
+    // terminated by a newline, so strtod cannot read past it.
+    char *end ;
+    double t = strtod (start, &end) ;
+    if (end == start || !GB_READ_END (*end)) return (NULL) ;
+    (*x) = t ;
+    return (end) ;
+}
+
+#endif
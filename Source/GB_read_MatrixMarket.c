@@ -0,0 +1,639 @@
+//------------------------------------------------------------------------------
+// GB_read_MatrixMarket: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_read_MatrixMarket
+// CALLS:     GB_read_build
+
+// The Matrix Market header and size line are read with fgets.  The rest of
+// the file is read in large chunks with fread, and each chunk is split at line
+// boundaries into one slice per thread.  The lines in each slice are counted
+// in parallel, a cumulative sum gives the position of the first entry of each
+// slice, and then the slices are parsed in parallel, directly into the
+// tuples (I,J,X).  A partial line at the end of a chunk is carried over to the
+// start of the next one.  The tuples are then passed to GB_read_build.
+
+// Supported formats: coordinate or array; real, double, integer, complex, or
+// pattern; and general, symmetric, skew-symmetric, or hermitian.  For the
+// symmetric cases, the file holds only the lower triangular part, and the
+// off-diagonal entries are mirrored into the upper triangular part once the
+// file is read.  Blank lines and lines that start with '%' are skipped.
+
+// The type of the values in the file (xtype) is GrB_FP64 for real and double,
+// GrB_INT64 for integer, GxB_FC64 for complex, and GrB_BOOL for pattern (in
+// which case C is iso, with all entries equal to true).  The type of C is
+// given by the type parameter.  If NULL, the type is taken from an optional
+// "%%GraphBLAS type" line, as written by LAGraph (such as "%%GraphBLAS
+// GrB_BOOL"), or xtype otherwise.
+
+#include "GB.h"
+#include "GB_read.h"
+#include <ctype.h>
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Buf, Buf_size) ;             \
+    GB_WERK_POP (Work, int64_t) ;               \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_FREE (&I, I_size) ;                      \
+    GB_FREE (&J, J_size) ;                      \
+    GB_FREE (&X, X_size) ;                      \
+}
+
+#define GB_MM_ERROR(message)                                \
+{                                                           \
+    GB_FREE_ALL ;                                           \
+    GB_ERROR (GrB_INVALID_VALUE, "Matrix Market file: %s",  \
+        message) ;                                          \
+}
+
+// field of the entries in the file
+#define GB_MM_REAL      0
+#define GB_MM_INTEGER   1
+#define GB_MM_COMPLEX   2
+#define GB_MM_PATTERN   3
+
+// symmetry of the file
+#define GB_MM_GENERAL   0
+#define GB_MM_SYMMETRIC 1
+#define GB_MM_SKEW      2
+#define GB_MM_HERMITIAN 3
+
+//------------------------------------------------------------------------------
+// GB_mm_token: get the next token from a header line
+//------------------------------------------------------------------------------
+
+static char *GB_mm_token (char **p, bool lower)
+{
+    char *s = (*p) ;
+    while (*s == ' ' || *s == '\t') s++ ;
+    char *token = s ;
+    for ( ; *s != '\0' && !isspace (*s) ; s++)
+    {
+        if (lower) (*s) = tolower (*s) ;
+    }
+    if (*s != '\0') (*s++) = '\0' ;
+    (*p) = s ;
+    return (token) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_getline: read a line of the header, ending in a newline
+//------------------------------------------------------------------------------
+
+// Any part of the line beyond GB_MM_LINE characters is discarded.
+
+static bool GB_mm_getline (char *line, FILE *f)
+{
+    if (fgets (line, GB_MM_LINE, f) == NULL) return (false) ;
+    size_t len = strlen (line) ;
+    if (len == 0 || line [len-1] != '\n')
+    {
+        // discard the rest of the line, and terminate it with a newline
+        int c ;
+        while ((c = fgetc (f)) != EOF && c != '\n') ;
+        line [len++] = '\n' ;
+        line [len] = '\0' ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_type: get a built-in type from its name
+//------------------------------------------------------------------------------
+
+static GrB_Type GB_mm_type (const char *name)
+{
+    #define GB_MM_TYPE(type) \
+        if (strcmp (name, GB_STR (type)) == 0) return (type) ;
+    GB_MM_TYPE (GrB_BOOL) ;
+    GB_MM_TYPE (GrB_INT8) ;
+    GB_MM_TYPE (GrB_INT16) ;
+    GB_MM_TYPE (GrB_INT32) ;
+    GB_MM_TYPE (GrB_INT64) ;
+    GB_MM_TYPE (GrB_UINT8) ;
+    GB_MM_TYPE (GrB_UINT16) ;
+    GB_MM_TYPE (GrB_UINT32) ;
+    GB_MM_TYPE (GrB_UINT64) ;
+    GB_MM_TYPE (GrB_FP32) ;
+    GB_MM_TYPE (GrB_FP64) ;
+    GB_MM_TYPE (GxB_FC32) ;
+    GB_MM_TYPE (GxB_FC64) ;
+    #undef GB_MM_TYPE
+    return (NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_first: first row index of column j, for the array format
+//------------------------------------------------------------------------------
+
+// The array format lists the matrix in column-major order.  If general, all
+// of each column is present.  If symmetric or hermitian, only the lower
+// triangular part is present.  If skew-symmetric, the diagonal is not.
+
+static inline int64_t GB_mm_first (int64_t j, int symmetry)
+{
+    return ((symmetry == GB_MM_GENERAL) ? 0 :
+           ((symmetry == GB_MM_SKEW) ? (j+1) : j)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_read_MatrixMarket
+//------------------------------------------------------------------------------
+
+GrB_Info GB_read_MatrixMarket       // read a Matrix Market file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type type,                  // type of C, or NULL to use the file
+    FILE *f,                        // file to read
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C_handle != NULL) ;
+    ASSERT (f != NULL) ;
+    (*C_handle) = NULL ;
+
+    char *Buf = NULL ; size_t Buf_size = 0 ;
+    int64_t *I = NULL ; size_t I_size = 0 ;
+    int64_t *J = NULL ; size_t J_size = 0 ;
+    GB_void *X = NULL ; size_t X_size = 0 ;
+    GB_WERK_DECLARE (Work, int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // read the banner: %%MatrixMarket matrix format field symmetry
+    //--------------------------------------------------------------------------
+
+    char line [GB_MM_LINE+1] ;
+    if (!GB_mm_getline (line, f))
+    {
+        GB_MM_ERROR ("file is empty") ;
+    }
+
+    char *p = line ;
+    char *banner = GB_mm_token (&p, true) ;
+    char *object = GB_mm_token (&p, true) ;
+    char *format = GB_mm_token (&p, true) ;
+    char *field  = GB_mm_token (&p, true) ;
+    char *symm   = GB_mm_token (&p, true) ;
+
+    if (strcmp (banner, "%%matrixmarket") != 0 || strcmp (object, "matrix"))
+    {
+        GB_MM_ERROR ("invalid banner") ;
+    }
+
+    bool coord ;
+    if (strcmp (format, "coordinate") == 0)
+    {
+        coord = true ;
+    }
+    else if (strcmp (format, "array") == 0)
+    {
+        coord = false ;
+    }
+    else
+    {
+        GB_MM_ERROR ("format must be coordinate or array") ;
+    }
+
+    int kind ;
+    GrB_Type xtype ;
+    if (strcmp (field, "real") == 0 || strcmp (field, "double") == 0)
+    {
+        kind = GB_MM_REAL ;
+        xtype = GrB_FP64 ;
+    }
+    else if (strcmp (field, "integer") == 0)
+    {
+        kind = GB_MM_INTEGER ;
+        xtype = GrB_INT64 ;
+    }
+    else if (strcmp (field, "complex") == 0)
+    {
+        kind = GB_MM_COMPLEX ;
+        xtype = GxB_FC64 ;
+    }
+    else if (strcmp (field, "pattern") == 0 && coord)
+    {
+        kind = GB_MM_PATTERN ;
+        xtype = GrB_BOOL ;
+    }
+    else
+    {
+        GB_MM_ERROR ("invalid field") ;
+    }
+
+    int symmetry ;
+    if (strcmp (symm, "general") == 0)
+    {
+        symmetry = GB_MM_GENERAL ;
+    }
+    else if (strcmp (symm, "symmetric") == 0)
+    {
+        symmetry = GB_MM_SYMMETRIC ;
+    }
+    else if (strcmp (symm, "skew-symmetric") == 0 && kind != GB_MM_PATTERN)
+    {
+        symmetry = GB_MM_SKEW ;
+    }
+    else if (strcmp (symm, "hermitian") == 0 && kind == GB_MM_COMPLEX)
+    {
+        symmetry = GB_MM_HERMITIAN ;
+    }
+    else
+    {
+        GB_MM_ERROR ("invalid symmetry") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // skip comments, and get the type from a %%GraphBLAS line, if present
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = type ;
+    while (true)
+    {
+        if (!GB_mm_getline (line, f))
+        {
+            GB_MM_ERROR ("size line missing") ;
+        }
+        p = line ;
+        while (GB_READ_BLANK (*p)) p++ ;
+        if (strncmp (p, "%%GraphBLAS", 11) == 0 && type == NULL)
+        {
+            // %%GraphBLAS type
+            p += 11 ;
+            char *name = GB_mm_token (&p, false) ;
+            ctype = GB_mm_type (name) ;
+            if (ctype == NULL)
+            {
+                GB_MM_ERROR ("unknown %%GraphBLAS type") ;
+            }
+        }
+        else if (*p != '%' && *p != '\n')
+        {
+            // this is the size line
+            break ;
+        }
+    }
+
+    if (ctype == NULL)
+    {
+        ctype = xtype ;
+    }
+    if (!GB_Type_compatible (ctype, xtype))
+    {
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type [%s] cannot be typecast from "
+            "the [%s] entries of the Matrix Market file", ctype->name,
+            xtype->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse the size line: nrows ncols nnz for coordinate, nrows ncols else
+    //--------------------------------------------------------------------------
+
+    uint64_t nrows, ncols, nz = 0 ;
+    p = (char *) GB_read_uint64 (&nrows, line) ;
+    if (p != NULL) p = (char *) GB_read_uint64 (&ncols, p) ;
+    if (p != NULL && coord) p = (char *) GB_read_uint64 (&nz, p) ;
+    if (p != NULL) while (GB_READ_BLANK (*p)) p++ ;
+    if (p == NULL || *p != '\n' || nrows > GB_NMAX || ncols > GB_NMAX)
+    {
+        GB_MM_ERROR ("invalid size line") ;
+    }
+
+    if (symmetry != GB_MM_GENERAL && nrows != ncols)
+    {
+        GB_MM_ERROR ("symmetric matrix must be square") ;
+    }
+
+    // # of entries held in the file
+    if (!coord)
+    {
+        if (nrows > 0 && ncols > (uint64_t) (INT64_MAX / nrows))
+        {
+            GB_MM_ERROR ("matrix too large") ;
+        }
+        nz = (symmetry == GB_MM_GENERAL) ? (nrows * ncols) :
+             ((symmetry == GB_MM_SKEW) ? (nrows * (nrows-1) / 2) :
+                                         (nrows * (nrows+1) / 2)) ;
+    }
+    if (nz > GB_NMAX)
+    {
+        GB_MM_ERROR ("too many entries") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    // the upper triangular part is added after the file is read
+    int64_t ijslen = (symmetry == GB_MM_GENERAL) ? nz : (2 * nz) ;
+    ijslen = GB_IMAX (ijslen, 1) ;
+    size_t xsize = xtype->size ;
+    I = GB_MALLOC (ijslen, int64_t, &I_size) ;
+    J = GB_MALLOC (ijslen, int64_t, &J_size) ;
+    if (kind != GB_MM_PATTERN && ijslen <= (int64_t) (GB_NMAX / xsize))
+    {
+        X = GB_MALLOC (ijslen * xsize, GB_void, &X_size) ;
+    }
+    if (I == NULL || J == NULL || (kind != GB_MM_PATTERN && X == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    double   *restrict Xd = (double   *) X ;
+    int64_t  *restrict Xi = (int64_t  *) X ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    // The buffer holds one chunk of the file, and a trailing newline that is
+    // added if the last line of the file has none.
+    Buf = GB_MALLOC_WORK (GB_READ_CHUNK + 1, char, &Buf_size) ;
+    GB_WERK_PUSH (Work, 2*(nthreads_max+1), int64_t) ;
+    if (Buf == NULL || Work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t *restrict Slice = Work ;                      // size nthreads+1
+    int64_t *restrict Count = Work + (nthreads_max+1) ;   // size nthreads+1
+
+    //--------------------------------------------------------------------------
+    // read the entries, one chunk at a time
+    //--------------------------------------------------------------------------
+
+    int64_t nvals = 0 ;         // # of entries read so far
+    size_t carry = 0 ;          // # of bytes carried over from last chunk
+    bool eof = false ;
+
+    while (!eof)
+    {
+
+        //----------------------------------------------------------------------
+        // read the next chunk
+        //----------------------------------------------------------------------
+
+        size_t nread = fread (Buf + carry, 1, GB_READ_CHUNK - carry, f) ;
+        size_t n = carry + nread ;
+        eof = (carry + nread < GB_READ_CHUNK) ;
+        size_t blen ;       // the chunk is Buf [0:blen-1]
+        if (eof)
+        {
+            // the last chunk: it must end with a newline
+            if (ferror (f))
+            {
+                GB_MM_ERROR ("read error") ;
+            }
+            if (n > 0 && Buf [n-1] != '\n') Buf [n++] = '\n' ;
+            blen = n ;
+            carry = 0 ;
+        }
+        else
+        {
+            // find the last newline in the chunk
+            blen = n ;
+            while (blen > 0 && Buf [blen-1] != '\n') blen-- ;
+            if (blen == 0)
+            {
+                GB_MM_ERROR ("line too long") ;
+            }
+            carry = n - blen ;
+        }
+
+        //----------------------------------------------------------------------
+        // split the chunk at line boundaries, one slice per thread
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads ((double) blen, chunk, nthreads_max) ;
+        Slice [0] = 0 ;
+        for (int tid = 1 ; tid < nthreads ; tid++)
+        {
+            int64_t s = GB_IMAX (GB_PART (tid, blen, nthreads),
+                GB_IMAX (Slice [tid-1], 1)) ;
+            while (s < (int64_t) blen && Buf [s-1] != '\n') s++ ;
+            Slice [tid] = s ;
+        }
+        Slice [nthreads] = blen ;
+
+        //----------------------------------------------------------------------
+        // count the entries in each slice
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t count = 0 ;
+            const char *s = Buf + Slice [tid] ;
+            const char *s_end = Buf + Slice [tid+1] ;
+            while (s < s_end)
+            {
+                while (GB_READ_BLANK (*s)) s++ ;
+                count += (*s != '\n' && *s != '%') ;
+                s = memchr (s, '\n', s_end - s) + 1 ;
+            }
+            Count [tid] = count ;
+        }
+
+        GB_cumsum (Count, nthreads, NULL, 1, NULL) ;
+        if (Count [nthreads] > ((int64_t) nz) - nvals)
+        {
+            GB_MM_ERROR ("too many entries") ;
+        }
+
+        //----------------------------------------------------------------------
+        // parse the entries in each slice
+        //----------------------------------------------------------------------
+
+        bool ok = true ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t k = nvals + Count [tid] ;
+            const char *s = Buf + Slice [tid] ;
+            const char *s_end = Buf + Slice [tid+1] ;
+
+            // for the array format: find the position (i,j) of entry k
+            int64_t i = 0, j = 0 ;
+            if (!coord)
+            {
+                int64_t t = k ;
+                while (j < (int64_t) ncols)
+                {
+                    int64_t colsize = nrows - GB_mm_first (j, symmetry) ;
+                    if (t < colsize) break ;
+                    t -= colsize ;
+                    j++ ;
+                }
+                i = GB_mm_first (j, symmetry) + t ;
+            }
+
+            while (s < s_end && ok)
+            {
+                while (GB_READ_BLANK (*s)) s++ ;
+                if (*s == '\n' || *s == '%')
+                {
+                    // skip a blank line or a comment
+                    s = memchr (s, '\n', s_end - s) + 1 ;
+                    continue ;
+                }
+
+                // get the indices of the entry
+                if (coord)
+                {
+                    uint64_t i1 = 0, j1 = 0 ;
+                    s = GB_read_uint64 (&i1, s) ;
+                    if (s != NULL) s = GB_read_uint64 (&j1, s) ;
+                    if (s == NULL || i1 == 0 || i1 > nrows || j1 == 0
+                        || j1 > ncols)
+                    {
+                        ok = false ;
+                        break ;
+                    }
+                    i = i1 - 1 ;
+                    j = j1 - 1 ;
+                }
+                I [k] = i ;
+                J [k] = j ;
+
+                // get the value of the entry
+                switch (kind)
+                {
+                    case GB_MM_REAL :
+                        s = GB_read_double (&(Xd [k]), s) ;
+                        break ;
+                    case GB_MM_INTEGER :
+                        s = GB_read_int64 (&(Xi [k]), s) ;
+                        break ;
+                    case GB_MM_COMPLEX :
+                        s = GB_read_double (&(Xd [2*k]), s) ;
+                        if (s != NULL) s = GB_read_double (&(Xd [2*k+1]), s) ;
+                        break ;
+                    default : // GB_MM_PATTERN
+                        break ;
+                }
+
+                // the rest of the line must be blank
+                if (s != NULL) while (GB_READ_BLANK (*s)) s++ ;
+                if (s == NULL || *s != '\n')
+                {
+                    ok = false ;
+                    break ;
+                }
+                s++ ;
+                k++ ;
+
+                // for the array format: advance to the next position
+                if (!coord && ++i >= (int64_t) nrows)
+                {
+                    j++ ;
+                    i = GB_mm_first (j, symmetry) ;
+                }
+            }
+        }
+
+        if (!ok)
+        {
+            GB_MM_ERROR ("invalid entry") ;
+        }
+        nvals += Count [nthreads] ;
+
+        //----------------------------------------------------------------------
+        // move the partial last line to the start of the buffer
+        //----------------------------------------------------------------------
+
+        memmove (Buf, Buf + blen, carry) ;
+    }
+
+    if (nvals != (int64_t) nz)
+    {
+        GB_MM_ERROR ("too few entries") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // add the upper triangular part, if the matrix is symmetric
+    //--------------------------------------------------------------------------
+
+    if (symmetry != GB_MM_GENERAL && nvals > 0)
+    {
+        // count the off-diagonal entries in each slice of the tuples
+        int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend, count = 0 ;
+            GB_PARTITION (kstart, kend, nvals, tid, nthreads) ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                count += (I [k] != J [k]) ;
+            }
+            Count [tid] = count ;
+        }
+        GB_cumsum (Count, nthreads, NULL, 1, NULL) ;
+
+        // mirror each off-diagonal entry (i,j) into (j,i)
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kstart, kend, t = nvals + Count [tid] ;
+            GB_PARTITION (kstart, kend, nvals, tid, nthreads) ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                if (I [k] == J [k]) continue ;
+                I [t] = J [k] ;
+                J [t] = I [k] ;
+                switch (kind)
+                {
+                    case GB_MM_REAL :
+                        Xd [t] = (symmetry == GB_MM_SKEW) ? (-Xd [k]) : Xd [k];
+                        break ;
+                    case GB_MM_INTEGER :
+                        Xi [t] = (symmetry == GB_MM_SKEW) ? (-Xi [k]) : Xi [k];
+                        break ;
+                    case GB_MM_COMPLEX :
+                        Xd [2*t  ] = (symmetry == GB_MM_SKEW) ?
+                            (-Xd [2*k  ]) : Xd [2*k] ;
+                        Xd [2*t+1] = (symmetry == GB_MM_SYMMETRIC) ?
+                            Xd [2*k+1] : (-Xd [2*k+1]) ;
+                        break ;
+                    default : // GB_MM_PATTERN
+                        break ;
+                }
+                t++ ;
+            }
+        }
+        nvals += Count [nthreads] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // build the matrix
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    bool one = true ;
+    return (GB_read_build (C_handle, ctype, nrows, ncols, &I, &I_size, &J,
+        &J_size, &X, &X_size, (GB_void *) &one, ijslen, nvals, xtype,
+        Context)) ;
+}
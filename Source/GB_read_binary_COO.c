@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// GB_read_binary_COO: read a matrix from a binary list of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GxB_Matrix_read_binary_COO
+// CALLS:     GB_read_build
+
+// The file holds a list of records, from the current position of f to the end
+// of the file, with no header.  Each record is a tuple (i,j,x): the 0-based
+// row index i and column index j, each of index_size bytes (4 or 8, unsigned
+// integers in the byte order of this machine), followed by the value x, of
+// type->size bytes.  If type is NULL, the records hold just (i,j), and C is
+// an iso GrB_BOOL matrix with all entries equal to true.  Duplicates are
+// permitted; the last one in the file is kept.
+
+// The records are read in large chunks with fread, and each chunk is decoded
+// in parallel into the tuples (I,J,X), which are then passed to GB_read_build.
+// If the file is seekable, its size determines the number of tuples, and the
+// tuples are allocated just once.  Otherwise, their size is doubled as needed.
+
+#include "GB.h"
+#include "GB_read.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Buf, Buf_size) ;             \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_FREE (&I, I_size) ;                      \
+    GB_FREE (&J, J_size) ;                      \
+    GB_FREE (&X, X_size) ;                      \
+}
+
+GrB_Info GB_read_binary_COO         // read a binary COO file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type type,                  // type of C and of the values in the file
+    GrB_Index nrows,                // # of rows of C
+    GrB_Index ncols,                // # of columns of C
+    int index_size,                 // size of each index (4 or 8 bytes)
+    FILE *f,                        // file to read
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C_handle != NULL) ;
+    ASSERT (f != NULL) ;
+    ASSERT (index_size == 4 || index_size == 8) ;
+    ASSERT (nrows <= GB_NMAX && ncols <= GB_NMAX) ;
+    (*C_handle) = NULL ;
+
+    char *Buf = NULL ; size_t Buf_size = 0 ;
+    int64_t *I = NULL ; size_t I_size = 0 ;
+    int64_t *J = NULL ; size_t J_size = 0 ;
+    GB_void *X = NULL ; size_t X_size = 0 ;
+
+    bool iso = (type == NULL) ;
+    GrB_Type xtype = (iso) ? GrB_BOOL : type ;
+    size_t xsize = (iso) ? 0 : xtype->size ;
+    size_t rsize = 2 * index_size + xsize ;     // size of each record
+
+    //--------------------------------------------------------------------------
+    // determine the number of records, if the file is seekable
+    //--------------------------------------------------------------------------
+
+    int64_t ijslen = 0 ;
+    long here = ftell (f) ;
+    if (here >= 0 && fseek (f, 0, SEEK_END) == 0)
+    {
+        long end = ftell (f) ;
+        if (fseek (f, here, SEEK_SET) != 0)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "binary COO file: %s",
+                "seek failed") ;
+        }
+        if (end > here)
+        {
+            ijslen = (end - here) / rsize ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples and workspace
+    //--------------------------------------------------------------------------
+
+    // each chunk holds a whole number of records
+    size_t chunk_records = GB_IMAX (GB_READ_CHUNK / rsize, 1) ;
+    ijslen = GB_IMAX (ijslen, 1) ;
+    I = GB_MALLOC (ijslen, int64_t, &I_size) ;
+    J = GB_MALLOC (ijslen, int64_t, &J_size) ;
+    if (!iso)
+    {
+        X = GB_MALLOC (ijslen * xsize, GB_void, &X_size) ;
+    }
+    Buf = GB_MALLOC_WORK (chunk_records * rsize, char, &Buf_size) ;
+    if (I == NULL || J == NULL || (!iso && X == NULL) || Buf == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    //--------------------------------------------------------------------------
+    // read the records, one chunk at a time
+    //--------------------------------------------------------------------------
+
+    int64_t nvals = 0 ;
+    bool eof = false ;
+    while (!eof)
+    {
+
+        //----------------------------------------------------------------------
+        // read the next chunk
+        //----------------------------------------------------------------------
+
+        size_t n = fread (Buf, 1, chunk_records * rsize, f) ;
+        eof = (n < chunk_records * rsize) ;
+        if (eof && (ferror (f) || n % rsize != 0))
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "binary COO file: %s",
+                "read error or partial record") ;
+        }
+        int64_t nrec = n / rsize ;
+        if (nrec == 0) break ;
+
+        //----------------------------------------------------------------------
+        // ensure the tuples are large enough
+        //----------------------------------------------------------------------
+
+        if (nvals + nrec > ijslen)
+        {
+            int64_t newlen = GB_IMAX (2 * ijslen, nvals + nrec) ;
+            bool ok1 = true, ok2 = true, ok3 = true ;
+            GB_REALLOC (I, newlen, int64_t, &I_size, &ok1, Context) ;
+            GB_REALLOC (J, newlen, int64_t, &J_size, &ok2, Context) ;
+            if (!iso)
+            {
+                GB_REALLOC (X, newlen * xsize, GB_void, &X_size, &ok3,
+                    Context) ;
+            }
+            if (!ok1 || !ok2 || !ok3)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            ijslen = newlen ;
+        }
+
+        //----------------------------------------------------------------------
+        // decode the records in parallel
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads ((double) n, chunk, nthreads_max) ;
+        bool ok = true ;
+        int64_t r ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:ok)
+        for (r = 0 ; r < nrec ; r++)
+        {
+            const char *rec = Buf + r * rsize ;
+            uint64_t i, j ;
+            if (index_size == 4)
+            {
+                uint32_t i32, j32 ;
+                memcpy (&i32, rec, 4) ;
+                memcpy (&j32, rec + 4, 4) ;
+                i = i32 ;
+                j = j32 ;
+            }
+            else
+            {
+                memcpy (&i, rec, 8) ;
+                memcpy (&j, rec + 8, 8) ;
+            }
+            ok = ok && (i < nrows) && (j < ncols) ;
+            int64_t k = nvals + r ;
+            I [k] = (int64_t) i ;
+            J [k] = (int64_t) j ;
+            if (!iso)
+            {
+                memcpy (X + k * xsize, rec + 2 * index_size, xsize) ;
+            }
+        }
+
+        if (!ok)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS, "binary COO file: %s",
+                "index out of bounds") ;
+        }
+        nvals += nrec ;
+    }
+
+    //--------------------------------------------------------------------------
+    // build the matrix
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    bool one = true ;
+    return (GB_read_build (C_handle, xtype, nrows, ncols, &I, &I_size, &J,
+        &J_size, &X, &X_size, (GB_void *) &one, ijslen, nvals, xtype,
+        Context)) ;
+}
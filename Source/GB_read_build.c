@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// GB_read_build: build a matrix from tuples read from a file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// CALLED BY: GB_read_MatrixMarket, GB_read_binary_COO
+// CALLS:     GB_builder
+
+// The tuples (I,J,X) have been parsed from a file into workspace owned by the
+// caller.  The indices have already been checked.  The workspace is passed
+// to GB_builder, which either transplants it into the new matrix or frees it,
+// so no copy of the tuples is made.  Duplicates are permitted, and the last
+// one in the file is kept, as the implicit SECOND operator used by GB_wait.
+
+// If X is NULL, all tuples have the value iso_value, and C is built as iso.
+// The tuples are typecast from xtype into ctype, if they differ.
+
+#include "GB_build.h"
+#include "GB_read.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (I_handle, *I_size_handle) ;\
+    GB_FREE (J_handle, *J_size_handle) ;\
+    GB_FREE (X_handle, *X_size_handle) ;\
+    GB_phbix_free (T) ;                 \
+    GB_Matrix_free (&C) ;               \
+}
+
+GrB_Info GB_read_build              // build a matrix from tuples read from a file
+(
+    GrB_Matrix *C_handle,           // matrix to create
+    GrB_Type ctype,                 // type of C
+    int64_t nrows,                  // # of rows of C
+    int64_t ncols,                  // # of columns of C
+    int64_t **I_handle,             // row indices of the tuples, size ijslen
+    size_t *I_size_handle,
+    int64_t **J_handle,             // column indices of the tuples, size ijslen
+    size_t *J_size_handle,
+    GB_void **X_handle,             // values of the tuples, or NULL if iso
+    size_t *X_size_handle,
+    const GB_void *iso_value,       // value of all tuples if X is NULL
+    int64_t ijslen,                 // allocated size of I and J
+    int64_t nvals,                  // # of tuples
+    GrB_Type xtype,                 // type of X or iso_value
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+
+    ASSERT (C_handle != NULL) ;
+    ASSERT_TYPE_OK (ctype, "ctype for read build", GB0) ;
+    ASSERT_TYPE_OK (xtype, "xtype for read build", GB0) ;
+    ASSERT (GB_Type_compatible (ctype, xtype)) ;
+    bool S_iso = ((*X_handle) == NULL) ;
+    ASSERT (GB_IMPLIES (S_iso, iso_value != NULL)) ;
+    (*C_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the header of C
+    //--------------------------------------------------------------------------
+
+    // the format of C is determined just as GrB_Matrix_new
+    bool is_csc ;
+    if (ncols == 1)
+    {
+        // n-by-1 matrices are always held by column, including 1-by-1
+        is_csc = true ;
+    }
+    else if (nrows == 1)
+    {
+        // 1-by-n matrices (except 1-by-1) are always held by row
+        is_csc = false ;
+    }
+    else
+    {
+        // m-by-n (including 0-by-0) with m != and n != use the global setting
+        is_csc = GB_Global_is_csc_get ( ) ;
+    }
+
+    int64_t vlen = (is_csc) ? nrows : ncols ;
+    int64_t vdim = (is_csc) ? ncols : nrows ;
+    GB_OK (GB_new (&C, // auto sparsity, new header
+        ctype, vlen, vdim, GB_Ap_null, is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 0, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // build the matrix T, of type xtype
+    //--------------------------------------------------------------------------
+
+    // For a CSC matrix, the row indices I are the indices within each vector,
+    // and the column indices J are the vector indices.  These are swapped for
+    // a CSR matrix.  T is iso if and only if X is NULL.
+
+    GB_OK (GB_builder (
+        T,                      // create T using a static header
+        xtype,                  // the type of T
+        vlen,                   // T->vlen
+        vdim,                   // T->vdim
+        is_csc,                 // T has the same CSR/CSC format as C
+        (is_csc) ? I_handle : J_handle,             // freed or put in T->i
+        (is_csc) ? I_size_handle : J_size_handle,
+        (is_csc) ? J_handle : I_handle,             // freed on output
+        (is_csc) ? J_size_handle : I_size_handle,
+        X_handle,               // X, freed or put in T->x; or NULL if iso
+        X_size_handle,
+        false,                  // known_sorted: not yet known
+        false,                  // known_no_duplicates: not yet known
+        ijslen,                 // size of I and J
+        true,                   // is_matrix
+        NULL, NULL,             // original I,J tuples: not used
+        S_iso ? iso_value : NULL,   // iso value, or NULL if X is used
+        S_iso,                  // true if the tuples are iso
+        nvals,                  // # of tuples
+        NULL,                   // SECOND: keep the last duplicate
+        xtype,                  // the type of X
+        Context
+    )) ;
+
+    //--------------------------------------------------------------------------
+    // determine if T is iso
+    //--------------------------------------------------------------------------
+
+    if (!S_iso && GB_iso_check (T, Context))
+    {
+        // All entries in T are the same; convert T to iso
+        GBURBLE ("(post iso) ") ;
+        T->iso = true ;
+        GB_OK (GB_convert_any_to_iso (T, NULL, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, conform C, and free T
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transplant_conform (C, ctype, &T, Context)) ;
+    ASSERT_MATRIX_OK (C, "C read from file", GB0) ;
+    (*C_handle) = C ;
+    return (GrB_SUCCESS) ;
+}
@@ -113,32 +113,10 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
     void *pnew = NULL ;
     size_t newsize_allocated = GB_IMAX (newsize, 8) ;
     int k = GB_CEIL_LOG2 (newsize_allocated) ;
-    if (!GB_Global_have_realloc_function ( ) ||
-        (GB_Global_free_pool_limit_get (k) > 0))
-    {
-
-        //----------------------------------------------------------------------
-        // use malloc/memcpy/free
-        //----------------------------------------------------------------------
+    bool use_realloc = GB_Global_have_realloc_function ( ) &&
+        (GB_Global_free_pool_limit_get (k) == 0) && !GB_Global_spill_find (p) ;
 
-        // Either no realloc function is provided, or the new block will fit in
-        // the free_pool and so must be rounded up to a power of 2.  This is
-        // done by GB_malloc_memory, which allocates a new block or gets it
-        // from the free_pool if one exists of that size.
-
-        // allocate the new space
-        pnew = GB_malloc_memory (nitems_new, size_of_item, &newsize_allocated) ;
-        // copy over the data from the old block to the new block
-        if (pnew != NULL)
-        { 
-            // copy from the old to new with a parallel memcpy
-            GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
-            GB_memcpy (pnew, p, GB_IMIN (oldsize, newsize), nthreads_max) ;
-            // free the old block (either hard free, or return to free_pool)
-            GB_dealloc_memory (&p, oldsize_allocated) ;
-        }
-    }
-    else
+    if (use_realloc)
     {
 
         //----------------------------------------------------------------------
@@ -153,17 +131,71 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
         {
             pretend_to_fail = GB_Global_malloc_debug_count_decrement ( ) ;
         }
-        if (!pretend_to_fail)
+        // charge the change in size to the memory budgets of the process and
+        // the engaged GxB_Context, which fails if a budget would be exceeded
+        int64_t delta = (int64_t) newsize_allocated
+                      - (int64_t) oldsize_allocated ;
+        if (!pretend_to_fail && GB_Global_memory_add (delta, true))
         { 
             #ifdef GB_MEMDUMP
             printf ("hard realloc %p oldsize %ld newsize %ld\n",
                 p, oldsize_allocated, newsize_allocated) ;
             #endif
             pnew = GB_Global_realloc_function (p, newsize_allocated) ;
+            if (pnew == NULL)
+            { 
+                // the block is unchanged
+                GB_Global_memory_add (-delta, false) ;
+            }
+            else if (newsize_allocated > oldsize_allocated)
+            { 
+                // count the growth of the block for the telemetry
+                GB_Global_telemetry_bytes_add (delta) ;
+                // back the larger block with huge pages, if requested
+                size_t threshold = GB_Global_huge_page_threshold_get ( ) ;
+                if (threshold > 0 && newsize_allocated >= threshold)
+                { 
+                    GB_huge_page_advise (pnew, newsize_allocated) ;
+                }
+            }
             #ifdef GB_MEMDUMP
             GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
             #endif
         }
+        if (pnew == NULL && !pretend_to_fail &&
+            GB_Global_spill_ok (newsize_allocated))
+        { 
+            // out of memory, or over budget, but the old block is unchanged:
+            // use malloc/memcpy/free instead, which can spill the new block
+            // to a file
+            use_realloc = false ;
+        }
+    }
+
+    if (!use_realloc)
+    {
+
+        //----------------------------------------------------------------------
+        // use malloc/memcpy/free
+        //----------------------------------------------------------------------
+
+        // Either no realloc function is provided, or the new block will fit in
+        // the free_pool and so must be rounded up to a power of 2, or the old
+        // or new block is spilled to a file.  This is done by
+        // GB_malloc_memory, which allocates a new block or gets it from the
+        // free_pool if one exists of that size.
+
+        // allocate the new space
+        pnew = GB_malloc_memory (nitems_new, size_of_item, &newsize_allocated) ;
+        // copy over the data from the old block to the new block
+        if (pnew != NULL)
+        { 
+            // copy from the old to new with a parallel memcpy
+            GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+            GB_memcpy (pnew, p, GB_IMIN (oldsize, newsize), nthreads_max) ;
+            // free the old block (either hard free, or return to free_pool)
+            GB_dealloc_memory (&p, oldsize_allocated) ;
+        }
     }
 
     //--------------------------------------------------------------------------
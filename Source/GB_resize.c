@@ -80,6 +80,9 @@ GrB_Info GB_resize              // change the size of a matrix
 
     ASSERT (!GB_JUMBLED (A)) ;
 
+    // A is modified in-place, so it must own all of its content
+    GB_OK (GB_unshallow (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // resize the matrix
     //--------------------------------------------------------------------------
@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GB_same_pattern: determine if A and B are known to have the same pattern
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if A and B are known to have the same pattern, either because
+// A == B, because both are full, or because their hyperlists, vector pointers,
+// and row indices are aliased to each other.  A false result does not mean the
+// patterns differ, since only aliases are checked, not the content of the
+// patterns.  Bitmap matrices, and matrices with pending work, are never
+// reported as having the same pattern.
+
+#include "GB.h"
+
+GB_PUBLIC
+bool GB_same_pattern        // true if A and B are known to have same pattern
+(
+    GrB_Matrix A,           // input A matrix
+    GrB_Matrix B            // input B matrix
+)
+{
+
+    if (A == NULL || B == NULL)
+    { 
+        // this is not an error condition
+        return (false) ;
+    }
+
+    if (GB_ANY_PENDING_WORK (A) || GB_ANY_PENDING_WORK (B) ||
+        GB_IS_BITMAP (A) || GB_IS_BITMAP (B) ||
+        A->vlen != B->vlen || A->vdim != B->vdim)
+    { 
+        return (false) ;
+    }
+
+    if (A == B || (GB_IS_FULL (A) && GB_IS_FULL (B)))
+    { 
+        return (true) ;
+    }
+
+    return (A->nvec == B->nvec && A->h == B->h &&
+        A->p != NULL && A->p == B->p && A->i != NULL && A->i == B->i) ;
+}
+
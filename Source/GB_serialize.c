@@ -127,12 +127,14 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     int32_t algo, level ;
-    GB_serialize_method (&algo, &level, method) ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s:%d) ",
+    GBURBLE ("(compression: %s%s%s:%d%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
-        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "", level) ;
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "", level,
+        delta ? "+delta" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
@@ -194,27 +196,27 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
         &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
         &Ap_compressed_size, dryrun,
-        (GB_void *) A->p, Ap_len, method, algo, level, Context)) ;
+        (GB_void *) A->p, Ap_len, method, algo, level, delta, Context)) ;
 
     GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
         &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
         &Ah_compressed_size, dryrun,
-        (GB_void *) A->h, Ah_len, method, algo, level, Context)) ;
+        (GB_void *) A->h, Ah_len, method, algo, level, delta, Context)) ;
 
     GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
         &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
         &Ab_compressed_size, dryrun,
-        (GB_void *) A->b, Ab_len, method, algo, level, Context)) ;
+        (GB_void *) A->b, Ab_len, method, algo, level, false, Context)) ;
 
     GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
         &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
         &Ai_compressed_size, dryrun,
-        (GB_void *) A->i, Ai_len, method, algo, level, Context)) ;
+        (GB_void *) A->i, Ai_len, method, algo, level, delta, Context)) ;
 
     GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
         &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
         &Ax_compressed_size, dryrun,
-        (GB_void *) A->x, Ax_len, method, algo, level, Context)) ;
+        (GB_void *) A->x, Ax_len, method, algo, level, false, Context)) ;
 
     //--------------------------------------------------------------------------
     // determine the size of the blob
@@ -351,6 +353,16 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
 
     ASSERT (s == blob_size_required) ;
 
+    // the user application frees the blob with its own free function, so it
+    // cannot be left in a memory-mapped file
+    if (!preallocated_blob &&
+        !GB_spill_unspill ((void **) &blob, blob_size_allocated))
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
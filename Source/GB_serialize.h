@@ -26,6 +26,7 @@ void GB_serialize_method
     // output
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
+    bool *delta,                    // if true, delta+varint encode Ap, Ah, Ai
     // input
     int32_t method
 ) ;
@@ -38,6 +39,19 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
     size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, C may be shallow in the blob
+    GxB_serialize_read_function reader, // if not NULL, read C from a stream
+    void *stream,                   // stream for the reader
+    GB_Context Context
+) ;
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_serialize_write_function writer,    // function to write the blob
+    void *stream,                   // stream for the writer
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
     GB_Context Context
 ) ;
 
@@ -66,6 +80,8 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    bool delta,                         // if true, X is int64_t, and is delta
+                                        // and varint encoded before compression
     GB_Context Context
 ) ;
 
@@ -94,6 +110,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X is a shallow pointer into blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -101,19 +118,23 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    bool shallow,               // if true, X may be returned as shallow
+    size_t X_align,             // required alignment of X if shallow
+    GxB_serialize_read_function reader, // if not NULL, read X from a stream
+    void *stream,               // stream for the reader
     // input/output:
     size_t *s_handle,           // where to read from the blob
     GB_Context Context
 ) ;
 
-#define GB_BLOB_HEADER_SIZE \
+#define GB_BLOB_HEADER_SIZE (                                              \
     sizeof (size_t)             /* blob_size                            */ \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */ \
                                 /* nvals, typesize, A[phbix]_len        */ \
     + 14 * sizeof (int32_t)     /* version, typecode, sparsity_control, */ \
                                 /* A[phbix]_nblocks, A[phbix]_method,   */ \
                                 /* sparsity_iso_csc                     */ \
-    + 2 * sizeof (float)        /* hyper_switch, bitmap_switch          */
+    + 2 * sizeof (float))       /* hyper_switch, bitmap_switch          */
 
 // write a scalar to the blob
 #define GB_BLOB_WRITE(x,type) \
@@ -137,5 +158,76 @@ GrB_Info GB_deserialize_from_blob
 #define GB_BLOB_READS(S,n) \
     int64_t *S = (int64_t *) (blob + s) ; s += n * sizeof (int64_t) ;
 
+//------------------------------------------------------------------------------
+// delta + varint encoding of the integer arrays Ap, Ah, and Ai
+//------------------------------------------------------------------------------
+
+// With GxB_COMPRESSION_DELTA, each block of Ap, Ah, and Ai is transformed
+// before it is compressed with LZ4 or LZ4HC.  Each entry is replaced with its
+// difference from the prior entry in the same block (the first entry of each
+// block is kept as-is, so the blocks can be decoded in parallel), and the
+// differences are written in zigzag varint form: 7 bits per byte, low bits
+// first, with the high bit of each byte set if more bytes follow.  The
+// entries of Ap and Ah are increasing, and the entries of Ai are increasing
+// within each vector, so most differences take one or two bytes.
+
+// upper bound on the size of n encoded entries
+#define GB_DELTA_BOUND(n) (10 * (size_t) (n))
+
+// encode Src [0:n-1] into Dst, of size at least GB_DELTA_BOUND (n), and return
+// the # of bytes written to Dst
+static inline size_t GB_delta_encode
+(
+    uint8_t *restrict Dst,
+    const int64_t *restrict Src,
+    int64_t n
+)
+{
+    size_t s = 0 ;
+    int64_t last = 0 ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        int64_t d = (int64_t) ((uint64_t) Src [k] - (uint64_t) last) ;
+        last = Src [k] ;
+        uint64_t z = ((uint64_t) d << 1) ^ (uint64_t) (d >> 63) ;
+        while (z >= 0x80)
+        {
+            Dst [s++] = (uint8_t) (z | 0x80) ;
+            z >>= 7 ;
+        }
+        Dst [s++] = (uint8_t) z ;
+    }
+    return (s) ;
+}
+
+// decode Src [0:size-1] into Dst [0:n-1], and return true if Src holds exactly
+// n encoded entries
+static inline bool GB_delta_decode
+(
+    int64_t *restrict Dst,
+    int64_t n,
+    const uint8_t *restrict Src,
+    size_t size
+)
+{
+    size_t s = 0 ;
+    int64_t last = 0 ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        uint64_t z = 0 ;
+        for (int shift = 0 ; ; shift += 7)
+        {
+            if (s >= size || shift > 63) return (false) ;
+            uint8_t c = Src [s++] ;
+            z |= ((uint64_t) (c & 0x7F)) << shift ;
+            if (c < 0x80) break ;
+        }
+        int64_t d = (int64_t) (z >> 1) ^ -((int64_t) (z & 1)) ;
+        last = (int64_t) ((uint64_t) last + (uint64_t) d) ;
+        Dst [k] = last ;
+    }
+    return (s == size) ;
+}
+
 #endif
 
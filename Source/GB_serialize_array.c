@@ -11,12 +11,17 @@
 // a sequence of independently allocated blocks, or returned as-is if not
 // compressed.  Currently, only LZ4 is supported.
 
+// If delta is true, X is an int64_t array (Ap, Ah, or Ai), and each block is
+// delta and varint encoded (see GB_delta_encode) before it is compressed.  In
+// this case, the array is partitioned into blocks by entries, not bytes.
+
 #include "GB.h"
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 
 #define GB_FREE_ALL                                                     \
 {                                                                       \
+    GB_FREE_WORK (&W, W_size) ;                                         \
     GB_FREE (&Sblocks, Sblocks_size) ;                                  \
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks, Context) ; \
 }
@@ -39,6 +44,8 @@ GrB_Info GB_serialize_array
     int32_t method,                     // compression method requested
     int32_t algo,                       // compression algorithm
     int32_t level,                      // compression level
+    bool delta,                         // if true, X is int64_t, and is delta
+                                        // and varint encoded before compression
     GB_Context Context
 )
 {
@@ -59,6 +66,7 @@ GrB_Info GB_serialize_array
     size_t Blocks_size = 0, Sblocks_size = 0 ;
     int32_t nblocks = 0 ;
     int64_t *Sblocks = NULL ;
+    uint8_t *W = NULL ; size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // check for quick return
@@ -114,7 +122,7 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
-    (*method_used) = method ;
+    (*method_used) = method + (delta ? GxB_COMPRESSION_DELTA : 0) ;
 
     //--------------------------------------------------------------------------
     // determine # of threads to use
@@ -142,6 +150,11 @@ GrB_Info GB_serialize_array
     nthreads = GB_IMIN (nthreads, nblocks) ;
     (*nblocks_handle) = nblocks ;
 
+    // the blocks partition the bytes of X, or its entries if delta is true
+    ASSERT (!delta || len % sizeof (int64_t) == 0) ;
+    int64_t n = (delta) ? (len / sizeof (int64_t)) : len ;
+    const int64_t *restrict X64 = (const int64_t *) X ;
+
     // allocate the output Blocks: one per block plus the sentinel block
     if (!dryrun)
     {
@@ -155,15 +168,44 @@ GrB_Info GB_serialize_array
         }
     }
 
-    // allocate the blocks, one at a time
+    //--------------------------------------------------------------------------
+    // delta and varint encode the blocks in parallel, if requested
+    //--------------------------------------------------------------------------
+
     int32_t blockid ;
+    if (delta && !dryrun)
+    {
+        W = GB_MALLOC_WORK (GB_DELTA_BOUND (n), uint8_t, &W_size) ;
+        if (W == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+        for (blockid = 0 ; blockid < nblocks ; blockid++)
+        { 
+            // encode X [kstart:kend-1] into W [GB_DELTA_BOUND (kstart):...],
+            // and temporarily save the size of the encoded block in Sblocks
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, blockid, nblocks) ;
+            Sblocks [blockid] = (int64_t) GB_delta_encode (
+                W + GB_DELTA_BOUND (kstart), X64 + kstart, kend - kstart) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the blocks, one at a time
+    //--------------------------------------------------------------------------
+
     bool ok = true ;
     for (blockid = 0 ; blockid < nblocks && ok ; blockid++)
     { 
         // allocate a single block for the compression of X [kstart:kend-1]
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
-        size_t uncompressed = kend - kstart ;
+        GB_PARTITION (kstart, kend, n, blockid, nblocks) ;
+        size_t uncompressed = (!delta) ? (kend - kstart) :
+            (dryrun ? GB_DELTA_BOUND (kend - kstart) : Sblocks [blockid]) ;
         ASSERT (uncompressed < INT32_MAX) ;
         ASSERT (uncompressed > 0) ;
         size_t s = (size_t) LZ4_compressBound ((int) uncompressed) ;
@@ -208,12 +250,16 @@ GrB_Info GB_serialize_array
         reduction(&&:ok)
     for (blockid = 0 ; blockid < nblocks ; blockid++)
     {
-        // compress X [kstart:kend-1] into Blocks [blockid].p
+        // compress X [kstart:kend-1] (or its encoding in W) into
+        // Blocks [blockid].p
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
-        const char *src = (const char *) (X + kstart) ;     // source
+        GB_PARTITION (kstart, kend, n, blockid, nblocks) ;
+        const char *src = (delta) ?
+            ((const char *) (W + GB_DELTA_BOUND (kstart))) :
+            ((const char *) (X + kstart)) ;                 // source
         char *dst = (char *) Blocks [blockid].p ;           // destination
-        int srcSize = (int) (kend - kstart) ;               // size of source
+        int srcSize = (int) ((delta) ? Sblocks [blockid] :
+            (kend - kstart)) ;                              // size of source
         size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
         int dstCapacity = GB_IMIN (dsize, INT32_MAX) ;
         int s ;
@@ -244,6 +290,7 @@ GrB_Info GB_serialize_array
     //--------------------------------------------------------------------------
 
     GB_cumsum (Sblocks, nblocks, NULL, 1, Context) ;
+    GB_FREE_WORK (&W, W_size) ;
 
     //--------------------------------------------------------------------------
     // free workspace return result
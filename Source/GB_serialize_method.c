@@ -15,6 +15,7 @@ void GB_serialize_method
     // output
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
+    bool *delta,                    // if true, delta+varint encode Ap, Ah, Ai
     // input
     int32_t method
 )
@@ -25,9 +26,15 @@ void GB_serialize_method
         // no compression if method is negative
         (*algo) = GxB_COMPRESSION_NONE ;
         (*level) = 0 ;
+        (*delta) = false ;
         return ;
     }
 
+    // GxB_COMPRESSION_DELTA may be added to any method (the Intel setting,
+    // GxB_COMPRESSION_INTEL, is ignored since it is not yet supported)
+    (*delta) = ((method / GxB_COMPRESSION_DELTA) % 10 == 1) ;
+    method = method % GxB_COMPRESSION_DELTA ;
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
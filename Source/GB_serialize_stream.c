@@ -0,0 +1,470 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A parallel compression method for a GrB_Matrix, which passes the blob in
+// order, one piece at a time, to a user-provided writer function, instead of
+// constructing the entire blob in memory (as GB_serialize does).  The blob
+// has the same format as the one constructed by GB_serialize, and it can be
+// read by GB_deserialize, either from memory or from a stream.
+
+// The blob header holds the compressed size of each block of each array, and
+// it must be written before any of the compressed blocks.  To avoid holding
+// the entire compressed matrix in memory, each compressed array is compressed
+// twice, in batches of at most nthreads blocks each: once to find the size of
+// each compressed block (pass 1, before the header is written), and again to
+// write its blocks to the stream (pass 2, after the header).  Each block has
+// at most GB_STREAM_BLOCKSIZE bytes (uncompressed), so the workspace is at
+// most nthreads * LZ4_compressBound (GB_STREAM_BLOCKSIZE) bytes in size (a
+// little more with GxB_COMPRESSION_DELTA, which also needs space for each
+// encoded block).  An array that is not compressed is passed to the writer
+// as-is, with no copy.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+
+#define GB_STREAM_BLOCKSIZE (1024*1024)
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORK (&W, W_size) ;                     \
+    GB_FREE (&H, H_size) ;                          \
+    for (int k = 0 ; k < 5 ; k++)                   \
+    {                                               \
+        GB_FREE (&(Sblocks [k]), Sblocks_size [k]) ;\
+    }                                               \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_array: compress an array, and optionally write it to the stream
+//------------------------------------------------------------------------------
+
+// If writer is NULL (pass 1), the array X is compressed in batches of
+// nthreads blocks each, to find the size of each compressed block, which is
+// returned in Sblocks [0:nblocks-1].  Otherwise (pass 2), the array is
+// compressed again, and each batch of compressed blocks is written to the
+// stream, in order.  In this case, Sblocks [0:nblocks] must hold the
+// cumulative sum of the compressed block sizes, from pass 1.  Each block of W
+// holds a compressed block of size at most W_cap, followed by the delta and
+// varint encoding of the block, if delta is true.
+
+static GrB_Info GB_stream_array
+(
+    // input/output:
+    int64_t *restrict Sblocks,  // size of each compressed block
+    GB_void *restrict W,        // workspace of size nthreads * W_blocksize
+    // input:
+    size_t W_blocksize,         // size of each block of W
+    size_t W_cap,               // space for each compressed block in W
+    const GB_void *X,           // array to compress, of size len
+    int64_t len,                // size of X, in bytes
+    int32_t nblocks,            // # of blocks to use for X
+    int32_t algo,               // compression algorithm
+    int32_t level,              // compression level
+    bool delta,                 // if true, delta+varint encode each block
+    int nthreads,               // # of threads to use
+    GxB_serialize_write_function writer,    // NULL for pass 1
+    void *stream                // stream for the writer
+)
+{
+
+    // the blocks partition the bytes of X, or its entries if delta is true
+    int64_t n = (delta) ? (len / sizeof (int64_t)) : len ;
+    const int64_t *restrict X64 = (const int64_t *) X ;
+
+    bool ok = true ;
+    for (int32_t first = 0 ; first < nblocks ; first += nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // compress blocks first:last-1 into W, in parallel
+        //----------------------------------------------------------------------
+
+        int32_t last = GB_IMIN (first + nthreads, nblocks) ;
+        int32_t blockid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+            reduction(&&:ok)
+        for (blockid = first ; blockid < last ; blockid++)
+        {
+            // compress X [kstart:kend-1] into W [(blockid-first)*W_blocksize]
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, blockid, nblocks) ;
+            GB_void *Wblock = W + (blockid - first) * W_blocksize ;
+            const char *src = (const char *) (X + kstart) ;
+            char *dst = (char *) Wblock ;
+            int srcSize = (int) (kend - kstart) ;
+            int dstCapacity = (int) W_cap ;
+            if (delta)
+            { 
+                // encode the block, and compress its encoding instead
+                uint8_t *E = (uint8_t *) (Wblock + W_cap) ;
+                srcSize = (int) GB_delta_encode (E, X64 + kstart, kend-kstart);
+                src = (const char *) E ;
+            }
+            int s ;
+            switch (algo)
+            {
+                default :
+                case GxB_COMPRESSION_LZ4 :
+                    s = LZ4_compress_default (src, dst, srcSize, dstCapacity) ;
+                    break ;
+                case GxB_COMPRESSION_LZ4HC :
+                    s = LZ4_compress_HC (src, dst, srcSize, dstCapacity,
+                        level) ;
+                    break ;
+            }
+            if (writer == NULL)
+            {
+                // pass 1: save the size of the compressed block
+                ok = ok && (s > 0) ;
+                Sblocks [blockid] = (int64_t) s ;
+            }
+            else
+            {
+                // pass 2: the block must be the same size as in pass 1
+                ok = ok && (s > 0) &&
+                    (s == Sblocks [blockid+1] - Sblocks [blockid]) ;
+            }
+        }
+
+        if (!ok)
+        {
+            // compression failure: this can "never" occur
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // pass 2: write the compressed blocks first:last-1 to the stream
+        //----------------------------------------------------------------------
+
+        if (writer != NULL)
+        {
+            for (blockid = first ; blockid < last ; blockid++)
+            {
+                size_t s = Sblocks [blockid+1] - Sblocks [blockid] ;
+                if (!writer (stream, W + (blockid - first) * W_blocksize, s))
+                {
+                    // the writer has failed
+                    return (GrB_INSUFFICIENT_SPACE) ;
+                }
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_serialize_write_function writer,    // function to write the blob
+    void *stream,                   // stream for the writer
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (writer != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize_stream", GB0) ;
+
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    GB_void *H = NULL ; size_t H_size = 0 ;
+    int64_t *Sblocks [5] = { NULL, NULL, NULL, NULL, NULL } ;
+    size_t Sblocks_size [5] = { 0, 0, 0, 0, 0 } ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Context)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // determine maximum # of threads
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    bool delta ;
+    GB_serialize_method (&algo, &level, &delta, method) ;
+    method = algo + level ;
+    GBURBLE ("(stream compression: %s%s%s:%d%s) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "", level,
+        delta ? "+delta" : "") ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    // the matrix has no pending work
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+    GrB_Type atype = A->type ;
+    size_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // the arrays Ap, Ah, Ab, Ai, and Ax, in the order they appear in the blob
+    const GB_void *X [5] = { (GB_void *) A->p, (GB_void *) A->h,
+        (GB_void *) A->b, (GB_void *) A->i, (GB_void *) A->x } ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t X_len [5] = { 0, 0, 0, 0, 0 } ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            X_len [1] = sizeof (GrB_Index) * nvec ;
+        case GxB_SPARSE :
+            X_len [0] = sizeof (GrB_Index) * (nvec+1) ;
+            X_len [3] = sizeof (GrB_Index) * anz ;
+            X_len [4] = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            X_len [2] = sizeof (int8_t) * anz_held ;
+        case GxB_FULL :
+            X_len [4] = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the blocks for each array
+    //--------------------------------------------------------------------------
+
+    // only the integer arrays Ap, Ah, and Ai can be delta+varint encoded
+    bool X_delta [5] = { delta, delta, false, delta, false } ;
+    int32_t X_nblocks [5], X_method [5] ;
+    int nthreads_W = 1 ;
+    bool any_delta = false ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        int64_t len = X_len [k] ;
+        int32_t nblocks = 0 ;
+        X_method [k] = GxB_COMPRESSION_NONE ;
+        if (len == 0)
+        {
+            // the array is empty
+            nblocks = 0 ;
+        }
+        else if (algo == GxB_COMPRESSION_NONE || len < 256)
+        {
+            // no compression: the array is held in a single block
+            nblocks = 1 ;
+        }
+        else
+        {
+            // compress the array in blocks of at most GB_STREAM_BLOCKSIZE,
+            // and at least 64KB, with about 4 blocks per thread
+            int nthreads = GB_nthreads (len, chunk, nthreads_max) ;
+            int64_t blocksize = GB_ICEIL (len, 4*nthreads) ;
+            blocksize = GB_IMIN (blocksize, GB_STREAM_BLOCKSIZE) ;
+            blocksize = GB_IMAX (blocksize, (64*1024)) ;
+            nblocks = GB_ICEIL (len, blocksize) ;
+            nthreads_W = GB_IMAX (nthreads_W, GB_IMIN (nthreads, nblocks)) ;
+            X_method [k] = method + (X_delta [k] ? GxB_COMPRESSION_DELTA : 0);
+            any_delta = any_delta || X_delta [k] ;
+        }
+        X_nblocks [k] = nblocks ;
+        Sblocks [k] = GB_CALLOC (nblocks+1, int64_t, &(Sblocks_size [k])) ;
+        if (Sblocks [k] == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (nblocks == 1)
+        {
+            Sblocks [k][1] = len ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace for the compressed blocks
+    //--------------------------------------------------------------------------
+
+    // Each block of W holds a compressed block of size at most W_cap,
+    // followed by the delta+varint encoding of an int64_t block, if needed.
+    // A block of an int64_t array has at most GB_STREAM_BLOCKSIZE/8 + 1
+    // entries.
+    size_t W_enc = (any_delta) ?
+        GB_DELTA_BOUND (GB_STREAM_BLOCKSIZE / sizeof (int64_t) + 1) : 0 ;
+    size_t W_cap = (size_t) LZ4_compressBound (
+        (int) GB_IMAX (GB_STREAM_BLOCKSIZE, W_enc)) ;
+    size_t W_blocksize = W_cap + W_enc ;
+    W = GB_MALLOC_WORK (nthreads_W * W_blocksize, GB_void, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pass 1: find the size of each compressed block
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (X_method [k] != GxB_COMPRESSION_NONE)
+        {
+            int nthreads = GB_IMIN (nthreads_W, X_nblocks [k]) ;
+            GB_OK (GB_stream_array (Sblocks [k], W, W_blocksize, W_cap, X [k],
+                X_len [k], X_nblocks [k], algo, level, X_delta [k], nthreads,
+                NULL, NULL)) ;
+            GB_cumsum (Sblocks [k], X_nblocks [k], NULL, 1, Context) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the header, type_name, and Sblocks for each array
+    //--------------------------------------------------------------------------
+
+    size_t hsize = GB_BLOB_HEADER_SIZE
+        + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
+    size_t blob_size_required = hsize ;
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        hsize += X_nblocks [k] * sizeof (int64_t) ;
+        blob_size_required += X_nblocks [k] * sizeof (int64_t)
+            + Sblocks [k][X_nblocks [k]] ;
+    }
+
+    H = GB_MALLOC (hsize, GB_void, &H_size) ;
+    if (H == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // 160 bytes, plus 128 bytes for user-defined types, written to H
+    GB_void *blob = H ;
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+
+    GB_BLOB_WRITE (blob_size_required, size_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (X_len [0], int64_t) ;
+    GB_BLOB_WRITE (X_len [1], int64_t) ;
+    GB_BLOB_WRITE (X_len [2], int64_t) ;
+    GB_BLOB_WRITE (X_len [3], int64_t) ;
+    GB_BLOB_WRITE (X_len [4], int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_BLOB_WRITE (X_nblocks [k], int32_t) ;
+        GB_BLOB_WRITE (X_method [k], int32_t) ;
+    }
+
+    // 128 bytes, if present
+    if (typecode == GB_UDT_code)
+    {
+        // only copy the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    // 8 * (# blocks for Ap, Ah, Ab, Ai, Ax)
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        GB_BLOB_WRITES (Sblocks [k], X_nblocks [k]) ;
+    }
+    ASSERT (s == hsize) ;
+
+    //--------------------------------------------------------------------------
+    // write the header to the stream
+    //--------------------------------------------------------------------------
+
+    if (!writer (stream, H, hsize))
+    {
+        // the writer has failed
+        GB_FREE_ALL ;
+        return (GrB_INSUFFICIENT_SPACE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pass 2: write each array to the stream
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 5 ; k++)
+    {
+        if (X_nblocks [k] == 0)
+        {
+            // the array is empty; nothing to write
+            continue ;
+        }
+        else if (X_method [k] == GxB_COMPRESSION_NONE)
+        {
+            // write the uncompressed array as-is
+            if (!writer (stream, X [k], X_len [k]))
+            {
+                // the writer has failed
+                GB_FREE_ALL ;
+                return (GrB_INSUFFICIENT_SPACE) ;
+            }
+        }
+        else
+        {
+            // compress the array again, and write each block
+            int nthreads = GB_IMIN (nthreads_W, X_nblocks [k]) ;
+            GB_OK (GB_stream_array (Sblocks [k], W, W_blocksize, W_cap, X [k],
+                X_len [k], X_nblocks [k], algo, level, X_delta [k], nthreads,
+                writer, stream)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -79,6 +79,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (GB_PENDING_OK (C)) ;
     ASSERT (GB_ZOMBIES_OK (C)) ;
 
+    // C is modified in-place, so it must own all of its content
+    GB_OK (GB_unshallow (C, Context)) ;
+
     //--------------------------------------------------------------------------
     // sort C if needed; do not assemble pending tuples or kill zombies yet
     //--------------------------------------------------------------------------
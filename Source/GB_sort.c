@@ -344,6 +344,9 @@ GrB_Info GB_sort
         GB_OK (GB_convert_any_to_sparse (C, Context)) ;
     }
 
+    // C is sorted in-place, so it must own all of its content
+    GB_OK (GB_unshallow (C, Context)) ;
+
     //--------------------------------------------------------------------------
     // sort C in place
     //--------------------------------------------------------------------------
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+// GB_spill: spill large blocks of memory to memory-mapped temporary files
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If a spill directory has been set with GxB_set (GxB_SPILL_DIRECTORY, dir),
+// then a block of at least GxB_SPILL_THRESHOLD bytes that would exceed the
+// memory budget of the process (GxB_MEMORY_BUDGET) or of the engaged
+// GxB_Context, or that malloc cannot allocate, is instead placed in a
+// temporary file in that directory, mapped into memory with mmap.  The
+// operating system then pages the block to and from the file as needed, so
+// the method that allocates it runs more slowly but does not fail with
+// GrB_OUT_OF_MEMORY.  The file is unlinked as soon as it is created, so it is
+// deleted when the block is unmapped, or if the process terminates.
+
+// Spilled blocks are not charged to the memory budgets and are never placed
+// in the free_pool.  GB_dealloc_memory and GB_free_memory unmap them (they
+// must not be passed to the free function).  A spilled block that is handed
+// over to the user application (by GxB_*_export, GxB_*_unpack, and
+// GxB_Matrix_serialize), which will free it with its own free function, is
+// first moved into memory by GB_spill_unspill.
+
+#include "GB.h"
+#if defined ( __unix__ ) || defined ( __APPLE__ )
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#define GB_HAS_SPILL 1
+#else
+#define GB_HAS_SPILL 0
+#endif
+
+//------------------------------------------------------------------------------
+// GB_spill_directory_set: enable or disable spilling
+//------------------------------------------------------------------------------
+
+// If dir is NULL or empty, spilling is disabled.  Blocks already spilled are
+// not affected.
+
+GrB_Info GB_spill_directory_set (const char *dir)
+{
+    if (dir == NULL || dir [0] == '\0')
+    { 
+        GB_Global_spill_directory_set ("") ;
+        return (GrB_SUCCESS) ;
+    }
+    #if GB_HAS_SPILL
+    if (strlen (dir) >= GB_SPILL_PATH_MAX - 32 || access (dir, W_OK) != 0)
+    { 
+        // the path is too long, or the directory cannot be written
+        return (GrB_INVALID_VALUE) ;
+    }
+    GB_Global_spill_directory_set (dir) ;
+    return (GrB_SUCCESS) ;
+    #else
+    // mmap is not available
+    return (GrB_NOT_IMPLEMENTED) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_spill_malloc: allocate a block in a memory-mapped temporary file
+//------------------------------------------------------------------------------
+
+// The block is all zero.  NULL is returned if the file cannot be created, or
+// if the disk does not have room for the whole block.
+
+void *GB_spill_malloc (size_t size)
+{
+    void *p = NULL ;
+    #if GB_HAS_SPILL
+    char path [GB_SPILL_PATH_MAX] ;
+    snprintf (path, GB_SPILL_PATH_MAX, "%s/GraphBLAS_spill_XXXXXX",
+        GB_Global_spill_directory_get ( )) ;
+    int fd = mkstemp (path) ;
+    if (fd < 0)
+    { 
+        return (NULL) ;
+    }
+    unlink (path) ;
+    // reserve the disk space now, so that writing to the block later cannot
+    // fail (with SIGBUS) because the disk is full
+    if (posix_fallocate (fd, 0, (off_t) size) == 0)
+    {
+        p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) ;
+        if (p == MAP_FAILED)
+        { 
+            p = NULL ;
+        }
+    }
+    close (fd) ;
+    if (p != NULL && !GB_Global_spill_add (p, size))
+    { 
+        // too many blocks have been spilled
+        munmap (p, size) ;
+        p = NULL ;
+    }
+    if (p != NULL)
+    { 
+        GBURBLE ("(spill %g MB) ", ((double) size) / 1e6) ;
+        GB_Global_memtable_add (p, size) ;
+    }
+    #endif
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_spill_free: free a block if it has been spilled to a file
+//------------------------------------------------------------------------------
+
+// Returns true if p was a spilled block, which is now unmapped (and its file
+// deleted), or false if p is an ordinary block, which is not modified.
+
+bool GB_spill_free (void *p)
+{
+    size_t size = GB_Global_spill_remove (p) ;
+    if (size == 0)
+    { 
+        return (false) ;
+    }
+    #if GB_HAS_SPILL
+    munmap (p, size) ;
+    #endif
+    GB_Global_memtable_remove (p) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_spill_unspill: move a spilled block into memory
+//------------------------------------------------------------------------------
+
+// If *p has been spilled to a file, it is copied into a new block from the
+// malloc function given to GrB_init or GxB_init, and the file is deleted.
+// The size is the size of the block, as allocated.  Returns false if out of
+// memory, in which case *p is unchanged.
+
+bool GB_spill_unspill (void **p, size_t size)
+{
+    if (!GB_Global_spill_find (*p))
+    { 
+        // *p is an ordinary block
+        return (true) ;
+    }
+    void *pnew = GB_Global_malloc_function (size) ;
+    if (pnew == NULL)
+    { 
+        return (false) ;
+    }
+    GB_memcpy (pnew, *p, size, GB_Global_context_nthreads_max_get ( )) ;
+    GB_spill_free (*p) ;
+    (*p) = pnew ;
+    return (true) ;
+}
@@ -141,8 +141,10 @@ GrB_Info GB_subassign_08n
     // M(:,j) or A(:,j) are very sparse compared to the other, then the shorter
     // is traversed with a linear-time scan and a binary search is used for the
     // other.  If the number of nonzeros is comparable, a linear-time scan is
-    // used for both.  Once two entries M(i,j)=1 and A(i,j) are found with the
-    // same index i, the entry A(i,j) is accumulated or inserted into C.
+    // used for both.  If A(:,j) or M(:,j) is dense, its entries are found by
+    // direct lookup instead, and only the other vector is traversed.  Once
+    // two entries M(i,j)=1 and A(i,j) are found with the same index i, the
+    // entry A(i,j) is accumulated or inserted into C.
 
     // The algorithm is very much like the eWise multiplication of A.*M, so the
     // parallel scheduling relies on GB_emult_08_phase0 and GB_ewise_slice.
@@ -213,6 +215,12 @@ GrB_Info GB_subassign_08n
             int64_t iM_last  = GBI (Mi, pM_end-1, Mvlen) ;
             if (iA_last < iM_first || iM_last < iA_first) continue ;
             int64_t pM_start = pM ;
+            int64_t pA_start = pA ;
+
+            // A(:,j) or M(:,j) are dense if they have no gaps in the rows they
+            // span (this also holds for the slice of a fine task)
+            bool ajdense = (ajnz == iA_last - iA_first + 1) ;
+            bool mjdense = (mjnz == iM_last - iM_first + 1) ;
 
             //------------------------------------------------------------------
             // get jC, the corresponding vector of C
@@ -225,7 +233,48 @@ GrB_Info GB_subassign_08n
             // C(I,jC)<M(:,j)> += A(:,j) ; no S
             //------------------------------------------------------------------
 
-            if (ajnz > 32 * mjnz)
+            if (ajdense && ajnz >= mjnz)
+            {
+
+                //--------------------------------------------------------------
+                // A(iA_first:iA_last,j) is dense: no search for A(i,j)
+                //--------------------------------------------------------------
+
+                for ( ; pM < pM_end ; pM++)
+                {
+                    int64_t iA = GBI (Mi, pM, Mvlen) ;
+                    if (iA < iA_first) continue ;
+                    if (iA > iA_last) break ;
+                    if (GB_mcast (Mx, pM, msize))
+                    { 
+                        // A(iA,j) is at position pA_start + iA - iA_first
+                        pA = pA_start + (iA - iA_first) ;
+                        GB_PHASE1_ACTION ;
+                    }
+                }
+
+            }
+            else if (mjdense)
+            {
+
+                //--------------------------------------------------------------
+                // M(iM_first:iM_last,j) is dense: no search for M(i,j)
+                //--------------------------------------------------------------
+
+                for ( ; pA < pA_end ; pA++)
+                {
+                    int64_t iA = GBI (Ai, pA, Avlen) ;
+                    if (iA < iM_first) continue ;
+                    if (iA > iM_last) break ;
+                    // M(iA,j) is at position pM_start + iA - iM_first
+                    if (GB_mcast (Mx, pM_start + (iA - iM_first), msize))
+                    { 
+                        GB_PHASE1_ACTION ;
+                    }
+                }
+
+            }
+            else if (ajnz > 32 * mjnz)
             {
 
                 //--------------------------------------------------------------
@@ -240,7 +289,6 @@ GrB_Info GB_subassign_08n
                         // find iA in A(:,j)
                         int64_t pright = pA_end - 1 ;
                         bool found ;
-                        // FUTURE::: exploit dense A(:,j)
                         GB_BINARY_SEARCH (iA, Ai, pA, pright, found) ;
                         if (found) GB_PHASE1_ACTION ;
                     }
@@ -254,8 +302,8 @@ GrB_Info GB_subassign_08n
                 // M(:,j) is much denser than A(:,j)
                 //--------------------------------------------------------------
 
-                // FUTURE::: exploit dense mask
-                bool mjdense = false ;
+                // M(:,j) is sparse (the dense case is handled above)
+                ASSERT (!mjdense) ;
 
                 for ( ; pA < pA_end ; pA++)
                 { 
@@ -348,6 +396,12 @@ GrB_Info GB_subassign_08n
             int64_t iM_last  = GBI (Mi, pM_end-1, Mvlen) ;
             if (iA_last < iM_first || iM_last < iA_first) continue ;
             int64_t pM_start = pM ;
+            int64_t pA_start = pA ;
+
+            // A(:,j) or M(:,j) are dense if they have no gaps in the rows they
+            // span (this also holds for the slice of a fine task)
+            bool ajdense = (ajnz == iA_last - iA_first + 1) ;
+            bool mjdense = (mjnz == iM_last - iM_first + 1) ;
 
             //------------------------------------------------------------------
             // get jC, the corresponding vector of C
@@ -361,7 +415,48 @@ GrB_Info GB_subassign_08n
             // C(I,jC)<M(:,j)> += A(:,j) ; no S
             //------------------------------------------------------------------
 
-            if (ajnz > 32 * mjnz)
+            if (ajdense && ajnz >= mjnz)
+            {
+
+                //--------------------------------------------------------------
+                // A(iA_first:iA_last,j) is dense: no search for A(i,j)
+                //--------------------------------------------------------------
+
+                for ( ; pM < pM_end ; pM++)
+                {
+                    int64_t iA = GBI (Mi, pM, Mvlen) ;
+                    if (iA < iA_first) continue ;
+                    if (iA > iA_last) break ;
+                    if (GB_mcast (Mx, pM, msize))
+                    { 
+                        // A(iA,j) is at position pA_start + iA - iA_first
+                        pA = pA_start + (iA - iA_first) ;
+                        GB_PHASE2_ACTION ;
+                    }
+                }
+
+            }
+            else if (mjdense)
+            {
+
+                //--------------------------------------------------------------
+                // M(iM_first:iM_last,j) is dense: no search for M(i,j)
+                //--------------------------------------------------------------
+
+                for ( ; pA < pA_end ; pA++)
+                {
+                    int64_t iA = GBI (Ai, pA, Avlen) ;
+                    if (iA < iM_first) continue ;
+                    if (iA > iM_last) break ;
+                    // M(iA,j) is at position pM_start + iA - iM_first
+                    if (GB_mcast (Mx, pM_start + (iA - iM_first), msize))
+                    { 
+                        GB_PHASE2_ACTION ;
+                    }
+                }
+
+            }
+            else if (ajnz > 32 * mjnz)
             {
 
                 //--------------------------------------------------------------
@@ -376,7 +471,6 @@ GrB_Info GB_subassign_08n
                         // find iA in A(:,j)
                         int64_t pright = pA_end - 1 ;
                         bool found ;
-                        // FUTURE::: exploit dense A(:,j)
                         GB_BINARY_SEARCH (iA, Ai, pA, pright, found) ;
                         if (found) GB_PHASE2_ACTION ;
                     }
@@ -390,8 +484,8 @@ GrB_Info GB_subassign_08n
                 // M(:,j) is much denser than A(:,j)
                 //--------------------------------------------------------------
 
-                // FUTURE::: exploit dense mask
-                bool mjdense = false ;
+                // M(:,j) is sparse (the dense case is handled above)
+                ASSERT (!mjdense) ;
 
                 for ( ; pA < pA_end ; pA++)
                 { 
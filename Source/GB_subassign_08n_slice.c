@@ -212,10 +212,14 @@ GrB_Info GB_subassign_08n_slice
             }
             else
             { 
-                // find where this task starts and ends in C(:,jC)
-                int64_t iA_start = GB_IMIN (iA_first, iM_first) ;
+                // find where this task starts and ends in C(:,jC).  Only
+                // the rows in both A(:,j) and M(:,j) can modify C(:,jC), so
+                // the slice is limited to the intersection of their ranges.
+                // This keeps the slice of C(:,jC) small when M(:,j) or
+                // A(:,j) is dense and the other is not.
+                int64_t iA_start = GB_IMAX (iA_first, iM_first) ;
                 int64_t iC1 = GB_ijlist (I, iA_start, Ikind, Icolon) ;
-                int64_t iA_end = GB_IMAX (iA_last, iM_last) ;
+                int64_t iA_end = GB_IMIN (iA_last, iM_last) ;
                 int64_t iC2 = GB_ijlist (I, iA_end, Ikind, Icolon) ;
 
                 // If I is an explicit list, it must be already sorted
@@ -156,8 +156,9 @@
 // GB_GET_S: get the S matrix
 //------------------------------------------------------------------------------
 
-// S is never aliased with any other matrix.
-// FUTURE: S->p could be C->p and S->x NULL if I and J are (:,:)
+// S->i and S->x are never aliased with any other matrix.  If I and J are
+// (:,:), S->p and S->h are shallow copies of C->p and C->h (see
+// GB_subassign_symbolic).
 
 #define GB_GET_S                                                            \
     ASSERT_MATRIX_OK (S, "S extraction", GB0) ;                             \
@@ -50,21 +50,88 @@ GrB_Info GB_subassign_symbolic
     // reside inside the vector jC, in the range C->p [k] ... C->p [k+1]-1,
     // if jC is the kth non-empty vector in the hyperlist of C.
 
-    //--------------------------------------------------------------------------
-    // extract symbolic structure S=C(I,J)
-    //--------------------------------------------------------------------------
+    int64_t nI, Icolon [3], nJ, Jcolon [3] ;
+    int Ikind, Jkind ;
+    GB_ijlength (I, ni, C->vlen, &nI, &Ikind, Icolon) ;
+    GB_ijlength (J, nj, C->vdim, &nJ, &Jkind, Jcolon) ;
 
-    // FUTURE::: if whole_C_matrix is true, then C(:,:) = ... and S == C,
-    // except that S is zombie-free, read-only; and C collects zombies.
+    if (Ikind == GB_ALL && Jkind == GB_ALL)
+    { 
+        // C must not be jumbled, just as GB_subref requires
+        GB_MATRIX_WAIT_IF_JUMBLED (C) ;
+    }
 
-    // FUTURE:: the properties of I and J are already known, and thus do
-    // not need to be recomputed by GB_subref.
+    if (Ikind == GB_ALL && Jkind == GB_ALL &&
+        (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)))
+    {
 
-    // S and C have the same CSR/CSC format.  S can be jumbled.  It is in
-    // in the same hypersparse form as C (unless S is empty, in which case
-    // it is always returned as hypersparse). This also checks I and J.
-    // S is not iso, even if C is iso.
-    GB_OK (GB_subref (S, false, C->is_csc, C, I, ni, J, nj, true, Context)) ;
+        //----------------------------------------------------------------------
+        // S = C(:,:): S has the same pattern as C
+        //----------------------------------------------------------------------
+
+        // When the whole matrix C(:,:) is being assigned, S has the same
+        // pattern as C, and Sx [p] = p.  Sp and Sh are shallow copies of Cp
+        // and Ch, which are not modified while S is in use: the subassign
+        // methods only add zombies and pending tuples to C.  Si must be a
+        // copy of Ci, since S is zombie-free and C collects zombies.  Like
+        // GB_subref, any zombies already in C appear as live entries in S.
+
+        int64_t cnz = GB_nnz (C) ;
+        GB_OK (GB_new (&S, // sparse or hyper, existing header
+            GrB_INT64, C->vlen, C->vdim, GB_Ap_null, C->is_csc,
+            GB_sparsity (C), C->hyper_switch, 0, Context)) ;
+        GB_OK (GB_bix_alloc (S, cnz, GxB_SPARSE, false, true, false,
+            Context)) ;
+        S->p_shallow = true ; S->p = C->p ; S->p_size = C->p_size ;
+        S->h_shallow = (C->h != NULL) ; S->h = C->h ; S->h_size = C->h_size ;
+        S->plen = C->plen ;
+        S->nvec = C->nvec ;
+        S->nvec_nonempty = C->nvec_nonempty ;
+        S->magic = GB_MAGIC ;
+
+        const int64_t *restrict Ci = C->i ;
+        int64_t *restrict Si = S->i ;
+        int64_t *restrict Sx = (int64_t *) S->x ;
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+        int64_t p ;
+        if (GB_ZOMBIES (C))
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < cnz ; p++)
+            { 
+                Si [p] = GB_UNFLIP (Ci [p]) ;
+                Sx [p] = p ;
+            }
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (p = 0 ; p < cnz ; p++)
+            { 
+                Si [p] = Ci [p] ;
+                Sx [p] = p ;
+            }
+        }
+
+    }
+    else
+    { 
+
+        //----------------------------------------------------------------------
+        // extract symbolic structure S=C(I,J)
+        //----------------------------------------------------------------------
+
+        // FUTURE:: the properties of I and J are already known, and thus do
+        // not need to be recomputed by GB_subref.
+
+        // S and C have the same CSR/CSC format.  S can be jumbled.  It is in
+        // in the same hypersparse form as C (unless S is empty, in which case
+        // it is always returned as hypersparse). This also checks I and J.
+        // S is not iso, even if C is iso.
+        GB_OK (GB_subref (S, false, C->is_csc, C, I, ni, J, nj, true,
+            Context)) ;
+    }
     ASSERT (GB_JUMBLED_OK (S)) ;    // GB_subref can return S as unsorted
 
     //--------------------------------------------------------------------------
@@ -94,11 +161,6 @@ GrB_Info GB_subassign_symbolic
     // this body of code explains what S contains.
     // S is nI-by-nJ where nI = length (I) and nJ = length (J)
 
-    int64_t nI, Icolon [3], nJ, Jcolon [3] ;
-    int Ikind, Jkind ;
-    GB_ijlength (I, ni, C->vlen, &nI, &Ikind, Icolon) ;
-    GB_ijlength (J, nj, C->vdim, &nJ, &Jkind, Jcolon) ;
-
     // get S
     const int64_t *restrict Sp = S->p ;
     const int64_t *restrict Sh = S->h ;
@@ -265,6 +265,10 @@ int GB_subassigner_method           // return method to use in GB_subassigner
         //  M   c   r   -   A   -       18x: C(:,:)<!M,repl> = A
         //  M   c   r   +   A   -       20x: C(:,:)<!M,repl> += A
 
+        // These cases still use S, but when I and J are ":", S=C(:,:) is
+        // constructed by GB_subassign_symbolic as a copy of the pattern of
+        // C, rather than by GB_subref.
+
         //----------------------------------------------------------------------
         // FUTURE::: C<C,s> += x   C == M, update all values, C_replace ignored
         // FUTURE::: C<C,s> = A    C == M, A dense, C_replace ignored
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+// GB_telemetry: report events to the telemetry function
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// These functions are only called if a telemetry function has been set by
+// GxB_set (GxB_TELEMETRY_FUNCTION, f); see GB_telemetry.h.  The events are
+// delivered from the thread that called the user-callable method.  All times
+// are zero if GraphBLAS is compiled without OpenMP.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_telemetry_start: start the telemetry for a user-callable method
+//------------------------------------------------------------------------------
+
+void GB_telemetry_start
+(
+    const char *operation,      // name of the user-callable method
+    GB_Context Context
+)
+{ 
+    ASSERT (Context != NULL) ;
+    Context->operation = operation ;
+    Context->call_id = GB_Global_telemetry_call_id ( ) ;
+    Context->telemetry_time = GB_Global_get_wtime ( ) ;
+    Context->telemetry_flops = 0 ;
+    Context->telemetry_bytes = GB_Global_telemetry_bytes_get ( ) ;
+    Context->telemetry_nthreads = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_telemetry_event: report an internal event
+//------------------------------------------------------------------------------
+
+void GB_telemetry_event
+(
+    GxB_Telemetry_Kind kind,    // kind of event (not GxB_TELEMETRY_CALL)
+    const char *method,         // algorithm, conversion, or phase
+    double time,                // start time of the phase (PHASE only)
+    double flops,               // flop count, or 0 if not known
+    int nthreads,               // # of threads used, or 0 if not known
+    GB_Context Context
+)
+{
+
+    GxB_telemetry_function_t telemetry_func = GB_Global_telemetry_get ( ) ;
+    if (telemetry_func == NULL)
+    { 
+        // the telemetry function was cleared during this call
+        return ;
+    }
+
+    double now = GB_Global_get_wtime ( ) ;
+    if (flops == 0 && kind == GxB_TELEMETRY_METHOD)
+    { 
+        // use the flop count from the last analysis, if any
+        flops = Context->telemetry_flops ;
+    }
+    Context->telemetry_flops = 0 ;
+    Context->telemetry_nthreads = GB_IMAX (Context->telemetry_nthreads,
+        nthreads) ;
+
+    GxB_Telemetry_Event event ;
+    event.kind = kind ;
+    event.call_id = Context->call_id ;
+    event.operation = Context->operation ;
+    event.method = method ;
+    event.time = now -
+        ((kind == GxB_TELEMETRY_PHASE) ? time : Context->telemetry_time) ;
+    event.flops = flops ;
+    event.nthreads = nthreads ;
+    event.bytes = 0 ;
+    telemetry_func (&event) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_telemetry_end: report the end of a user-callable method
+//------------------------------------------------------------------------------
+
+void GB_telemetry_end
+(
+    GB_Context Context
+)
+{
+
+    GxB_telemetry_function_t telemetry_func = GB_Global_telemetry_get ( ) ;
+    if (telemetry_func != NULL)
+    {
+        int64_t bytes = GB_Global_telemetry_bytes_get ( ) ;
+        GxB_Telemetry_Event event ;
+        event.kind = GxB_TELEMETRY_CALL ;
+        event.call_id = Context->call_id ;
+        event.operation = Context->operation ;
+        event.method = NULL ;
+        event.time = GB_Global_get_wtime ( ) - Context->telemetry_time ;
+        event.flops = 0 ;
+        event.nthreads = Context->telemetry_nthreads ;
+        event.bytes = (bytes < 0) ? (-1) : (bytes - Context->telemetry_bytes) ;
+        telemetry_func (&event) ;
+    }
+
+    // the call is reported just once
+    Context->operation = NULL ;
+}
+
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// GB_telemetry.h: definitions for the telemetry callback
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The telemetry reports structured events to the function set by
+// GxB_set (GxB_TELEMETRY_FUNCTION, f).  A user-callable method starts the
+// telemetry with GB_BURBLE_START, which sets Context->operation if a telemetry
+// function is installed, and reports the whole call with GB_BURBLE_END.
+// Internal methods report the algorithms they select, format conversions,
+// transposes, and phases with the GB_TELEMETRY* macros, which do nothing if
+// the Context is NULL or Context->operation is NULL.
+
+#ifndef GB_TELEMETRY_H
+#define GB_TELEMETRY_H
+
+void GB_telemetry_start
+(
+    const char *operation,      // name of the user-callable method
+    GB_Context Context
+) ;
+
+void GB_telemetry_event
+(
+    GxB_Telemetry_Kind kind,    // kind of event (not GxB_TELEMETRY_CALL)
+    const char *method,         // algorithm, conversion, or phase
+    double time,                // start time of the phase (PHASE only)
+    double flops,               // flop count, or 0 if not known
+    int nthreads,               // # of threads used, or 0 if not known
+    GB_Context Context
+) ;
+
+void GB_telemetry_end
+(
+    GB_Context Context
+) ;
+
+// true if the telemetry is active for this Context
+#define GB_TELEMETRY_ACTIVE \
+    (Context != NULL && Context->operation != NULL)
+
+// start the telemetry for a user-callable method
+#define GB_TELEMETRY_START(func)                                    \
+{                                                                   \
+    if (GB_Global_telemetry_get ( ) != NULL)                        \
+    {                                                               \
+        GB_telemetry_start (func, Context) ;                        \
+    }                                                               \
+}
+
+// report the end of a user-callable method
+#define GB_TELEMETRY_END                                            \
+{                                                                   \
+    if (GB_TELEMETRY_ACTIVE)                                        \
+    {                                                               \
+        GB_telemetry_end (Context) ;                                \
+    }                                                               \
+}
+
+// report an internal event: an algorithm, conversion, or transpose
+#define GB_TELEMETRY(kind,method,flops,nthreads)                    \
+{                                                                   \
+    if (GB_TELEMETRY_ACTIVE)                                        \
+    {                                                               \
+        GB_telemetry_event (kind, method, 0, flops, nthreads,       \
+            Context) ;                                              \
+    }                                                               \
+}
+
+// the current time, if the telemetry is active, for timing a phase
+#define GB_TELEMETRY_TIME \
+    (GB_TELEMETRY_ACTIVE ? GB_Global_get_wtime ( ) : 0)
+
+// report a phase that started at time t, and restart t for the next phase
+#define GB_TELEMETRY_PHASE(phase,t,nthreads)                        \
+{                                                                   \
+    if (GB_TELEMETRY_ACTIVE)                                        \
+    {                                                               \
+        GB_telemetry_event (GxB_TELEMETRY_PHASE, phase, t, 0,       \
+            nthreads, Context) ;                                    \
+        t = GB_Global_get_wtime ( ) ;                               \
+    }                                                               \
+}
+
+// record the flop count of an analysis, for a later GB_TELEMETRY event
+#define GB_TELEMETRY_FLOPS(flops)                                   \
+{                                                                   \
+    if (GB_TELEMETRY_ACTIVE)                                        \
+    {                                                               \
+        Context->telemetry_flops = (double) (flops) ;               \
+    }                                                               \
+}
+
+#endif
+
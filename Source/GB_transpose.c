@@ -232,10 +232,14 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
     if (C_iso && !op_is_positional)
     { 
         GBURBLE ("(iso transpose) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_TRANSPOSE, in_place ?
+            "in-place iso transpose" : "iso transpose", 0, 0) ;
     }
     else
     {
         GBURBLE ("(transpose) ") ;
+        GB_TELEMETRY (GxB_TELEMETRY_TRANSPOSE, in_place ?
+            "in-place transpose" : "transpose", 0, 0) ;
     }
 
     //==========================================================================
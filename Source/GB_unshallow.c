@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GB_unshallow: ensure a matrix owns all of its components
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix returned to the user application is normally never shallow, but
+// GxB_Matrix_deserialize with the GxB_IMPORT descriptor set to
+// GxB_SHALLOW_IMPORT can return a matrix whose components are shallow
+// pointers into the user's blob.  Such a matrix can be used as an input to
+// any method, but it must not be modified in-place, since its shallow
+// components are not owned by GraphBLAS and may be read-only.  This method
+// replaces each shallow component of A with a copy that A owns.  It is called
+// before A is modified in-place (as the output of an assign, or C+=A*B, etc).
+// If A has no shallow components, nothing is done.
+
+#include "GB.h"
+
+#define GB_UNSHALLOW(component)                                             \
+    if (A->component ## _shallow)                                           \
+    {                                                                       \
+        if (A->component != NULL)                                           \
+        {                                                                   \
+            size_t X_size = 0 ;                                             \
+            size_t X_len = A->component ## _size ;                          \
+            GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;              \
+            if (X == NULL)                                                  \
+            {                                                               \
+                /* out of memory; A is unchanged */                         \
+                return (GrB_OUT_OF_MEMORY) ;                                \
+            }                                                               \
+            GB_memcpy (X, A->component, X_len, nthreads_max) ;              \
+            A->component = (void *) X ;                                     \
+            A->component ## _size = X_size ;                                \
+        }                                                                   \
+        A->component ## _shallow = false ;                                  \
+    }
+
+GrB_Info GB_unshallow           // replace shallow components of A with copies
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // quick return if A has no shallow components
+    //--------------------------------------------------------------------------
+
+    if (!GB_is_shallow (A))
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy each shallow component of A
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(unshallow) ") ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    GB_UNSHALLOW (p) ;
+    GB_UNSHALLOW (h) ;
+    GB_UNSHALLOW (b) ;
+    GB_UNSHALLOW (i) ;
+    GB_UNSHALLOW (x) ;
+    ASSERT (!GB_is_shallow (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -28,6 +28,7 @@
 // A.*B function (eWiseMult):       GB (_AemultB_02__gt_uint8)
 // A.*B function (eWiseMult):       GB (_AemultB_04__gt_uint8)
 // A.*B function (eWiseMult):       GB (_AemultB_bitmap__gt_uint8)
+// kron(A,B) function:              GB (_AkronB__gt_uint8)
 // A*D function (colscale):         GB (_AxD__gt_uint8)
 // D*A function (rowscale):         GB (_DxB__gt_uint8)
 // C+=B function (dense accum):     GB (_Cdense_accumB__gt_uint8)
@@ -444,6 +445,30 @@ GrB_Info GB (_AemultB_bitmap__gt_uint8)
 
 
 
+//------------------------------------------------------------------------------
+// kron: C = kron (A,B) where C is sparse, hypersparse, or full
+//------------------------------------------------------------------------------
+
+
+
+GrB_Info GB (_AkronB__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_kroner_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+
+
 //------------------------------------------------------------------------------
 // Cx = op (x,Bx):  apply a binary operator to a matrix with scalar bind1st
 //------------------------------------------------------------------------------
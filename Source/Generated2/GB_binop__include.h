@@ -134,6 +134,13 @@ GrB_Info GB (_AemultB_bitmap__first_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -304,6 +311,13 @@ GrB_Info GB (_AemultB_bitmap__first_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -474,6 +488,13 @@ GrB_Info GB (_AemultB_bitmap__first_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -644,6 +665,13 @@ GrB_Info GB (_AemultB_bitmap__first_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -814,6 +842,13 @@ GrB_Info GB (_AemultB_bitmap__first_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -984,6 +1019,13 @@ GrB_Info GB (_AemultB_bitmap__first_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -1154,6 +1196,13 @@ GrB_Info GB (_AemultB_bitmap__first_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -1324,6 +1373,13 @@ GrB_Info GB (_AemultB_bitmap__first_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -1494,6 +1550,13 @@ GrB_Info GB (_AemultB_bitmap__first_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -1664,6 +1727,13 @@ GrB_Info GB (_AemultB_bitmap__first_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -1834,6 +1904,13 @@ GrB_Info GB (_AemultB_bitmap__first_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2004,6 +2081,13 @@ GrB_Info GB (_AemultB_bitmap__first_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2174,6 +2258,13 @@ GrB_Info GB (_AemultB_bitmap__first_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__first_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2344,6 +2435,13 @@ GrB_Info GB (_AemultB_bitmap__second_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2514,6 +2612,13 @@ GrB_Info GB (_AemultB_bitmap__second_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2684,6 +2789,13 @@ GrB_Info GB (_AemultB_bitmap__second_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -2854,6 +2966,13 @@ GrB_Info GB (_AemultB_bitmap__second_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3024,6 +3143,13 @@ GrB_Info GB (_AemultB_bitmap__second_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3194,6 +3320,13 @@ GrB_Info GB (_AemultB_bitmap__second_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3364,6 +3497,13 @@ GrB_Info GB (_AemultB_bitmap__second_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3534,6 +3674,13 @@ GrB_Info GB (_AemultB_bitmap__second_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3704,6 +3851,13 @@ GrB_Info GB (_AemultB_bitmap__second_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -3874,6 +4028,13 @@ GrB_Info GB (_AemultB_bitmap__second_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -4044,6 +4205,13 @@ GrB_Info GB (_AemultB_bitmap__second_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -4214,6 +4382,13 @@ GrB_Info GB (_AemultB_bitmap__second_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -4384,6 +4559,13 @@ GrB_Info GB (_AemultB_bitmap__second_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__second_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 #if 0
@@ -4554,6 +4736,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -4724,6 +4913,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -4894,6 +5090,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5064,6 +5267,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5234,6 +5444,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5404,6 +5621,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5574,6 +5798,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5744,6 +5975,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -5914,6 +6152,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -6084,6 +6329,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -6254,6 +6506,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -6424,6 +6683,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -6594,6 +6860,13 @@ GrB_Info GB ((none))
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 #endif
 
 #if 0
@@ -6764,6 +7037,13 @@ GrB_Info GB (_AemultB_bitmap__min_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -6934,6 +7214,13 @@ GrB_Info GB (_AemultB_bitmap__min_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7104,6 +7391,13 @@ GrB_Info GB (_AemultB_bitmap__min_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7274,6 +7568,13 @@ GrB_Info GB (_AemultB_bitmap__min_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7444,6 +7745,13 @@ GrB_Info GB (_AemultB_bitmap__min_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7614,6 +7922,13 @@ GrB_Info GB (_AemultB_bitmap__min_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7784,6 +8099,13 @@ GrB_Info GB (_AemultB_bitmap__min_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -7954,6 +8276,13 @@ GrB_Info GB (_AemultB_bitmap__min_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8124,6 +8453,13 @@ GrB_Info GB (_AemultB_bitmap__min_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8294,6 +8630,13 @@ GrB_Info GB (_AemultB_bitmap__min_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__min_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8464,6 +8807,13 @@ GrB_Info GB (_AemultB_bitmap__max_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8634,6 +8984,13 @@ GrB_Info GB (_AemultB_bitmap__max_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8804,6 +9161,13 @@ GrB_Info GB (_AemultB_bitmap__max_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -8974,6 +9338,13 @@ GrB_Info GB (_AemultB_bitmap__max_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9144,6 +9515,13 @@ GrB_Info GB (_AemultB_bitmap__max_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9314,6 +9692,13 @@ GrB_Info GB (_AemultB_bitmap__max_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9484,6 +9869,13 @@ GrB_Info GB (_AemultB_bitmap__max_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9654,6 +10046,13 @@ GrB_Info GB (_AemultB_bitmap__max_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9824,6 +10223,13 @@ GrB_Info GB (_AemultB_bitmap__max_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -9994,6 +10400,13 @@ GrB_Info GB (_AemultB_bitmap__max_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__max_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -10164,6 +10577,13 @@ GrB_Info GB (_AemultB_bitmap__plus_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -10334,6 +10754,13 @@ GrB_Info GB (_AemultB_bitmap__plus_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -10504,6 +10931,13 @@ GrB_Info GB (_AemultB_bitmap__plus_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -10674,6 +11108,13 @@ GrB_Info GB (_AemultB_bitmap__plus_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -10844,6 +11285,13 @@ GrB_Info GB (_AemultB_bitmap__plus_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11014,6 +11462,13 @@ GrB_Info GB (_AemultB_bitmap__plus_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11184,6 +11639,13 @@ GrB_Info GB (_AemultB_bitmap__plus_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11354,6 +11816,13 @@ GrB_Info GB (_AemultB_bitmap__plus_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11524,6 +11993,13 @@ GrB_Info GB (_AemultB_bitmap__plus_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11694,6 +12170,13 @@ GrB_Info GB (_AemultB_bitmap__plus_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -11864,6 +12347,13 @@ GrB_Info GB (_AemultB_bitmap__plus_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12034,6 +12524,13 @@ GrB_Info GB (_AemultB_bitmap__plus_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__plus_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12204,6 +12701,13 @@ GrB_Info GB (_AemultB_bitmap__minus_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12374,6 +12878,13 @@ GrB_Info GB (_AemultB_bitmap__minus_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12544,6 +13055,13 @@ GrB_Info GB (_AemultB_bitmap__minus_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12714,6 +13232,13 @@ GrB_Info GB (_AemultB_bitmap__minus_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -12884,6 +13409,13 @@ GrB_Info GB (_AemultB_bitmap__minus_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13054,6 +13586,13 @@ GrB_Info GB (_AemultB_bitmap__minus_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13224,6 +13763,13 @@ GrB_Info GB (_AemultB_bitmap__minus_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13394,6 +13940,13 @@ GrB_Info GB (_AemultB_bitmap__minus_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13564,6 +14117,13 @@ GrB_Info GB (_AemultB_bitmap__minus_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13734,6 +14294,13 @@ GrB_Info GB (_AemultB_bitmap__minus_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -13904,6 +14471,13 @@ GrB_Info GB (_AemultB_bitmap__minus_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14074,6 +14648,13 @@ GrB_Info GB (_AemultB_bitmap__minus_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__minus_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14244,6 +14825,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14414,6 +15002,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14584,6 +15179,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14754,6 +15356,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -14924,6 +15533,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15094,6 +15710,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15264,6 +15887,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15434,6 +16064,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15604,6 +16241,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15774,6 +16418,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -15944,6 +16595,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16114,6 +16772,13 @@ GrB_Info GB (_AemultB_bitmap__rminus_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rminus_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16284,6 +16949,13 @@ GrB_Info GB (_AemultB_bitmap__times_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16454,6 +17126,13 @@ GrB_Info GB (_AemultB_bitmap__times_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16624,6 +17303,13 @@ GrB_Info GB (_AemultB_bitmap__times_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16794,6 +17480,13 @@ GrB_Info GB (_AemultB_bitmap__times_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -16964,6 +17657,13 @@ GrB_Info GB (_AemultB_bitmap__times_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17134,6 +17834,13 @@ GrB_Info GB (_AemultB_bitmap__times_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17304,6 +18011,13 @@ GrB_Info GB (_AemultB_bitmap__times_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17474,6 +18188,13 @@ GrB_Info GB (_AemultB_bitmap__times_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17644,6 +18365,13 @@ GrB_Info GB (_AemultB_bitmap__times_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17814,6 +18542,13 @@ GrB_Info GB (_AemultB_bitmap__times_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -17984,6 +18719,13 @@ GrB_Info GB (_AemultB_bitmap__times_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -18154,6 +18896,13 @@ GrB_Info GB (_AemultB_bitmap__times_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__times_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -18324,6 +19073,13 @@ GrB_Info GB (_AemultB_bitmap__div_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -18494,6 +19250,13 @@ GrB_Info GB (_AemultB_bitmap__div_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -18664,6 +19427,13 @@ GrB_Info GB (_AemultB_bitmap__div_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -18834,6 +19604,13 @@ GrB_Info GB (_AemultB_bitmap__div_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19004,6 +19781,13 @@ GrB_Info GB (_AemultB_bitmap__div_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19174,6 +19958,13 @@ GrB_Info GB (_AemultB_bitmap__div_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19344,6 +20135,13 @@ GrB_Info GB (_AemultB_bitmap__div_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19514,6 +20312,13 @@ GrB_Info GB (_AemultB_bitmap__div_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19684,6 +20489,13 @@ GrB_Info GB (_AemultB_bitmap__div_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -19854,6 +20666,13 @@ GrB_Info GB (_AemultB_bitmap__div_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20024,6 +20843,13 @@ GrB_Info GB (_AemultB_bitmap__div_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20194,6 +21020,13 @@ GrB_Info GB (_AemultB_bitmap__div_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__div_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20364,6 +21197,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20534,6 +21374,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20704,6 +21551,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -20874,6 +21728,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21044,6 +21905,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21214,6 +22082,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21384,6 +22259,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21554,6 +22436,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21724,6 +22613,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -21894,6 +22790,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22064,6 +22967,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22234,6 +23144,13 @@ GrB_Info GB (_AemultB_bitmap__rdiv_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__rdiv_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22404,6 +23321,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22574,6 +23498,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22744,6 +23675,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -22914,6 +23852,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23084,6 +24029,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23254,6 +24206,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23424,6 +24383,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23594,6 +24560,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23764,6 +24737,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -23934,6 +24914,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24104,6 +25091,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24274,6 +25268,13 @@ GrB_Info GB (_AemultB_bitmap__iseq_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__iseq_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24444,6 +25445,13 @@ GrB_Info GB (_AemultB_bitmap__isne_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24614,6 +25622,13 @@ GrB_Info GB (_AemultB_bitmap__isne_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24784,6 +25799,13 @@ GrB_Info GB (_AemultB_bitmap__isne_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -24954,6 +25976,13 @@ GrB_Info GB (_AemultB_bitmap__isne_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25124,6 +26153,13 @@ GrB_Info GB (_AemultB_bitmap__isne_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25294,6 +26330,13 @@ GrB_Info GB (_AemultB_bitmap__isne_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25464,6 +26507,13 @@ GrB_Info GB (_AemultB_bitmap__isne_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25634,6 +26684,13 @@ GrB_Info GB (_AemultB_bitmap__isne_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25804,6 +26861,13 @@ GrB_Info GB (_AemultB_bitmap__isne_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -25974,6 +27038,13 @@ GrB_Info GB (_AemultB_bitmap__isne_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26144,6 +27215,13 @@ GrB_Info GB (_AemultB_bitmap__isne_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26314,6 +27392,13 @@ GrB_Info GB (_AemultB_bitmap__isne_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26484,6 +27569,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26654,6 +27746,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26824,6 +27923,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -26994,6 +28100,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -27164,6 +28277,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -27334,6 +28454,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -27504,6 +28631,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -27674,6 +28808,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -27844,6 +28985,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28014,6 +29162,13 @@ GrB_Info GB (_AemultB_bitmap__isgt_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isgt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28184,6 +29339,13 @@ GrB_Info GB (_AemultB_bitmap__islt_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28354,6 +29516,13 @@ GrB_Info GB (_AemultB_bitmap__islt_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28524,6 +29693,13 @@ GrB_Info GB (_AemultB_bitmap__islt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28694,6 +29870,13 @@ GrB_Info GB (_AemultB_bitmap__islt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28864,6 +30047,13 @@ GrB_Info GB (_AemultB_bitmap__islt_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -29034,180 +30224,17 @@ GrB_Info GB (_AemultB_bitmap__islt_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__islt_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__islt_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__islt_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__islt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__islt_uint32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__islt_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__islt_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__islt_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__islt_uint32)
+GrB_Info GB (_AkronB__islt_uint16)
 (
     GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
 
-GrB_Info GB (_bind1st__islt_uint32)
+GrB_Info GB (_bind1st__islt_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -29216,7 +30243,7 @@ GrB_Info GB (_bind1st__islt_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__islt_uint32)
+GrB_Info GB (_bind1st_tran__islt_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -29226,7 +30253,7 @@ GrB_Info GB (_bind1st_tran__islt_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__islt_uint32)
+GrB_Info GB (_bind2nd__islt_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -29235,7 +30262,7 @@ GrB_Info GB (_bind2nd__islt_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__islt_uint32)
+GrB_Info GB (_bind2nd_tran__islt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29259,7 +30286,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__islt_uint64)
+void GB (_Cdense_ewise3_noaccum__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29267,14 +30294,14 @@ void GB (_Cdense_ewise3_noaccum__islt_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__islt_uint64)
+GrB_Info GB (_Cdense_accumB__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__islt_uint64)
+GrB_Info GB (_Cdense_accumb__islt_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -29282,14 +30309,14 @@ GrB_Info GB (_Cdense_accumb__islt_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__islt_uint64)
+GrB_Info GB (_AxD__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__islt_uint64)
+GrB_Info GB (_DxB__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -29298,7 +30325,7 @@ GrB_Info GB (_DxB__islt_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__islt_uint64)
+GrB_Info GB (_AaddB__islt_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29321,7 +30348,7 @@ GrB_Info GB (_AaddB__islt_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__islt_uint64)
+GrB_Info GB (_AemultB_08__islt_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29339,7 +30366,7 @@ GrB_Info GB (_AemultB_08__islt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__islt_uint64)
+GrB_Info GB (_AemultB_02__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29351,7 +30378,7 @@ GrB_Info GB (_AemultB_02__islt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__islt_uint64)
+GrB_Info GB (_AemultB_04__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29361,7 +30388,7 @@ GrB_Info GB (_AemultB_04__islt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__islt_uint64)
+GrB_Info GB (_AemultB_bitmap__islt_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -29374,180 +30401,17 @@ GrB_Info GB (_AemultB_bitmap__islt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__islt_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__islt_uint64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__islt_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__islt_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__islt_fp32)
+GrB_Info GB (_AkronB__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__islt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__islt_fp32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__islt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__islt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__islt_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__islt_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__islt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__islt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__islt_fp32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__islt_fp32)
+GrB_Info GB (_bind1st__islt_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -29556,7 +30420,7 @@ GrB_Info GB (_bind1st__islt_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__islt_fp32)
+GrB_Info GB (_bind1st_tran__islt_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -29566,7 +30430,7 @@ GrB_Info GB (_bind1st_tran__islt_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__islt_fp32)
+GrB_Info GB (_bind2nd__islt_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -29575,7 +30439,7 @@ GrB_Info GB (_bind2nd__islt_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__islt_fp32)
+GrB_Info GB (_bind2nd_tran__islt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29599,7 +30463,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__islt_fp64)
+void GB (_Cdense_ewise3_noaccum__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29607,14 +30471,14 @@ void GB (_Cdense_ewise3_noaccum__islt_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__islt_fp64)
+GrB_Info GB (_Cdense_accumB__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__islt_fp64)
+GrB_Info GB (_Cdense_accumb__islt_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -29622,14 +30486,14 @@ GrB_Info GB (_Cdense_accumb__islt_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__islt_fp64)
+GrB_Info GB (_AxD__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__islt_fp64)
+GrB_Info GB (_DxB__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -29638,7 +30502,7 @@ GrB_Info GB (_DxB__islt_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__islt_fp64)
+GrB_Info GB (_AaddB__islt_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29661,7 +30525,7 @@ GrB_Info GB (_AaddB__islt_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__islt_fp64)
+GrB_Info GB (_AemultB_08__islt_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29679,7 +30543,7 @@ GrB_Info GB (_AemultB_08__islt_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__islt_fp64)
+GrB_Info GB (_AemultB_02__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29691,7 +30555,7 @@ GrB_Info GB (_AemultB_02__islt_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__islt_fp64)
+GrB_Info GB (_AemultB_04__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29701,7 +30565,7 @@ GrB_Info GB (_AemultB_04__islt_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__islt_fp64)
+GrB_Info GB (_AemultB_bitmap__islt_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -29714,10 +30578,17 @@ GrB_Info GB (_AemultB_bitmap__islt_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__islt_fp64)
+GrB_Info GB (_bind1st__islt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -29726,7 +30597,7 @@ GrB_Info GB (_bind1st__islt_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__islt_fp64)
+GrB_Info GB (_bind1st_tran__islt_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -29736,7 +30607,7 @@ GrB_Info GB (_bind1st_tran__islt_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__islt_fp64)
+GrB_Info GB (_bind2nd__islt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -29745,7 +30616,7 @@ GrB_Info GB (_bind2nd__islt_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__islt_fp64)
+GrB_Info GB (_bind2nd_tran__islt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29769,7 +30640,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_int8)
+void GB (_Cdense_ewise3_noaccum__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29777,14 +30648,14 @@ void GB (_Cdense_ewise3_noaccum__isge_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_int8)
+GrB_Info GB (_Cdense_accumB__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_int8)
+GrB_Info GB (_Cdense_accumb__islt_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -29792,14 +30663,14 @@ GrB_Info GB (_Cdense_accumb__isge_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_int8)
+GrB_Info GB (_AxD__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_int8)
+GrB_Info GB (_DxB__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -29808,7 +30679,7 @@ GrB_Info GB (_DxB__isge_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_int8)
+GrB_Info GB (_AaddB__islt_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29831,7 +30702,7 @@ GrB_Info GB (_AaddB__isge_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_int8)
+GrB_Info GB (_AemultB_08__islt_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -29849,7 +30720,7 @@ GrB_Info GB (_AemultB_08__isge_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_int8)
+GrB_Info GB (_AemultB_02__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29861,7 +30732,7 @@ GrB_Info GB (_AemultB_02__isge_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_int8)
+GrB_Info GB (_AemultB_04__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -29871,7 +30742,7 @@ GrB_Info GB (_AemultB_04__isge_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_int8)
+GrB_Info GB (_AemultB_bitmap__islt_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -29884,10 +30755,17 @@ GrB_Info GB (_AemultB_bitmap__isge_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__islt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isge_int8)
+GrB_Info GB (_bind1st__islt_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -29896,7 +30774,7 @@ GrB_Info GB (_bind1st__isge_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_int8)
+GrB_Info GB (_bind1st_tran__islt_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -29906,7 +30784,7 @@ GrB_Info GB (_bind1st_tran__isge_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_int8)
+GrB_Info GB (_bind2nd__islt_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -29915,7 +30793,7 @@ GrB_Info GB (_bind2nd__isge_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_int8)
+GrB_Info GB (_bind2nd_tran__islt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29939,7 +30817,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_int16)
+void GB (_Cdense_ewise3_noaccum__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29947,14 +30825,14 @@ void GB (_Cdense_ewise3_noaccum__isge_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_int16)
+GrB_Info GB (_Cdense_accumB__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_int16)
+GrB_Info GB (_Cdense_accumb__islt_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -29962,14 +30840,14 @@ GrB_Info GB (_Cdense_accumb__isge_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_int16)
+GrB_Info GB (_AxD__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_int16)
+GrB_Info GB (_DxB__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -29978,7 +30856,7 @@ GrB_Info GB (_DxB__isge_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_int16)
+GrB_Info GB (_AaddB__islt_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30001,7 +30879,7 @@ GrB_Info GB (_AaddB__isge_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_int16)
+GrB_Info GB (_AemultB_08__islt_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30019,7 +30897,7 @@ GrB_Info GB (_AemultB_08__isge_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_int16)
+GrB_Info GB (_AemultB_02__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30031,7 +30909,7 @@ GrB_Info GB (_AemultB_02__isge_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_int16)
+GrB_Info GB (_AemultB_04__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30041,7 +30919,7 @@ GrB_Info GB (_AemultB_04__isge_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_int16)
+GrB_Info GB (_AemultB_bitmap__islt_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -30054,180 +30932,17 @@ GrB_Info GB (_AemultB_bitmap__isge_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__isge_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__isge_int16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__isge_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__isge_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__isge_int32)
+GrB_Info GB (_AkronB__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__isge_int32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__isge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__isge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__isge_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__isge_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__isge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__isge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__isge_int32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__isge_int32)
+GrB_Info GB (_bind1st__islt_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30236,7 +30951,7 @@ GrB_Info GB (_bind1st__isge_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_int32)
+GrB_Info GB (_bind1st_tran__islt_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30246,7 +30961,7 @@ GrB_Info GB (_bind1st_tran__isge_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_int32)
+GrB_Info GB (_bind2nd__islt_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30255,7 +30970,7 @@ GrB_Info GB (_bind2nd__isge_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_int32)
+GrB_Info GB (_bind2nd_tran__islt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30279,7 +30994,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_int64)
+void GB (_Cdense_ewise3_noaccum__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30287,14 +31002,14 @@ void GB (_Cdense_ewise3_noaccum__isge_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_int64)
+GrB_Info GB (_Cdense_accumB__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_int64)
+GrB_Info GB (_Cdense_accumb__isge_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30302,14 +31017,14 @@ GrB_Info GB (_Cdense_accumb__isge_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_int64)
+GrB_Info GB (_AxD__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_int64)
+GrB_Info GB (_DxB__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -30318,7 +31033,7 @@ GrB_Info GB (_DxB__isge_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_int64)
+GrB_Info GB (_AaddB__isge_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30341,7 +31056,7 @@ GrB_Info GB (_AaddB__isge_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_int64)
+GrB_Info GB (_AemultB_08__isge_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30359,7 +31074,7 @@ GrB_Info GB (_AemultB_08__isge_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_int64)
+GrB_Info GB (_AemultB_02__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30371,7 +31086,7 @@ GrB_Info GB (_AemultB_02__isge_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_int64)
+GrB_Info GB (_AemultB_04__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30381,7 +31096,7 @@ GrB_Info GB (_AemultB_04__isge_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_int64)
+GrB_Info GB (_AemultB_bitmap__isge_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -30394,10 +31109,17 @@ GrB_Info GB (_AemultB_bitmap__isge_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isge_int64)
+GrB_Info GB (_bind1st__isge_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30406,7 +31128,7 @@ GrB_Info GB (_bind1st__isge_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_int64)
+GrB_Info GB (_bind1st_tran__isge_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30416,7 +31138,7 @@ GrB_Info GB (_bind1st_tran__isge_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_int64)
+GrB_Info GB (_bind2nd__isge_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30425,7 +31147,7 @@ GrB_Info GB (_bind2nd__isge_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_int64)
+GrB_Info GB (_bind2nd_tran__isge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30449,7 +31171,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_uint8)
+void GB (_Cdense_ewise3_noaccum__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30457,14 +31179,14 @@ void GB (_Cdense_ewise3_noaccum__isge_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_uint8)
+GrB_Info GB (_Cdense_accumB__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_uint8)
+GrB_Info GB (_Cdense_accumb__isge_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30472,14 +31194,14 @@ GrB_Info GB (_Cdense_accumb__isge_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_uint8)
+GrB_Info GB (_AxD__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_uint8)
+GrB_Info GB (_DxB__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -30488,7 +31210,7 @@ GrB_Info GB (_DxB__isge_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_uint8)
+GrB_Info GB (_AaddB__isge_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30511,7 +31233,7 @@ GrB_Info GB (_AaddB__isge_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_uint8)
+GrB_Info GB (_AemultB_08__isge_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30529,7 +31251,7 @@ GrB_Info GB (_AemultB_08__isge_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_uint8)
+GrB_Info GB (_AemultB_02__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30541,7 +31263,7 @@ GrB_Info GB (_AemultB_02__isge_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_uint8)
+GrB_Info GB (_AemultB_04__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30551,7 +31273,7 @@ GrB_Info GB (_AemultB_04__isge_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_uint8)
+GrB_Info GB (_AemultB_bitmap__isge_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -30564,10 +31286,17 @@ GrB_Info GB (_AemultB_bitmap__isge_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isge_uint8)
+GrB_Info GB (_bind1st__isge_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30576,7 +31305,7 @@ GrB_Info GB (_bind1st__isge_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_uint8)
+GrB_Info GB (_bind1st_tran__isge_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30586,7 +31315,7 @@ GrB_Info GB (_bind1st_tran__isge_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_uint8)
+GrB_Info GB (_bind2nd__isge_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30595,7 +31324,7 @@ GrB_Info GB (_bind2nd__isge_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_uint8)
+GrB_Info GB (_bind2nd_tran__isge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30619,7 +31348,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_uint16)
+void GB (_Cdense_ewise3_noaccum__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30627,14 +31356,14 @@ void GB (_Cdense_ewise3_noaccum__isge_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_uint16)
+GrB_Info GB (_Cdense_accumB__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_uint16)
+GrB_Info GB (_Cdense_accumb__isge_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30642,14 +31371,14 @@ GrB_Info GB (_Cdense_accumb__isge_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_uint16)
+GrB_Info GB (_AxD__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_uint16)
+GrB_Info GB (_DxB__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -30658,7 +31387,7 @@ GrB_Info GB (_DxB__isge_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_uint16)
+GrB_Info GB (_AaddB__isge_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30681,7 +31410,7 @@ GrB_Info GB (_AaddB__isge_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_uint16)
+GrB_Info GB (_AemultB_08__isge_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -30699,7 +31428,7 @@ GrB_Info GB (_AemultB_08__isge_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_uint16)
+GrB_Info GB (_AemultB_02__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30711,7 +31440,7 @@ GrB_Info GB (_AemultB_02__isge_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_uint16)
+GrB_Info GB (_AemultB_04__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30721,7 +31450,7 @@ GrB_Info GB (_AemultB_04__isge_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_uint16)
+GrB_Info GB (_AemultB_bitmap__isge_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -30734,180 +31463,17 @@ GrB_Info GB (_AemultB_bitmap__isge_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__isge_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__isge_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__isge_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__isge_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__isge_uint32)
+GrB_Info GB (_AkronB__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__isge_uint32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__isge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__isge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__isge_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__isge_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__isge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__isge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__isge_uint32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__isge_uint32)
+GrB_Info GB (_bind1st__isge_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30916,7 +31482,7 @@ GrB_Info GB (_bind1st__isge_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_uint32)
+GrB_Info GB (_bind1st_tran__isge_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30926,7 +31492,7 @@ GrB_Info GB (_bind1st_tran__isge_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_uint32)
+GrB_Info GB (_bind2nd__isge_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30935,7 +31501,7 @@ GrB_Info GB (_bind2nd__isge_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_uint32)
+GrB_Info GB (_bind2nd_tran__isge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30959,7 +31525,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_uint64)
+void GB (_Cdense_ewise3_noaccum__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30967,14 +31533,14 @@ void GB (_Cdense_ewise3_noaccum__isge_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_uint64)
+GrB_Info GB (_Cdense_accumB__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_uint64)
+GrB_Info GB (_Cdense_accumb__isge_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30982,14 +31548,14 @@ GrB_Info GB (_Cdense_accumb__isge_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_uint64)
+GrB_Info GB (_AxD__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_uint64)
+GrB_Info GB (_DxB__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -30998,7 +31564,7 @@ GrB_Info GB (_DxB__isge_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_uint64)
+GrB_Info GB (_AaddB__isge_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31021,7 +31587,7 @@ GrB_Info GB (_AaddB__isge_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_uint64)
+GrB_Info GB (_AemultB_08__isge_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31039,7 +31605,7 @@ GrB_Info GB (_AemultB_08__isge_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_uint64)
+GrB_Info GB (_AemultB_02__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31051,7 +31617,7 @@ GrB_Info GB (_AemultB_02__isge_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_uint64)
+GrB_Info GB (_AemultB_04__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31061,7 +31627,7 @@ GrB_Info GB (_AemultB_04__isge_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_uint64)
+GrB_Info GB (_AemultB_bitmap__isge_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -31074,10 +31640,17 @@ GrB_Info GB (_AemultB_bitmap__isge_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isge_uint64)
+GrB_Info GB (_bind1st__isge_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31086,7 +31659,7 @@ GrB_Info GB (_bind1st__isge_uint64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_uint64)
+GrB_Info GB (_bind1st_tran__isge_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31096,7 +31669,7 @@ GrB_Info GB (_bind1st_tran__isge_uint64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_uint64)
+GrB_Info GB (_bind2nd__isge_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31105,7 +31678,7 @@ GrB_Info GB (_bind2nd__isge_uint64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_uint64)
+GrB_Info GB (_bind2nd_tran__isge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31129,7 +31702,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_fp32)
+void GB (_Cdense_ewise3_noaccum__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31137,14 +31710,14 @@ void GB (_Cdense_ewise3_noaccum__isge_fp32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_fp32)
+GrB_Info GB (_Cdense_accumB__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_fp32)
+GrB_Info GB (_Cdense_accumb__isge_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -31152,14 +31725,14 @@ GrB_Info GB (_Cdense_accumb__isge_fp32)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_fp32)
+GrB_Info GB (_AxD__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_fp32)
+GrB_Info GB (_DxB__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -31168,7 +31741,7 @@ GrB_Info GB (_DxB__isge_fp32)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_fp32)
+GrB_Info GB (_AaddB__isge_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31191,7 +31764,7 @@ GrB_Info GB (_AaddB__isge_fp32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_fp32)
+GrB_Info GB (_AemultB_08__isge_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31209,7 +31782,7 @@ GrB_Info GB (_AemultB_08__isge_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_fp32)
+GrB_Info GB (_AemultB_02__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31221,7 +31794,7 @@ GrB_Info GB (_AemultB_02__isge_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_fp32)
+GrB_Info GB (_AemultB_04__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31231,7 +31804,7 @@ GrB_Info GB (_AemultB_04__isge_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_fp32)
+GrB_Info GB (_AemultB_bitmap__isge_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -31244,10 +31817,17 @@ GrB_Info GB (_AemultB_bitmap__isge_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isge_fp32)
+GrB_Info GB (_bind1st__isge_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31256,7 +31836,7 @@ GrB_Info GB (_bind1st__isge_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isge_fp32)
+GrB_Info GB (_bind1st_tran__isge_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31266,7 +31846,7 @@ GrB_Info GB (_bind1st_tran__isge_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isge_fp32)
+GrB_Info GB (_bind2nd__isge_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31275,7 +31855,7 @@ GrB_Info GB (_bind2nd__isge_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isge_fp32)
+GrB_Info GB (_bind2nd_tran__isge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31299,7 +31879,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isge_fp64)
+void GB (_Cdense_ewise3_noaccum__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31307,14 +31887,14 @@ void GB (_Cdense_ewise3_noaccum__isge_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isge_fp64)
+GrB_Info GB (_Cdense_accumB__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isge_fp64)
+GrB_Info GB (_Cdense_accumb__isge_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -31322,14 +31902,14 @@ GrB_Info GB (_Cdense_accumb__isge_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__isge_fp64)
+GrB_Info GB (_AxD__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isge_fp64)
+GrB_Info GB (_DxB__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -31338,7 +31918,7 @@ GrB_Info GB (_DxB__isge_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isge_fp64)
+GrB_Info GB (_AaddB__isge_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31361,7 +31941,7 @@ GrB_Info GB (_AaddB__isge_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isge_fp64)
+GrB_Info GB (_AemultB_08__isge_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31379,7 +31959,7 @@ GrB_Info GB (_AemultB_08__isge_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isge_fp64)
+GrB_Info GB (_AemultB_02__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31391,7 +31971,7 @@ GrB_Info GB (_AemultB_02__isge_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isge_fp64)
+GrB_Info GB (_AemultB_04__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31401,7 +31981,7 @@ GrB_Info GB (_AemultB_04__isge_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isge_fp64)
+GrB_Info GB (_AemultB_bitmap__isge_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -31414,180 +31994,17 @@ GrB_Info GB (_AemultB_bitmap__isge_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__isge_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__isge_fp64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__isge_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__isge_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__isle_int8)
+GrB_Info GB (_AkronB__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__isle_int8)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__isle_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__isle_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__isle_int8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__isle_int8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__isle_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__isle_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__isle_int8)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__isle_int8)
+GrB_Info GB (_bind1st__isge_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31596,7 +32013,7 @@ GrB_Info GB (_bind1st__isle_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_int8)
+GrB_Info GB (_bind1st_tran__isge_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31606,7 +32023,7 @@ GrB_Info GB (_bind1st_tran__isle_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_int8)
+GrB_Info GB (_bind2nd__isge_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31615,7 +32032,7 @@ GrB_Info GB (_bind2nd__isle_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_int8)
+GrB_Info GB (_bind2nd_tran__isge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31639,7 +32056,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_int16)
+void GB (_Cdense_ewise3_noaccum__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31647,14 +32064,14 @@ void GB (_Cdense_ewise3_noaccum__isle_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_int16)
+GrB_Info GB (_Cdense_accumB__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_int16)
+GrB_Info GB (_Cdense_accumb__isge_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -31662,14 +32079,14 @@ GrB_Info GB (_Cdense_accumb__isle_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_int16)
+GrB_Info GB (_AxD__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_int16)
+GrB_Info GB (_DxB__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -31678,7 +32095,7 @@ GrB_Info GB (_DxB__isle_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_int16)
+GrB_Info GB (_AaddB__isge_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31701,7 +32118,7 @@ GrB_Info GB (_AaddB__isle_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_int16)
+GrB_Info GB (_AemultB_08__isge_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31719,7 +32136,7 @@ GrB_Info GB (_AemultB_08__isle_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_int16)
+GrB_Info GB (_AemultB_02__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31731,7 +32148,7 @@ GrB_Info GB (_AemultB_02__isle_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_int16)
+GrB_Info GB (_AemultB_04__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31741,7 +32158,7 @@ GrB_Info GB (_AemultB_04__isle_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_int16)
+GrB_Info GB (_AemultB_bitmap__isge_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -31754,10 +32171,17 @@ GrB_Info GB (_AemultB_bitmap__isle_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isle_int16)
+GrB_Info GB (_bind1st__isge_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31766,7 +32190,7 @@ GrB_Info GB (_bind1st__isle_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_int16)
+GrB_Info GB (_bind1st_tran__isge_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31776,7 +32200,7 @@ GrB_Info GB (_bind1st_tran__isle_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_int16)
+GrB_Info GB (_bind2nd__isge_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31785,7 +32209,7 @@ GrB_Info GB (_bind2nd__isle_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_int16)
+GrB_Info GB (_bind2nd_tran__isge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31809,7 +32233,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_int32)
+void GB (_Cdense_ewise3_noaccum__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31817,14 +32241,14 @@ void GB (_Cdense_ewise3_noaccum__isle_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_int32)
+GrB_Info GB (_Cdense_accumB__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_int32)
+GrB_Info GB (_Cdense_accumb__isge_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -31832,14 +32256,14 @@ GrB_Info GB (_Cdense_accumb__isle_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_int32)
+GrB_Info GB (_AxD__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_int32)
+GrB_Info GB (_DxB__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -31848,7 +32272,7 @@ GrB_Info GB (_DxB__isle_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_int32)
+GrB_Info GB (_AaddB__isge_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31871,7 +32295,7 @@ GrB_Info GB (_AaddB__isle_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_int32)
+GrB_Info GB (_AemultB_08__isge_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -31889,7 +32313,7 @@ GrB_Info GB (_AemultB_08__isle_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_int32)
+GrB_Info GB (_AemultB_02__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31901,7 +32325,7 @@ GrB_Info GB (_AemultB_02__isle_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_int32)
+GrB_Info GB (_AemultB_04__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31911,7 +32335,7 @@ GrB_Info GB (_AemultB_04__isle_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_int32)
+GrB_Info GB (_AemultB_bitmap__isge_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -31924,10 +32348,17 @@ GrB_Info GB (_AemultB_bitmap__isle_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isle_int32)
+GrB_Info GB (_bind1st__isge_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31936,7 +32367,7 @@ GrB_Info GB (_bind1st__isle_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_int32)
+GrB_Info GB (_bind1st_tran__isge_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31946,7 +32377,7 @@ GrB_Info GB (_bind1st_tran__isle_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_int32)
+GrB_Info GB (_bind2nd__isge_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31955,7 +32386,7 @@ GrB_Info GB (_bind2nd__isle_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_int32)
+GrB_Info GB (_bind2nd_tran__isge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31979,7 +32410,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_int64)
+void GB (_Cdense_ewise3_noaccum__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31987,14 +32418,14 @@ void GB (_Cdense_ewise3_noaccum__isle_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_int64)
+GrB_Info GB (_Cdense_accumB__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_int64)
+GrB_Info GB (_Cdense_accumb__isge_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -32002,14 +32433,14 @@ GrB_Info GB (_Cdense_accumb__isle_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_int64)
+GrB_Info GB (_AxD__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_int64)
+GrB_Info GB (_DxB__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -32018,7 +32449,7 @@ GrB_Info GB (_DxB__isle_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_int64)
+GrB_Info GB (_AaddB__isge_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32041,7 +32472,7 @@ GrB_Info GB (_AaddB__isle_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_int64)
+GrB_Info GB (_AemultB_08__isge_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32059,7 +32490,7 @@ GrB_Info GB (_AemultB_08__isle_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_int64)
+GrB_Info GB (_AemultB_02__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32071,7 +32502,7 @@ GrB_Info GB (_AemultB_02__isle_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_int64)
+GrB_Info GB (_AemultB_04__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32081,7 +32512,7 @@ GrB_Info GB (_AemultB_04__isle_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_int64)
+GrB_Info GB (_AemultB_bitmap__isge_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -32094,180 +32525,17 @@ GrB_Info GB (_AemultB_bitmap__isle_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__isle_int64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__isle_int64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__isle_int64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__isle_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__isle_uint8)
+GrB_Info GB (_AkronB__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__isle_uint8)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__isle_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__isle_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__isle_uint8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__isle_uint8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__isle_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__isle_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__isle_uint8)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__isle_uint8)
+GrB_Info GB (_bind1st__isge_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -32276,7 +32544,7 @@ GrB_Info GB (_bind1st__isle_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_uint8)
+GrB_Info GB (_bind1st_tran__isge_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -32286,7 +32554,7 @@ GrB_Info GB (_bind1st_tran__isle_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_uint8)
+GrB_Info GB (_bind2nd__isge_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -32295,7 +32563,7 @@ GrB_Info GB (_bind2nd__isle_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_uint8)
+GrB_Info GB (_bind2nd_tran__isge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32319,7 +32587,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_uint16)
+void GB (_Cdense_ewise3_noaccum__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32327,14 +32595,14 @@ void GB (_Cdense_ewise3_noaccum__isle_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_uint16)
+GrB_Info GB (_Cdense_accumB__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_uint16)
+GrB_Info GB (_Cdense_accumb__isge_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -32342,14 +32610,14 @@ GrB_Info GB (_Cdense_accumb__isle_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_uint16)
+GrB_Info GB (_AxD__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_uint16)
+GrB_Info GB (_DxB__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -32358,7 +32626,7 @@ GrB_Info GB (_DxB__isle_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_uint16)
+GrB_Info GB (_AaddB__isge_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32381,7 +32649,7 @@ GrB_Info GB (_AaddB__isle_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_uint16)
+GrB_Info GB (_AemultB_08__isge_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32399,7 +32667,7 @@ GrB_Info GB (_AemultB_08__isle_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_uint16)
+GrB_Info GB (_AemultB_02__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32411,7 +32679,7 @@ GrB_Info GB (_AemultB_02__isle_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_uint16)
+GrB_Info GB (_AemultB_04__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32421,7 +32689,7 @@ GrB_Info GB (_AemultB_04__isle_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_uint16)
+GrB_Info GB (_AemultB_bitmap__isge_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -32434,10 +32702,17 @@ GrB_Info GB (_AemultB_bitmap__isle_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isge_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isle_uint16)
+GrB_Info GB (_bind1st__isge_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -32446,7 +32721,7 @@ GrB_Info GB (_bind1st__isle_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_uint16)
+GrB_Info GB (_bind1st_tran__isge_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -32456,7 +32731,7 @@ GrB_Info GB (_bind1st_tran__isle_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_uint16)
+GrB_Info GB (_bind2nd__isge_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -32465,7 +32740,7 @@ GrB_Info GB (_bind2nd__isle_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_uint16)
+GrB_Info GB (_bind2nd_tran__isge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32489,7 +32764,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_uint32)
+void GB (_Cdense_ewise3_noaccum__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32497,14 +32772,14 @@ void GB (_Cdense_ewise3_noaccum__isle_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_uint32)
+GrB_Info GB (_Cdense_accumB__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_uint32)
+GrB_Info GB (_Cdense_accumb__isle_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -32512,14 +32787,14 @@ GrB_Info GB (_Cdense_accumb__isle_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_uint32)
+GrB_Info GB (_AxD__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_uint32)
+GrB_Info GB (_DxB__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -32528,7 +32803,7 @@ GrB_Info GB (_DxB__isle_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_uint32)
+GrB_Info GB (_AaddB__isle_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32551,7 +32826,7 @@ GrB_Info GB (_AaddB__isle_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_uint32)
+GrB_Info GB (_AemultB_08__isle_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32569,7 +32844,7 @@ GrB_Info GB (_AemultB_08__isle_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_uint32)
+GrB_Info GB (_AemultB_02__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32581,7 +32856,7 @@ GrB_Info GB (_AemultB_02__isle_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_uint32)
+GrB_Info GB (_AemultB_04__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32591,7 +32866,7 @@ GrB_Info GB (_AemultB_04__isle_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_uint32)
+GrB_Info GB (_AemultB_bitmap__isle_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -32604,10 +32879,17 @@ GrB_Info GB (_AemultB_bitmap__isle_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isle_uint32)
+GrB_Info GB (_bind1st__isle_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -32616,7 +32898,7 @@ GrB_Info GB (_bind1st__isle_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_uint32)
+GrB_Info GB (_bind1st_tran__isle_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -32626,7 +32908,7 @@ GrB_Info GB (_bind1st_tran__isle_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_uint32)
+GrB_Info GB (_bind2nd__isle_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -32635,7 +32917,7 @@ GrB_Info GB (_bind2nd__isle_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_uint32)
+GrB_Info GB (_bind2nd_tran__isle_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32659,7 +32941,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_uint64)
+void GB (_Cdense_ewise3_noaccum__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32667,14 +32949,14 @@ void GB (_Cdense_ewise3_noaccum__isle_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_uint64)
+GrB_Info GB (_Cdense_accumB__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_uint64)
+GrB_Info GB (_Cdense_accumb__isle_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -32682,14 +32964,14 @@ GrB_Info GB (_Cdense_accumb__isle_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_uint64)
+GrB_Info GB (_AxD__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_uint64)
+GrB_Info GB (_DxB__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -32698,7 +32980,7 @@ GrB_Info GB (_DxB__isle_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_uint64)
+GrB_Info GB (_AaddB__isle_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32721,7 +33003,7 @@ GrB_Info GB (_AaddB__isle_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_uint64)
+GrB_Info GB (_AemultB_08__isle_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -32739,7 +33021,7 @@ GrB_Info GB (_AemultB_08__isle_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_uint64)
+GrB_Info GB (_AemultB_02__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32751,7 +33033,7 @@ GrB_Info GB (_AemultB_02__isle_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_uint64)
+GrB_Info GB (_AemultB_04__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -32761,7 +33043,7 @@ GrB_Info GB (_AemultB_04__isle_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_uint64)
+GrB_Info GB (_AemultB_bitmap__isle_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -32774,180 +33056,17 @@ GrB_Info GB (_AemultB_bitmap__isle_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__isle_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__isle_uint64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__isle_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__isle_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__isle_fp32)
+GrB_Info GB (_AkronB__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__isle_fp32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__isle_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__isle_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__isle_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__isle_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__isle_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__isle_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__isle_fp32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__isle_fp32)
+GrB_Info GB (_bind1st__isle_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -32956,7 +33075,7 @@ GrB_Info GB (_bind1st__isle_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_fp32)
+GrB_Info GB (_bind1st_tran__isle_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -32966,7 +33085,7 @@ GrB_Info GB (_bind1st_tran__isle_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_fp32)
+GrB_Info GB (_bind2nd__isle_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -32975,7 +33094,7 @@ GrB_Info GB (_bind2nd__isle_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_fp32)
+GrB_Info GB (_bind2nd_tran__isle_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32999,7 +33118,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__isle_fp64)
+void GB (_Cdense_ewise3_noaccum__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33007,14 +33126,14 @@ void GB (_Cdense_ewise3_noaccum__isle_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__isle_fp64)
+GrB_Info GB (_Cdense_accumB__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__isle_fp64)
+GrB_Info GB (_Cdense_accumb__isle_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -33022,14 +33141,14 @@ GrB_Info GB (_Cdense_accumb__isle_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__isle_fp64)
+GrB_Info GB (_AxD__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__isle_fp64)
+GrB_Info GB (_DxB__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -33038,7 +33157,7 @@ GrB_Info GB (_DxB__isle_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__isle_fp64)
+GrB_Info GB (_AaddB__isle_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33061,7 +33180,7 @@ GrB_Info GB (_AaddB__isle_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__isle_fp64)
+GrB_Info GB (_AemultB_08__isle_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33079,7 +33198,7 @@ GrB_Info GB (_AemultB_08__isle_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__isle_fp64)
+GrB_Info GB (_AemultB_02__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33091,7 +33210,7 @@ GrB_Info GB (_AemultB_02__isle_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__isle_fp64)
+GrB_Info GB (_AemultB_04__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33101,7 +33220,7 @@ GrB_Info GB (_AemultB_04__isle_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__isle_fp64)
+GrB_Info GB (_AemultB_bitmap__isle_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -33114,10 +33233,17 @@ GrB_Info GB (_AemultB_bitmap__isle_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__isle_fp64)
+GrB_Info GB (_bind1st__isle_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33126,7 +33252,7 @@ GrB_Info GB (_bind1st__isle_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__isle_fp64)
+GrB_Info GB (_bind1st_tran__isle_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33136,7 +33262,7 @@ GrB_Info GB (_bind1st_tran__isle_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__isle_fp64)
+GrB_Info GB (_bind2nd__isle_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33145,7 +33271,7 @@ GrB_Info GB (_bind2nd__isle_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__isle_fp64)
+GrB_Info GB (_bind2nd_tran__isle_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33169,7 +33295,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_bool)
+void GB (_Cdense_ewise3_noaccum__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33177,14 +33303,14 @@ void GB (_Cdense_ewise3_noaccum__eq_bool)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_bool)
+GrB_Info GB (_Cdense_accumB__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_bool)
+GrB_Info GB (_Cdense_accumb__isle_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -33192,14 +33318,14 @@ GrB_Info GB (_Cdense_accumb__eq_bool)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_bool)
+GrB_Info GB (_AxD__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_bool)
+GrB_Info GB (_DxB__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -33208,7 +33334,7 @@ GrB_Info GB (_DxB__eq_bool)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_bool)
+GrB_Info GB (_AaddB__isle_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33231,7 +33357,7 @@ GrB_Info GB (_AaddB__eq_bool)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_bool)
+GrB_Info GB (_AemultB_08__isle_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33249,7 +33375,7 @@ GrB_Info GB (_AemultB_08__eq_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_bool)
+GrB_Info GB (_AemultB_02__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33261,7 +33387,7 @@ GrB_Info GB (_AemultB_02__eq_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_bool)
+GrB_Info GB (_AemultB_04__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33271,7 +33397,7 @@ GrB_Info GB (_AemultB_04__eq_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_bool)
+GrB_Info GB (_AemultB_bitmap__isle_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -33284,10 +33410,17 @@ GrB_Info GB (_AemultB_bitmap__eq_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_bool)
+GrB_Info GB (_bind1st__isle_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33296,7 +33429,7 @@ GrB_Info GB (_bind1st__eq_bool)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_bool)
+GrB_Info GB (_bind1st_tran__isle_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33306,7 +33439,7 @@ GrB_Info GB (_bind1st_tran__eq_bool)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_bool)
+GrB_Info GB (_bind2nd__isle_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33315,7 +33448,7 @@ GrB_Info GB (_bind2nd__eq_bool)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_bool)
+GrB_Info GB (_bind2nd_tran__isle_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33339,7 +33472,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_int8)
+void GB (_Cdense_ewise3_noaccum__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33347,14 +33480,14 @@ void GB (_Cdense_ewise3_noaccum__eq_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_int8)
+GrB_Info GB (_Cdense_accumB__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_int8)
+GrB_Info GB (_Cdense_accumb__isle_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -33362,14 +33495,14 @@ GrB_Info GB (_Cdense_accumb__eq_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_int8)
+GrB_Info GB (_AxD__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_int8)
+GrB_Info GB (_DxB__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -33378,7 +33511,7 @@ GrB_Info GB (_DxB__eq_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_int8)
+GrB_Info GB (_AaddB__isle_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33401,7 +33534,7 @@ GrB_Info GB (_AaddB__eq_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_int8)
+GrB_Info GB (_AemultB_08__isle_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33419,7 +33552,7 @@ GrB_Info GB (_AemultB_08__eq_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_int8)
+GrB_Info GB (_AemultB_02__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33431,7 +33564,7 @@ GrB_Info GB (_AemultB_02__eq_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_int8)
+GrB_Info GB (_AemultB_04__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33441,7 +33574,7 @@ GrB_Info GB (_AemultB_04__eq_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_int8)
+GrB_Info GB (_AemultB_bitmap__isle_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -33454,180 +33587,17 @@ GrB_Info GB (_AemultB_bitmap__eq_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__eq_int8)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__eq_int8)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__eq_int8)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__eq_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__eq_int16)
+GrB_Info GB (_AkronB__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__eq_int16)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__eq_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__eq_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__eq_int16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__eq_int16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__eq_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__eq_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__eq_int16)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__eq_int16)
+GrB_Info GB (_bind1st__isle_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33636,7 +33606,7 @@ GrB_Info GB (_bind1st__eq_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_int16)
+GrB_Info GB (_bind1st_tran__isle_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33646,7 +33616,7 @@ GrB_Info GB (_bind1st_tran__eq_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_int16)
+GrB_Info GB (_bind2nd__isle_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33655,7 +33625,7 @@ GrB_Info GB (_bind2nd__eq_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_int16)
+GrB_Info GB (_bind2nd_tran__isle_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33679,7 +33649,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_int32)
+void GB (_Cdense_ewise3_noaccum__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33687,14 +33657,14 @@ void GB (_Cdense_ewise3_noaccum__eq_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_int32)
+GrB_Info GB (_Cdense_accumB__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_int32)
+GrB_Info GB (_Cdense_accumb__isle_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -33702,14 +33672,14 @@ GrB_Info GB (_Cdense_accumb__eq_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_int32)
+GrB_Info GB (_AxD__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_int32)
+GrB_Info GB (_DxB__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -33718,7 +33688,7 @@ GrB_Info GB (_DxB__eq_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_int32)
+GrB_Info GB (_AaddB__isle_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33741,7 +33711,7 @@ GrB_Info GB (_AaddB__eq_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_int32)
+GrB_Info GB (_AemultB_08__isle_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33759,7 +33729,7 @@ GrB_Info GB (_AemultB_08__eq_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_int32)
+GrB_Info GB (_AemultB_02__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33771,7 +33741,7 @@ GrB_Info GB (_AemultB_02__eq_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_int32)
+GrB_Info GB (_AemultB_04__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33781,7 +33751,7 @@ GrB_Info GB (_AemultB_04__eq_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_int32)
+GrB_Info GB (_AemultB_bitmap__isle_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -33794,10 +33764,17 @@ GrB_Info GB (_AemultB_bitmap__eq_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_int32)
+GrB_Info GB (_bind1st__isle_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33806,7 +33783,7 @@ GrB_Info GB (_bind1st__eq_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_int32)
+GrB_Info GB (_bind1st_tran__isle_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33816,7 +33793,7 @@ GrB_Info GB (_bind1st_tran__eq_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_int32)
+GrB_Info GB (_bind2nd__isle_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33825,7 +33802,7 @@ GrB_Info GB (_bind2nd__eq_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_int32)
+GrB_Info GB (_bind2nd_tran__isle_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33849,7 +33826,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_int64)
+void GB (_Cdense_ewise3_noaccum__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33857,14 +33834,14 @@ void GB (_Cdense_ewise3_noaccum__eq_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_int64)
+GrB_Info GB (_Cdense_accumB__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_int64)
+GrB_Info GB (_Cdense_accumb__isle_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -33872,14 +33849,14 @@ GrB_Info GB (_Cdense_accumb__eq_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_int64)
+GrB_Info GB (_AxD__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_int64)
+GrB_Info GB (_DxB__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -33888,7 +33865,7 @@ GrB_Info GB (_DxB__eq_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_int64)
+GrB_Info GB (_AaddB__isle_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33911,7 +33888,7 @@ GrB_Info GB (_AaddB__eq_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_int64)
+GrB_Info GB (_AemultB_08__isle_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -33929,7 +33906,7 @@ GrB_Info GB (_AemultB_08__eq_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_int64)
+GrB_Info GB (_AemultB_02__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33941,7 +33918,7 @@ GrB_Info GB (_AemultB_02__eq_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_int64)
+GrB_Info GB (_AemultB_04__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -33951,7 +33928,7 @@ GrB_Info GB (_AemultB_04__eq_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_int64)
+GrB_Info GB (_AemultB_bitmap__isle_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -33964,10 +33941,17 @@ GrB_Info GB (_AemultB_bitmap__eq_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_int64)
+GrB_Info GB (_bind1st__isle_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33976,7 +33960,7 @@ GrB_Info GB (_bind1st__eq_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_int64)
+GrB_Info GB (_bind1st_tran__isle_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33986,7 +33970,7 @@ GrB_Info GB (_bind1st_tran__eq_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_int64)
+GrB_Info GB (_bind2nd__isle_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33995,7 +33979,7 @@ GrB_Info GB (_bind2nd__eq_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_int64)
+GrB_Info GB (_bind2nd_tran__isle_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34019,7 +34003,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_uint8)
+void GB (_Cdense_ewise3_noaccum__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34027,14 +34011,14 @@ void GB (_Cdense_ewise3_noaccum__eq_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_uint8)
+GrB_Info GB (_Cdense_accumB__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_uint8)
+GrB_Info GB (_Cdense_accumb__isle_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -34042,14 +34026,14 @@ GrB_Info GB (_Cdense_accumb__eq_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_uint8)
+GrB_Info GB (_AxD__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_uint8)
+GrB_Info GB (_DxB__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -34058,7 +34042,7 @@ GrB_Info GB (_DxB__eq_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_uint8)
+GrB_Info GB (_AaddB__isle_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34081,7 +34065,7 @@ GrB_Info GB (_AaddB__eq_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_uint8)
+GrB_Info GB (_AemultB_08__isle_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34099,7 +34083,7 @@ GrB_Info GB (_AemultB_08__eq_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_uint8)
+GrB_Info GB (_AemultB_02__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34111,7 +34095,7 @@ GrB_Info GB (_AemultB_02__eq_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_uint8)
+GrB_Info GB (_AemultB_04__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34121,7 +34105,7 @@ GrB_Info GB (_AemultB_04__eq_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_uint8)
+GrB_Info GB (_AemultB_bitmap__isle_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -34134,180 +34118,17 @@ GrB_Info GB (_AemultB_bitmap__eq_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__eq_uint8)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__eq_uint8)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__eq_uint8)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__eq_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__eq_uint16)
+GrB_Info GB (_AkronB__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__eq_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
 
-GrB_Info GB (_AxD__eq_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__eq_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__eq_uint16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__eq_uint16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__eq_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__eq_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__eq_uint16)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__eq_uint16)
+GrB_Info GB (_bind1st__isle_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -34316,7 +34137,7 @@ GrB_Info GB (_bind1st__eq_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_uint16)
+GrB_Info GB (_bind1st_tran__isle_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -34326,7 +34147,7 @@ GrB_Info GB (_bind1st_tran__eq_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_uint16)
+GrB_Info GB (_bind2nd__isle_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -34335,7 +34156,7 @@ GrB_Info GB (_bind2nd__eq_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_uint16)
+GrB_Info GB (_bind2nd_tran__isle_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34359,7 +34180,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_uint32)
+void GB (_Cdense_ewise3_noaccum__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34367,14 +34188,14 @@ void GB (_Cdense_ewise3_noaccum__eq_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_uint32)
+GrB_Info GB (_Cdense_accumB__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_uint32)
+GrB_Info GB (_Cdense_accumb__isle_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -34382,14 +34203,14 @@ GrB_Info GB (_Cdense_accumb__eq_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_uint32)
+GrB_Info GB (_AxD__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_uint32)
+GrB_Info GB (_DxB__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -34398,7 +34219,7 @@ GrB_Info GB (_DxB__eq_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_uint32)
+GrB_Info GB (_AaddB__isle_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34421,7 +34242,7 @@ GrB_Info GB (_AaddB__eq_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_uint32)
+GrB_Info GB (_AemultB_08__isle_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34439,7 +34260,7 @@ GrB_Info GB (_AemultB_08__eq_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_uint32)
+GrB_Info GB (_AemultB_02__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34451,7 +34272,7 @@ GrB_Info GB (_AemultB_02__eq_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_uint32)
+GrB_Info GB (_AemultB_04__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34461,7 +34282,7 @@ GrB_Info GB (_AemultB_04__eq_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_uint32)
+GrB_Info GB (_AemultB_bitmap__isle_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -34474,10 +34295,17 @@ GrB_Info GB (_AemultB_bitmap__eq_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_uint32)
+GrB_Info GB (_bind1st__isle_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -34486,7 +34314,7 @@ GrB_Info GB (_bind1st__eq_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_uint32)
+GrB_Info GB (_bind1st_tran__isle_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -34496,7 +34324,7 @@ GrB_Info GB (_bind1st_tran__eq_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_uint32)
+GrB_Info GB (_bind2nd__isle_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -34505,7 +34333,7 @@ GrB_Info GB (_bind2nd__eq_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_uint32)
+GrB_Info GB (_bind2nd_tran__isle_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34529,7 +34357,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_uint64)
+void GB (_Cdense_ewise3_noaccum__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34537,14 +34365,14 @@ void GB (_Cdense_ewise3_noaccum__eq_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_uint64)
+GrB_Info GB (_Cdense_accumB__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_uint64)
+GrB_Info GB (_Cdense_accumb__isle_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -34552,14 +34380,14 @@ GrB_Info GB (_Cdense_accumb__eq_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_uint64)
+GrB_Info GB (_AxD__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_uint64)
+GrB_Info GB (_DxB__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -34568,7 +34396,7 @@ GrB_Info GB (_DxB__eq_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_uint64)
+GrB_Info GB (_AaddB__isle_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34591,7 +34419,7 @@ GrB_Info GB (_AaddB__eq_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_uint64)
+GrB_Info GB (_AemultB_08__isle_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34609,7 +34437,7 @@ GrB_Info GB (_AemultB_08__eq_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_uint64)
+GrB_Info GB (_AemultB_02__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34621,7 +34449,7 @@ GrB_Info GB (_AemultB_02__eq_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_uint64)
+GrB_Info GB (_AemultB_04__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34631,7 +34459,7 @@ GrB_Info GB (_AemultB_04__eq_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_uint64)
+GrB_Info GB (_AemultB_bitmap__isle_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -34644,10 +34472,17 @@ GrB_Info GB (_AemultB_bitmap__eq_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__isle_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_uint64)
+GrB_Info GB (_bind1st__isle_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -34656,7 +34491,7 @@ GrB_Info GB (_bind1st__eq_uint64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_uint64)
+GrB_Info GB (_bind1st_tran__isle_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -34666,7 +34501,7 @@ GrB_Info GB (_bind1st_tran__eq_uint64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_uint64)
+GrB_Info GB (_bind2nd__isle_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -34675,7 +34510,7 @@ GrB_Info GB (_bind2nd__eq_uint64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_uint64)
+GrB_Info GB (_bind2nd_tran__isle_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34699,7 +34534,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_fp32)
+void GB (_Cdense_ewise3_noaccum__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34707,14 +34542,14 @@ void GB (_Cdense_ewise3_noaccum__eq_fp32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_fp32)
+GrB_Info GB (_Cdense_accumB__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_fp32)
+GrB_Info GB (_Cdense_accumb__eq_bool)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -34722,14 +34557,14 @@ GrB_Info GB (_Cdense_accumb__eq_fp32)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_fp32)
+GrB_Info GB (_AxD__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_fp32)
+GrB_Info GB (_DxB__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -34738,7 +34573,7 @@ GrB_Info GB (_DxB__eq_fp32)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_fp32)
+GrB_Info GB (_AaddB__eq_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34761,7 +34596,7 @@ GrB_Info GB (_AaddB__eq_fp32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_fp32)
+GrB_Info GB (_AemultB_08__eq_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34779,7 +34614,7 @@ GrB_Info GB (_AemultB_08__eq_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_fp32)
+GrB_Info GB (_AemultB_02__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34791,7 +34626,7 @@ GrB_Info GB (_AemultB_02__eq_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_fp32)
+GrB_Info GB (_AemultB_04__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34801,7 +34636,7 @@ GrB_Info GB (_AemultB_04__eq_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_fp32)
+GrB_Info GB (_AemultB_bitmap__eq_bool)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -34814,10 +34649,17 @@ GrB_Info GB (_AemultB_bitmap__eq_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_fp32)
+GrB_Info GB (_bind1st__eq_bool)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -34826,7 +34668,7 @@ GrB_Info GB (_bind1st__eq_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_fp32)
+GrB_Info GB (_bind1st_tran__eq_bool)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -34836,7 +34678,7 @@ GrB_Info GB (_bind1st_tran__eq_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_fp32)
+GrB_Info GB (_bind2nd__eq_bool)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -34845,7 +34687,7 @@ GrB_Info GB (_bind2nd__eq_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_fp32)
+GrB_Info GB (_bind2nd_tran__eq_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34869,7 +34711,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_fp64)
+void GB (_Cdense_ewise3_noaccum__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -34877,14 +34719,14 @@ void GB (_Cdense_ewise3_noaccum__eq_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_fp64)
+GrB_Info GB (_Cdense_accumB__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_fp64)
+GrB_Info GB (_Cdense_accumb__eq_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -34892,14 +34734,14 @@ GrB_Info GB (_Cdense_accumb__eq_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__eq_fp64)
+GrB_Info GB (_AxD__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__eq_fp64)
+GrB_Info GB (_DxB__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -34908,7 +34750,7 @@ GrB_Info GB (_DxB__eq_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__eq_fp64)
+GrB_Info GB (_AaddB__eq_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34931,7 +34773,7 @@ GrB_Info GB (_AaddB__eq_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_fp64)
+GrB_Info GB (_AemultB_08__eq_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -34949,7 +34791,7 @@ GrB_Info GB (_AemultB_08__eq_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_fp64)
+GrB_Info GB (_AemultB_02__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34961,7 +34803,7 @@ GrB_Info GB (_AemultB_02__eq_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_fp64)
+GrB_Info GB (_AemultB_04__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -34971,7 +34813,7 @@ GrB_Info GB (_AemultB_04__eq_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_fp64)
+GrB_Info GB (_AemultB_bitmap__eq_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -34984,10 +34826,17 @@ GrB_Info GB (_AemultB_bitmap__eq_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_fp64)
+GrB_Info GB (_bind1st__eq_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -34996,7 +34845,7 @@ GrB_Info GB (_bind1st__eq_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_fp64)
+GrB_Info GB (_bind1st_tran__eq_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35006,7 +34855,7 @@ GrB_Info GB (_bind1st_tran__eq_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_fp64)
+GrB_Info GB (_bind2nd__eq_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35015,7 +34864,7 @@ GrB_Info GB (_bind2nd__eq_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_fp64)
+GrB_Info GB (_bind2nd_tran__eq_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35039,7 +34888,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_fc32)
+void GB (_Cdense_ewise3_noaccum__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35047,38 +34896,38 @@ void GB (_Cdense_ewise3_noaccum__eq_fc32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_fc32)
+GrB_Info GB (_Cdense_accumB__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_fc32)
+GrB_Info GB (_Cdense_accumb__eq_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
-GrB_Info GB ((none))
+
+GrB_Info GB (_AxD__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB ((none))
+GrB_Info GB (_DxB__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
-#endif
 
-GrB_Info GB (_AaddB__eq_fc32)
+
+GrB_Info GB (_AaddB__eq_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35101,7 +34950,7 @@ GrB_Info GB (_AaddB__eq_fc32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_fc32)
+GrB_Info GB (_AemultB_08__eq_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35119,7 +34968,7 @@ GrB_Info GB (_AemultB_08__eq_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_fc32)
+GrB_Info GB (_AemultB_02__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35131,7 +34980,7 @@ GrB_Info GB (_AemultB_02__eq_fc32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_fc32)
+GrB_Info GB (_AemultB_04__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35141,7 +34990,7 @@ GrB_Info GB (_AemultB_04__eq_fc32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_fc32)
+GrB_Info GB (_AemultB_bitmap__eq_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -35154,10 +35003,17 @@ GrB_Info GB (_AemultB_bitmap__eq_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_fc32)
+GrB_Info GB (_bind1st__eq_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35166,7 +35022,7 @@ GrB_Info GB (_bind1st__eq_fc32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_fc32)
+GrB_Info GB (_bind1st_tran__eq_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35176,7 +35032,7 @@ GrB_Info GB (_bind1st_tran__eq_fc32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_fc32)
+GrB_Info GB (_bind2nd__eq_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35185,7 +35041,7 @@ GrB_Info GB (_bind2nd__eq_fc32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_fc32)
+GrB_Info GB (_bind2nd_tran__eq_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35209,7 +35065,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__eq_fc64)
+void GB (_Cdense_ewise3_noaccum__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35217,38 +35073,38 @@ void GB (_Cdense_ewise3_noaccum__eq_fc64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__eq_fc64)
+GrB_Info GB (_Cdense_accumB__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__eq_fc64)
+GrB_Info GB (_Cdense_accumb__eq_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
-GrB_Info GB ((none))
+
+GrB_Info GB (_AxD__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB ((none))
+GrB_Info GB (_DxB__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
-#endif
 
-GrB_Info GB (_AaddB__eq_fc64)
+
+GrB_Info GB (_AaddB__eq_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35271,7 +35127,7 @@ GrB_Info GB (_AaddB__eq_fc64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__eq_fc64)
+GrB_Info GB (_AemultB_08__eq_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35289,7 +35145,7 @@ GrB_Info GB (_AemultB_08__eq_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__eq_fc64)
+GrB_Info GB (_AemultB_02__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35301,7 +35157,7 @@ GrB_Info GB (_AemultB_02__eq_fc64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__eq_fc64)
+GrB_Info GB (_AemultB_04__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35311,7 +35167,7 @@ GrB_Info GB (_AemultB_04__eq_fc64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__eq_fc64)
+GrB_Info GB (_AemultB_bitmap__eq_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -35324,10 +35180,17 @@ GrB_Info GB (_AemultB_bitmap__eq_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__eq_fc64)
+GrB_Info GB (_bind1st__eq_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35336,7 +35199,7 @@ GrB_Info GB (_bind1st__eq_fc64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__eq_fc64)
+GrB_Info GB (_bind1st_tran__eq_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35346,7 +35209,7 @@ GrB_Info GB (_bind1st_tran__eq_fc64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__eq_fc64)
+GrB_Info GB (_bind2nd__eq_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35355,7 +35218,7 @@ GrB_Info GB (_bind2nd__eq_fc64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__eq_fc64)
+GrB_Info GB (_bind2nd_tran__eq_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35379,7 +35242,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_int8)
+void GB (_Cdense_ewise3_noaccum__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35387,14 +35250,14 @@ void GB (_Cdense_ewise3_noaccum__ne_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_int8)
+GrB_Info GB (_Cdense_accumB__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_int8)
+GrB_Info GB (_Cdense_accumb__eq_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -35402,14 +35265,14 @@ GrB_Info GB (_Cdense_accumb__ne_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_int8)
+GrB_Info GB (_AxD__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_int8)
+GrB_Info GB (_DxB__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -35418,7 +35281,7 @@ GrB_Info GB (_DxB__ne_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_int8)
+GrB_Info GB (_AaddB__eq_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35441,7 +35304,7 @@ GrB_Info GB (_AaddB__ne_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_int8)
+GrB_Info GB (_AemultB_08__eq_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35459,7 +35322,7 @@ GrB_Info GB (_AemultB_08__ne_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_int8)
+GrB_Info GB (_AemultB_02__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35471,7 +35334,7 @@ GrB_Info GB (_AemultB_02__ne_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_int8)
+GrB_Info GB (_AemultB_04__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35481,7 +35344,7 @@ GrB_Info GB (_AemultB_04__ne_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_int8)
+GrB_Info GB (_AemultB_bitmap__eq_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -35494,10 +35357,17 @@ GrB_Info GB (_AemultB_bitmap__ne_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_int8)
+GrB_Info GB (_bind1st__eq_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35506,7 +35376,7 @@ GrB_Info GB (_bind1st__ne_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_int8)
+GrB_Info GB (_bind1st_tran__eq_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35516,7 +35386,7 @@ GrB_Info GB (_bind1st_tran__ne_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_int8)
+GrB_Info GB (_bind2nd__eq_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35525,7 +35395,7 @@ GrB_Info GB (_bind2nd__ne_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_int8)
+GrB_Info GB (_bind2nd_tran__eq_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35549,7 +35419,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_int16)
+void GB (_Cdense_ewise3_noaccum__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35557,14 +35427,14 @@ void GB (_Cdense_ewise3_noaccum__ne_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_int16)
+GrB_Info GB (_Cdense_accumB__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_int16)
+GrB_Info GB (_Cdense_accumb__eq_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -35572,14 +35442,14 @@ GrB_Info GB (_Cdense_accumb__ne_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_int16)
+GrB_Info GB (_AxD__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_int16)
+GrB_Info GB (_DxB__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -35588,7 +35458,7 @@ GrB_Info GB (_DxB__ne_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_int16)
+GrB_Info GB (_AaddB__eq_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35611,7 +35481,7 @@ GrB_Info GB (_AaddB__ne_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_int16)
+GrB_Info GB (_AemultB_08__eq_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35629,7 +35499,7 @@ GrB_Info GB (_AemultB_08__ne_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_int16)
+GrB_Info GB (_AemultB_02__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35641,7 +35511,7 @@ GrB_Info GB (_AemultB_02__ne_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_int16)
+GrB_Info GB (_AemultB_04__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35651,7 +35521,7 @@ GrB_Info GB (_AemultB_04__ne_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_int16)
+GrB_Info GB (_AemultB_bitmap__eq_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -35664,10 +35534,17 @@ GrB_Info GB (_AemultB_bitmap__ne_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_int16)
+GrB_Info GB (_bind1st__eq_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35676,7 +35553,7 @@ GrB_Info GB (_bind1st__ne_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_int16)
+GrB_Info GB (_bind1st_tran__eq_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35686,7 +35563,7 @@ GrB_Info GB (_bind1st_tran__ne_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_int16)
+GrB_Info GB (_bind2nd__eq_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35695,7 +35572,7 @@ GrB_Info GB (_bind2nd__ne_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_int16)
+GrB_Info GB (_bind2nd_tran__eq_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35719,7 +35596,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_int32)
+void GB (_Cdense_ewise3_noaccum__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35727,14 +35604,14 @@ void GB (_Cdense_ewise3_noaccum__ne_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_int32)
+GrB_Info GB (_Cdense_accumB__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_int32)
+GrB_Info GB (_Cdense_accumb__eq_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -35742,14 +35619,14 @@ GrB_Info GB (_Cdense_accumb__ne_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_int32)
+GrB_Info GB (_AxD__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_int32)
+GrB_Info GB (_DxB__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -35758,7 +35635,7 @@ GrB_Info GB (_DxB__ne_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_int32)
+GrB_Info GB (_AaddB__eq_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35781,7 +35658,7 @@ GrB_Info GB (_AaddB__ne_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_int32)
+GrB_Info GB (_AemultB_08__eq_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35799,7 +35676,7 @@ GrB_Info GB (_AemultB_08__ne_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_int32)
+GrB_Info GB (_AemultB_02__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35811,7 +35688,7 @@ GrB_Info GB (_AemultB_02__ne_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_int32)
+GrB_Info GB (_AemultB_04__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35821,7 +35698,7 @@ GrB_Info GB (_AemultB_04__ne_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_int32)
+GrB_Info GB (_AemultB_bitmap__eq_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -35834,10 +35711,17 @@ GrB_Info GB (_AemultB_bitmap__ne_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_int32)
+GrB_Info GB (_bind1st__eq_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35846,7 +35730,7 @@ GrB_Info GB (_bind1st__ne_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_int32)
+GrB_Info GB (_bind1st_tran__eq_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35856,7 +35740,7 @@ GrB_Info GB (_bind1st_tran__ne_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_int32)
+GrB_Info GB (_bind2nd__eq_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35865,7 +35749,7 @@ GrB_Info GB (_bind2nd__ne_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_int32)
+GrB_Info GB (_bind2nd_tran__eq_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35889,7 +35773,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_int64)
+void GB (_Cdense_ewise3_noaccum__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35897,14 +35781,14 @@ void GB (_Cdense_ewise3_noaccum__ne_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_int64)
+GrB_Info GB (_Cdense_accumB__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_int64)
+GrB_Info GB (_Cdense_accumb__eq_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -35912,14 +35796,14 @@ GrB_Info GB (_Cdense_accumb__ne_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_int64)
+GrB_Info GB (_AxD__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_int64)
+GrB_Info GB (_DxB__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -35928,7 +35812,7 @@ GrB_Info GB (_DxB__ne_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_int64)
+GrB_Info GB (_AaddB__eq_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35951,7 +35835,7 @@ GrB_Info GB (_AaddB__ne_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_int64)
+GrB_Info GB (_AemultB_08__eq_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -35969,7 +35853,7 @@ GrB_Info GB (_AemultB_08__ne_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_int64)
+GrB_Info GB (_AemultB_02__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35981,7 +35865,7 @@ GrB_Info GB (_AemultB_02__ne_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_int64)
+GrB_Info GB (_AemultB_04__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -35991,7 +35875,7 @@ GrB_Info GB (_AemultB_04__ne_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_int64)
+GrB_Info GB (_AemultB_bitmap__eq_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36004,10 +35888,17 @@ GrB_Info GB (_AemultB_bitmap__ne_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_int64)
+GrB_Info GB (_bind1st__eq_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36016,7 +35907,7 @@ GrB_Info GB (_bind1st__ne_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_int64)
+GrB_Info GB (_bind1st_tran__eq_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36026,7 +35917,7 @@ GrB_Info GB (_bind1st_tran__ne_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_int64)
+GrB_Info GB (_bind2nd__eq_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36035,7 +35926,7 @@ GrB_Info GB (_bind2nd__ne_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_int64)
+GrB_Info GB (_bind2nd_tran__eq_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36059,7 +35950,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_uint8)
+void GB (_Cdense_ewise3_noaccum__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36067,14 +35958,14 @@ void GB (_Cdense_ewise3_noaccum__ne_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_uint8)
+GrB_Info GB (_Cdense_accumB__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_uint8)
+GrB_Info GB (_Cdense_accumb__eq_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -36082,14 +35973,14 @@ GrB_Info GB (_Cdense_accumb__ne_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_uint8)
+GrB_Info GB (_AxD__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_uint8)
+GrB_Info GB (_DxB__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -36098,7 +35989,7 @@ GrB_Info GB (_DxB__ne_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_uint8)
+GrB_Info GB (_AaddB__eq_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36121,7 +36012,7 @@ GrB_Info GB (_AaddB__ne_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_uint8)
+GrB_Info GB (_AemultB_08__eq_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36139,7 +36030,7 @@ GrB_Info GB (_AemultB_08__ne_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_uint8)
+GrB_Info GB (_AemultB_02__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36151,7 +36042,7 @@ GrB_Info GB (_AemultB_02__ne_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_uint8)
+GrB_Info GB (_AemultB_04__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36161,7 +36052,7 @@ GrB_Info GB (_AemultB_04__ne_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_uint8)
+GrB_Info GB (_AemultB_bitmap__eq_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36174,10 +36065,17 @@ GrB_Info GB (_AemultB_bitmap__ne_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_uint8)
+GrB_Info GB (_bind1st__eq_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36186,7 +36084,7 @@ GrB_Info GB (_bind1st__ne_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_uint8)
+GrB_Info GB (_bind1st_tran__eq_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36196,7 +36094,7 @@ GrB_Info GB (_bind1st_tran__ne_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_uint8)
+GrB_Info GB (_bind2nd__eq_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36205,7 +36103,7 @@ GrB_Info GB (_bind2nd__ne_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_uint8)
+GrB_Info GB (_bind2nd_tran__eq_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36229,7 +36127,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_uint16)
+void GB (_Cdense_ewise3_noaccum__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36237,14 +36135,14 @@ void GB (_Cdense_ewise3_noaccum__ne_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_uint16)
+GrB_Info GB (_Cdense_accumB__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_uint16)
+GrB_Info GB (_Cdense_accumb__eq_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -36252,14 +36150,14 @@ GrB_Info GB (_Cdense_accumb__ne_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_uint16)
+GrB_Info GB (_AxD__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_uint16)
+GrB_Info GB (_DxB__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -36268,7 +36166,7 @@ GrB_Info GB (_DxB__ne_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_uint16)
+GrB_Info GB (_AaddB__eq_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36291,7 +36189,7 @@ GrB_Info GB (_AaddB__ne_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_uint16)
+GrB_Info GB (_AemultB_08__eq_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36309,7 +36207,7 @@ GrB_Info GB (_AemultB_08__ne_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_uint16)
+GrB_Info GB (_AemultB_02__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36321,7 +36219,7 @@ GrB_Info GB (_AemultB_02__ne_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_uint16)
+GrB_Info GB (_AemultB_04__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36331,7 +36229,7 @@ GrB_Info GB (_AemultB_04__ne_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_uint16)
+GrB_Info GB (_AemultB_bitmap__eq_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36344,10 +36242,17 @@ GrB_Info GB (_AemultB_bitmap__ne_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_uint16)
+GrB_Info GB (_bind1st__eq_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36356,7 +36261,7 @@ GrB_Info GB (_bind1st__ne_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_uint16)
+GrB_Info GB (_bind1st_tran__eq_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36366,7 +36271,7 @@ GrB_Info GB (_bind1st_tran__ne_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_uint16)
+GrB_Info GB (_bind2nd__eq_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36375,7 +36280,7 @@ GrB_Info GB (_bind2nd__ne_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_uint16)
+GrB_Info GB (_bind2nd_tran__eq_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36399,7 +36304,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_uint32)
+void GB (_Cdense_ewise3_noaccum__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36407,14 +36312,14 @@ void GB (_Cdense_ewise3_noaccum__ne_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_uint32)
+GrB_Info GB (_Cdense_accumB__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_uint32)
+GrB_Info GB (_Cdense_accumb__eq_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -36422,14 +36327,14 @@ GrB_Info GB (_Cdense_accumb__ne_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_uint32)
+GrB_Info GB (_AxD__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_uint32)
+GrB_Info GB (_DxB__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -36438,7 +36343,7 @@ GrB_Info GB (_DxB__ne_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_uint32)
+GrB_Info GB (_AaddB__eq_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36461,7 +36366,7 @@ GrB_Info GB (_AaddB__ne_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_uint32)
+GrB_Info GB (_AemultB_08__eq_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36479,7 +36384,7 @@ GrB_Info GB (_AemultB_08__ne_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_uint32)
+GrB_Info GB (_AemultB_02__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36491,7 +36396,7 @@ GrB_Info GB (_AemultB_02__ne_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_uint32)
+GrB_Info GB (_AemultB_04__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36501,7 +36406,7 @@ GrB_Info GB (_AemultB_04__ne_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_uint32)
+GrB_Info GB (_AemultB_bitmap__eq_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36514,10 +36419,17 @@ GrB_Info GB (_AemultB_bitmap__ne_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_uint32)
+GrB_Info GB (_bind1st__eq_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36526,7 +36438,7 @@ GrB_Info GB (_bind1st__ne_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_uint32)
+GrB_Info GB (_bind1st_tran__eq_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36536,7 +36448,7 @@ GrB_Info GB (_bind1st_tran__ne_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_uint32)
+GrB_Info GB (_bind2nd__eq_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36545,7 +36457,7 @@ GrB_Info GB (_bind2nd__ne_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_uint32)
+GrB_Info GB (_bind2nd_tran__eq_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36569,7 +36481,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_uint64)
+void GB (_Cdense_ewise3_noaccum__eq_fc32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36577,38 +36489,38 @@ void GB (_Cdense_ewise3_noaccum__ne_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_uint64)
+GrB_Info GB (_Cdense_accumB__eq_fc32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_uint64)
+GrB_Info GB (_Cdense_accumb__eq_fc32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-
-GrB_Info GB (_AxD__ne_uint64)
+#if 0
+GrB_Info GB ((none))
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_uint64)
+GrB_Info GB ((none))
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
+#endif
 
-
-GrB_Info GB (_AaddB__ne_uint64)
+GrB_Info GB (_AaddB__eq_fc32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36631,7 +36543,7 @@ GrB_Info GB (_AaddB__ne_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_uint64)
+GrB_Info GB (_AemultB_08__eq_fc32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36649,7 +36561,7 @@ GrB_Info GB (_AemultB_08__ne_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_uint64)
+GrB_Info GB (_AemultB_02__eq_fc32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36661,7 +36573,7 @@ GrB_Info GB (_AemultB_02__ne_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_uint64)
+GrB_Info GB (_AemultB_04__eq_fc32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36671,7 +36583,7 @@ GrB_Info GB (_AemultB_04__ne_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_uint64)
+GrB_Info GB (_AemultB_bitmap__eq_fc32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36684,10 +36596,17 @@ GrB_Info GB (_AemultB_bitmap__ne_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_uint64)
+GrB_Info GB (_bind1st__eq_fc32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36696,7 +36615,7 @@ GrB_Info GB (_bind1st__ne_uint64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_uint64)
+GrB_Info GB (_bind1st_tran__eq_fc32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36706,7 +36625,7 @@ GrB_Info GB (_bind1st_tran__ne_uint64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_uint64)
+GrB_Info GB (_bind2nd__eq_fc32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36715,7 +36634,7 @@ GrB_Info GB (_bind2nd__ne_uint64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_uint64)
+GrB_Info GB (_bind2nd_tran__eq_fc32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36739,7 +36658,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_fp32)
+void GB (_Cdense_ewise3_noaccum__eq_fc64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36747,38 +36666,38 @@ void GB (_Cdense_ewise3_noaccum__ne_fp32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_fp32)
+GrB_Info GB (_Cdense_accumB__eq_fc64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_fp32)
+GrB_Info GB (_Cdense_accumb__eq_fc64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-
-GrB_Info GB (_AxD__ne_fp32)
+#if 0
+GrB_Info GB ((none))
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_fp32)
+GrB_Info GB ((none))
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
+#endif
 
-
-GrB_Info GB (_AaddB__ne_fp32)
+GrB_Info GB (_AaddB__eq_fc64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36801,7 +36720,7 @@ GrB_Info GB (_AaddB__ne_fp32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_fp32)
+GrB_Info GB (_AemultB_08__eq_fc64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36819,7 +36738,7 @@ GrB_Info GB (_AemultB_08__ne_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_fp32)
+GrB_Info GB (_AemultB_02__eq_fc64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36831,7 +36750,7 @@ GrB_Info GB (_AemultB_02__ne_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_fp32)
+GrB_Info GB (_AemultB_04__eq_fc64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -36841,7 +36760,7 @@ GrB_Info GB (_AemultB_04__ne_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_fp32)
+GrB_Info GB (_AemultB_bitmap__eq_fc64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -36854,10 +36773,17 @@ GrB_Info GB (_AemultB_bitmap__ne_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__eq_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_fp32)
+GrB_Info GB (_bind1st__eq_fc64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36866,7 +36792,7 @@ GrB_Info GB (_bind1st__ne_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_fp32)
+GrB_Info GB (_bind1st_tran__eq_fc64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36876,7 +36802,7 @@ GrB_Info GB (_bind1st_tran__ne_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_fp32)
+GrB_Info GB (_bind2nd__eq_fc64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36885,7 +36811,7 @@ GrB_Info GB (_bind2nd__ne_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_fp32)
+GrB_Info GB (_bind2nd_tran__eq_fc64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36909,7 +36835,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_fp64)
+void GB (_Cdense_ewise3_noaccum__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36917,14 +36843,14 @@ void GB (_Cdense_ewise3_noaccum__ne_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_fp64)
+GrB_Info GB (_Cdense_accumB__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_fp64)
+GrB_Info GB (_Cdense_accumb__ne_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -36932,14 +36858,14 @@ GrB_Info GB (_Cdense_accumb__ne_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__ne_fp64)
+GrB_Info GB (_AxD__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ne_fp64)
+GrB_Info GB (_DxB__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -36948,7 +36874,7 @@ GrB_Info GB (_DxB__ne_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__ne_fp64)
+GrB_Info GB (_AaddB__ne_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36971,7 +36897,7 @@ GrB_Info GB (_AaddB__ne_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_fp64)
+GrB_Info GB (_AemultB_08__ne_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -36989,7 +36915,7 @@ GrB_Info GB (_AemultB_08__ne_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_fp64)
+GrB_Info GB (_AemultB_02__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37001,7 +36927,7 @@ GrB_Info GB (_AemultB_02__ne_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_fp64)
+GrB_Info GB (_AemultB_04__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37011,7 +36937,7 @@ GrB_Info GB (_AemultB_04__ne_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_fp64)
+GrB_Info GB (_AemultB_bitmap__ne_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -37024,10 +36950,17 @@ GrB_Info GB (_AemultB_bitmap__ne_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ne_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_fp64)
+GrB_Info GB (_bind1st__ne_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -37036,7 +36969,7 @@ GrB_Info GB (_bind1st__ne_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_fp64)
+GrB_Info GB (_bind1st_tran__ne_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -37046,7 +36979,7 @@ GrB_Info GB (_bind1st_tran__ne_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_fp64)
+GrB_Info GB (_bind2nd__ne_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -37055,7 +36988,7 @@ GrB_Info GB (_bind2nd__ne_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_fp64)
+GrB_Info GB (_bind2nd_tran__ne_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37079,7 +37012,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_fc32)
+void GB (_Cdense_ewise3_noaccum__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37087,38 +37020,38 @@ void GB (_Cdense_ewise3_noaccum__ne_fc32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_fc32)
+GrB_Info GB (_Cdense_accumB__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_fc32)
+GrB_Info GB (_Cdense_accumb__ne_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
-GrB_Info GB ((none))
+
+GrB_Info GB (_AxD__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB ((none))
+GrB_Info GB (_DxB__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
-#endif
 
-GrB_Info GB (_AaddB__ne_fc32)
+
+GrB_Info GB (_AaddB__ne_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37141,7 +37074,7 @@ GrB_Info GB (_AaddB__ne_fc32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ne_fc32)
+GrB_Info GB (_AemultB_08__ne_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37159,7 +37092,7 @@ GrB_Info GB (_AemultB_08__ne_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_fc32)
+GrB_Info GB (_AemultB_02__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37171,7 +37104,7 @@ GrB_Info GB (_AemultB_02__ne_fc32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_fc32)
+GrB_Info GB (_AemultB_04__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37181,7 +37114,7 @@ GrB_Info GB (_AemultB_04__ne_fc32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_fc32)
+GrB_Info GB (_AemultB_bitmap__ne_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -37194,10 +37127,17 @@ GrB_Info GB (_AemultB_bitmap__ne_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ne_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_fc32)
+GrB_Info GB (_bind1st__ne_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -37206,7 +37146,7 @@ GrB_Info GB (_bind1st__ne_fc32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_fc32)
+GrB_Info GB (_bind1st_tran__ne_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -37216,7 +37156,7 @@ GrB_Info GB (_bind1st_tran__ne_fc32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_fc32)
+GrB_Info GB (_bind2nd__ne_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -37225,7 +37165,7 @@ GrB_Info GB (_bind2nd__ne_fc32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_fc32)
+GrB_Info GB (_bind2nd_tran__ne_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37249,7 +37189,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ne_fc64)
+void GB (_Cdense_ewise3_noaccum__ne_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37257,38 +37197,1631 @@ void GB (_Cdense_ewise3_noaccum__ne_fc64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ne_fc64)
+GrB_Info GB (_Cdense_accumB__ne_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ne_fc64)
+GrB_Info GB (_Cdense_accumb__ne_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
-GrB_Info GB ((none))
+
+GrB_Info GB (_AxD__ne_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB ((none))
+GrB_Info GB (_DxB__ne_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
     const GrB_Matrix B,
     int nthreads
 ) ;
-#endif
 
-GrB_Info GB (_AaddB__ne_fc64)
+
+GrB_Info GB (_AaddB__ne_int32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_int32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_int32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_int32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_int32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_int32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_int64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_int64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_int64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_int64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_int64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_int64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_int64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_uint8)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_uint8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_uint8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_uint8)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_uint8)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_uint8)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_uint8)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_uint16)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_uint16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_uint16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_uint16)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_uint16)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_uint32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_uint32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_uint32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_uint32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_uint32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_uint32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_uint32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_uint64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_uint64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_uint64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_uint64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_uint64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_uint64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_uint64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_fp32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_fp32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_fp32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_fp32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_fp32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_fp32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_fp32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_fp64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__ne_fp64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_fp64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_fp64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_fp64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_fc32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+#endif
+
+GrB_Info GB (_AaddB__ne_fc32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__ne_fc32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_fc32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_fc32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_fc32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_fc32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__ne_fc64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+#endif
+
+GrB_Info GB (_AaddB__ne_fc64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37329,7 +38862,1600 @@ GrB_Info GB (_AemultB_08__ne_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ne_fc64)
+GrB_Info GB (_AemultB_02__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__ne_fc64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__ne_fc64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__ne_fc64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__ne_fc64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__ne_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_bool)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_bool)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_bool)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_bool)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_bool)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_bool)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_bool)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_int8)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_int8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_int8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_int8)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_int8)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_int8)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_int8)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_int16)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_int16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_int16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_int16)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_int16)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_int16)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_int16)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_int32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_int32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_int32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_int32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_int32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_int32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_int32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_int64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_int64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_int64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_int64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_int64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_int64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_int64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_uint8)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_uint8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_uint8)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_uint8)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_uint8)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_uint8)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_uint8)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_uint16)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_uint16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_uint16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_uint16)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_uint16)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_uint32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_uint32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_uint32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_uint32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_uint32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_uint32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_uint32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_uint64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_uint64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_uint64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37341,7 +40467,7 @@ GrB_Info GB (_AemultB_02__ne_fc64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ne_fc64)
+GrB_Info GB (_AemultB_04__gt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37351,7 +40477,7 @@ GrB_Info GB (_AemultB_04__ne_fc64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ne_fc64)
+GrB_Info GB (_AemultB_bitmap__gt_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -37364,10 +40490,17 @@ GrB_Info GB (_AemultB_bitmap__ne_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__gt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ne_fc64)
+GrB_Info GB (_bind1st__gt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -37376,7 +40509,7 @@ GrB_Info GB (_bind1st__ne_fc64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ne_fc64)
+GrB_Info GB (_bind1st_tran__gt_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -37386,7 +40519,7 @@ GrB_Info GB (_bind1st_tran__ne_fc64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ne_fc64)
+GrB_Info GB (_bind2nd__gt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -37395,7 +40528,7 @@ GrB_Info GB (_bind2nd__ne_fc64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ne_fc64)
+GrB_Info GB (_bind2nd_tran__gt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37419,7 +40552,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_bool)
+void GB (_Cdense_ewise3_noaccum__gt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37427,14 +40560,14 @@ void GB (_Cdense_ewise3_noaccum__gt_bool)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_bool)
+GrB_Info GB (_Cdense_accumB__gt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_bool)
+GrB_Info GB (_Cdense_accumb__gt_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -37442,14 +40575,14 @@ GrB_Info GB (_Cdense_accumb__gt_bool)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_bool)
+GrB_Info GB (_AxD__gt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_bool)
+GrB_Info GB (_DxB__gt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -37458,7 +40591,361 @@ GrB_Info GB (_DxB__gt_bool)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_bool)
+GrB_Info GB (_AaddB__gt_fp32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_fp32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_fp32)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_fp32)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_fp32)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_fp32)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__gt_fp64)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__gt_fp64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__gt_fp64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__gt_fp64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__gt_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__gt_fp64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__gt_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__gt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__lt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__lt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__lt_bool)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__lt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__lt_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__lt_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37481,7 +40968,7 @@ GrB_Info GB (_AaddB__gt_bool)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_bool)
+GrB_Info GB (_AemultB_08__lt_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37499,7 +40986,7 @@ GrB_Info GB (_AemultB_08__gt_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_bool)
+GrB_Info GB (_AemultB_02__lt_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37511,7 +40998,7 @@ GrB_Info GB (_AemultB_02__gt_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_bool)
+GrB_Info GB (_AemultB_04__lt_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37521,7 +41008,7 @@ GrB_Info GB (_AemultB_04__gt_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_bool)
+GrB_Info GB (_AemultB_bitmap__lt_bool)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -37534,180 +41021,17 @@ GrB_Info GB (_AemultB_bitmap__gt_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__gt_bool)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__gt_bool)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__gt_bool)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__gt_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__gt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__gt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__gt_int8)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__gt_int8)
+GrB_Info GB (_AkronB__lt_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__gt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_int8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__gt_int8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__gt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__gt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__gt_int8)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__gt_int8)
+GrB_Info GB (_bind1st__lt_bool)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -37716,7 +41040,7 @@ GrB_Info GB (_bind1st__gt_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_int8)
+GrB_Info GB (_bind1st_tran__lt_bool)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -37726,7 +41050,7 @@ GrB_Info GB (_bind1st_tran__gt_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_int8)
+GrB_Info GB (_bind2nd__lt_bool)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -37735,7 +41059,7 @@ GrB_Info GB (_bind2nd__gt_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_int8)
+GrB_Info GB (_bind2nd_tran__lt_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37759,7 +41083,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_int16)
+void GB (_Cdense_ewise3_noaccum__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37767,14 +41091,14 @@ void GB (_Cdense_ewise3_noaccum__gt_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_int16)
+GrB_Info GB (_Cdense_accumB__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_int16)
+GrB_Info GB (_Cdense_accumb__lt_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -37782,14 +41106,14 @@ GrB_Info GB (_Cdense_accumb__gt_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_int16)
+GrB_Info GB (_AxD__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_int16)
+GrB_Info GB (_DxB__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -37798,7 +41122,7 @@ GrB_Info GB (_DxB__gt_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_int16)
+GrB_Info GB (_AaddB__lt_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37821,7 +41145,7 @@ GrB_Info GB (_AaddB__gt_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_int16)
+GrB_Info GB (_AemultB_08__lt_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37839,7 +41163,7 @@ GrB_Info GB (_AemultB_08__gt_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_int16)
+GrB_Info GB (_AemultB_02__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37851,7 +41175,7 @@ GrB_Info GB (_AemultB_02__gt_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_int16)
+GrB_Info GB (_AemultB_04__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -37861,7 +41185,7 @@ GrB_Info GB (_AemultB_04__gt_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_int16)
+GrB_Info GB (_AemultB_bitmap__lt_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -37874,10 +41198,17 @@ GrB_Info GB (_AemultB_bitmap__gt_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__gt_int16)
+GrB_Info GB (_bind1st__lt_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -37886,7 +41217,7 @@ GrB_Info GB (_bind1st__gt_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_int16)
+GrB_Info GB (_bind1st_tran__lt_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -37896,7 +41227,7 @@ GrB_Info GB (_bind1st_tran__gt_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_int16)
+GrB_Info GB (_bind2nd__lt_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -37905,7 +41236,7 @@ GrB_Info GB (_bind2nd__gt_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_int16)
+GrB_Info GB (_bind2nd_tran__lt_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37929,7 +41260,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_int32)
+void GB (_Cdense_ewise3_noaccum__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -37937,14 +41268,14 @@ void GB (_Cdense_ewise3_noaccum__gt_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_int32)
+GrB_Info GB (_Cdense_accumB__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_int32)
+GrB_Info GB (_Cdense_accumb__lt_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -37952,14 +41283,14 @@ GrB_Info GB (_Cdense_accumb__gt_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_int32)
+GrB_Info GB (_AxD__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_int32)
+GrB_Info GB (_DxB__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -37968,7 +41299,7 @@ GrB_Info GB (_DxB__gt_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_int32)
+GrB_Info GB (_AaddB__lt_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -37991,7 +41322,7 @@ GrB_Info GB (_AaddB__gt_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_int32)
+GrB_Info GB (_AemultB_08__lt_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38009,7 +41340,7 @@ GrB_Info GB (_AemultB_08__gt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_int32)
+GrB_Info GB (_AemultB_02__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38021,7 +41352,7 @@ GrB_Info GB (_AemultB_02__gt_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_int32)
+GrB_Info GB (_AemultB_04__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38031,7 +41362,7 @@ GrB_Info GB (_AemultB_04__gt_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_int32)
+GrB_Info GB (_AemultB_bitmap__lt_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -38044,10 +41375,17 @@ GrB_Info GB (_AemultB_bitmap__gt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__gt_int32)
+GrB_Info GB (_bind1st__lt_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -38056,7 +41394,7 @@ GrB_Info GB (_bind1st__gt_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_int32)
+GrB_Info GB (_bind1st_tran__lt_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -38066,7 +41404,7 @@ GrB_Info GB (_bind1st_tran__gt_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_int32)
+GrB_Info GB (_bind2nd__lt_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -38075,7 +41413,7 @@ GrB_Info GB (_bind2nd__gt_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_int32)
+GrB_Info GB (_bind2nd_tran__lt_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38099,7 +41437,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_int64)
+void GB (_Cdense_ewise3_noaccum__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38107,14 +41445,14 @@ void GB (_Cdense_ewise3_noaccum__gt_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_int64)
+GrB_Info GB (_Cdense_accumB__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_int64)
+GrB_Info GB (_Cdense_accumb__lt_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -38122,14 +41460,14 @@ GrB_Info GB (_Cdense_accumb__gt_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_int64)
+GrB_Info GB (_AxD__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_int64)
+GrB_Info GB (_DxB__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -38138,7 +41476,7 @@ GrB_Info GB (_DxB__gt_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_int64)
+GrB_Info GB (_AaddB__lt_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38161,7 +41499,7 @@ GrB_Info GB (_AaddB__gt_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_int64)
+GrB_Info GB (_AemultB_08__lt_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38179,7 +41517,7 @@ GrB_Info GB (_AemultB_08__gt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_int64)
+GrB_Info GB (_AemultB_02__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38191,7 +41529,7 @@ GrB_Info GB (_AemultB_02__gt_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_int64)
+GrB_Info GB (_AemultB_04__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38201,7 +41539,7 @@ GrB_Info GB (_AemultB_04__gt_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_int64)
+GrB_Info GB (_AemultB_bitmap__lt_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -38214,180 +41552,17 @@ GrB_Info GB (_AemultB_bitmap__gt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__gt_int64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__gt_int64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__gt_int64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__gt_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__gt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__gt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__gt_uint8)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__gt_uint8)
+GrB_Info GB (_AkronB__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__gt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_uint8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__gt_uint8)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__gt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__gt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__gt_uint8)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__gt_uint8)
+GrB_Info GB (_bind1st__lt_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -38396,7 +41571,7 @@ GrB_Info GB (_bind1st__gt_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_uint8)
+GrB_Info GB (_bind1st_tran__lt_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -38406,7 +41581,7 @@ GrB_Info GB (_bind1st_tran__gt_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_uint8)
+GrB_Info GB (_bind2nd__lt_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -38415,7 +41590,7 @@ GrB_Info GB (_bind2nd__gt_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_uint8)
+GrB_Info GB (_bind2nd_tran__lt_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38439,7 +41614,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_uint16)
+void GB (_Cdense_ewise3_noaccum__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38447,14 +41622,14 @@ void GB (_Cdense_ewise3_noaccum__gt_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_uint16)
+GrB_Info GB (_Cdense_accumB__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_uint16)
+GrB_Info GB (_Cdense_accumb__lt_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -38462,14 +41637,14 @@ GrB_Info GB (_Cdense_accumb__gt_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_uint16)
+GrB_Info GB (_AxD__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_uint16)
+GrB_Info GB (_DxB__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -38478,7 +41653,7 @@ GrB_Info GB (_DxB__gt_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_uint16)
+GrB_Info GB (_AaddB__lt_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38501,7 +41676,7 @@ GrB_Info GB (_AaddB__gt_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_uint16)
+GrB_Info GB (_AemultB_08__lt_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38519,7 +41694,7 @@ GrB_Info GB (_AemultB_08__gt_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_uint16)
+GrB_Info GB (_AemultB_02__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38531,7 +41706,7 @@ GrB_Info GB (_AemultB_02__gt_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_uint16)
+GrB_Info GB (_AemultB_04__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38541,7 +41716,7 @@ GrB_Info GB (_AemultB_04__gt_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_uint16)
+GrB_Info GB (_AemultB_bitmap__lt_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -38554,10 +41729,17 @@ GrB_Info GB (_AemultB_bitmap__gt_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__gt_uint16)
+GrB_Info GB (_bind1st__lt_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -38566,7 +41748,7 @@ GrB_Info GB (_bind1st__gt_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_uint16)
+GrB_Info GB (_bind1st_tran__lt_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -38576,7 +41758,7 @@ GrB_Info GB (_bind1st_tran__gt_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_uint16)
+GrB_Info GB (_bind2nd__lt_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -38585,7 +41767,7 @@ GrB_Info GB (_bind2nd__gt_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_uint16)
+GrB_Info GB (_bind2nd_tran__lt_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38609,7 +41791,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_uint32)
+void GB (_Cdense_ewise3_noaccum__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38617,14 +41799,14 @@ void GB (_Cdense_ewise3_noaccum__gt_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_uint32)
+GrB_Info GB (_Cdense_accumB__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_uint32)
+GrB_Info GB (_Cdense_accumb__lt_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -38632,14 +41814,14 @@ GrB_Info GB (_Cdense_accumb__gt_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_uint32)
+GrB_Info GB (_AxD__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_uint32)
+GrB_Info GB (_DxB__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -38648,7 +41830,7 @@ GrB_Info GB (_DxB__gt_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_uint32)
+GrB_Info GB (_AaddB__lt_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38671,7 +41853,7 @@ GrB_Info GB (_AaddB__gt_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_uint32)
+GrB_Info GB (_AemultB_08__lt_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38689,7 +41871,7 @@ GrB_Info GB (_AemultB_08__gt_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_uint32)
+GrB_Info GB (_AemultB_02__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38701,7 +41883,7 @@ GrB_Info GB (_AemultB_02__gt_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_uint32)
+GrB_Info GB (_AemultB_04__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38711,7 +41893,7 @@ GrB_Info GB (_AemultB_04__gt_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_uint32)
+GrB_Info GB (_AemultB_bitmap__lt_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -38724,10 +41906,17 @@ GrB_Info GB (_AemultB_bitmap__gt_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__gt_uint32)
+GrB_Info GB (_bind1st__lt_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -38736,7 +41925,7 @@ GrB_Info GB (_bind1st__gt_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_uint32)
+GrB_Info GB (_bind1st_tran__lt_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -38746,7 +41935,7 @@ GrB_Info GB (_bind1st_tran__gt_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_uint32)
+GrB_Info GB (_bind2nd__lt_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -38755,7 +41944,7 @@ GrB_Info GB (_bind2nd__gt_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_uint32)
+GrB_Info GB (_bind2nd_tran__lt_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38779,7 +41968,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_uint64)
+void GB (_Cdense_ewise3_noaccum__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38787,14 +41976,14 @@ void GB (_Cdense_ewise3_noaccum__gt_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_uint64)
+GrB_Info GB (_Cdense_accumB__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_uint64)
+GrB_Info GB (_Cdense_accumb__lt_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -38802,14 +41991,14 @@ GrB_Info GB (_Cdense_accumb__gt_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_uint64)
+GrB_Info GB (_AxD__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_uint64)
+GrB_Info GB (_DxB__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -38818,7 +42007,7 @@ GrB_Info GB (_DxB__gt_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_uint64)
+GrB_Info GB (_AaddB__lt_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38841,7 +42030,7 @@ GrB_Info GB (_AaddB__gt_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_uint64)
+GrB_Info GB (_AemultB_08__lt_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -38859,7 +42048,7 @@ GrB_Info GB (_AemultB_08__gt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_uint64)
+GrB_Info GB (_AemultB_02__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38871,7 +42060,7 @@ GrB_Info GB (_AemultB_02__gt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_uint64)
+GrB_Info GB (_AemultB_04__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -38881,7 +42070,7 @@ GrB_Info GB (_AemultB_04__gt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_uint64)
+GrB_Info GB (_AemultB_bitmap__lt_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -38894,180 +42083,17 @@ GrB_Info GB (_AemultB_bitmap__gt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__gt_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__gt_uint64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__gt_uint64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__gt_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__gt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__gt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__gt_fp32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__gt_fp32)
+GrB_Info GB (_AkronB__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__gt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__gt_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__gt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__gt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__gt_fp32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__gt_fp32)
+GrB_Info GB (_bind1st__lt_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39076,7 +42102,7 @@ GrB_Info GB (_bind1st__gt_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_fp32)
+GrB_Info GB (_bind1st_tran__lt_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39086,7 +42112,7 @@ GrB_Info GB (_bind1st_tran__gt_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_fp32)
+GrB_Info GB (_bind2nd__lt_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39095,7 +42121,7 @@ GrB_Info GB (_bind2nd__gt_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_fp32)
+GrB_Info GB (_bind2nd_tran__lt_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39119,7 +42145,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__gt_fp64)
+void GB (_Cdense_ewise3_noaccum__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39127,14 +42153,14 @@ void GB (_Cdense_ewise3_noaccum__gt_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__gt_fp64)
+GrB_Info GB (_Cdense_accumB__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__gt_fp64)
+GrB_Info GB (_Cdense_accumb__lt_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -39142,14 +42168,14 @@ GrB_Info GB (_Cdense_accumb__gt_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__gt_fp64)
+GrB_Info GB (_AxD__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__gt_fp64)
+GrB_Info GB (_DxB__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -39158,7 +42184,7 @@ GrB_Info GB (_DxB__gt_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__gt_fp64)
+GrB_Info GB (_AaddB__lt_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39181,7 +42207,7 @@ GrB_Info GB (_AaddB__gt_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__gt_fp64)
+GrB_Info GB (_AemultB_08__lt_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39199,7 +42225,7 @@ GrB_Info GB (_AemultB_08__gt_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__gt_fp64)
+GrB_Info GB (_AemultB_02__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39211,7 +42237,7 @@ GrB_Info GB (_AemultB_02__gt_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__gt_fp64)
+GrB_Info GB (_AemultB_04__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39221,7 +42247,7 @@ GrB_Info GB (_AemultB_04__gt_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__gt_fp64)
+GrB_Info GB (_AemultB_bitmap__lt_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -39234,10 +42260,17 @@ GrB_Info GB (_AemultB_bitmap__gt_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__gt_fp64)
+GrB_Info GB (_bind1st__lt_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39246,7 +42279,7 @@ GrB_Info GB (_bind1st__gt_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__gt_fp64)
+GrB_Info GB (_bind1st_tran__lt_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39256,7 +42289,7 @@ GrB_Info GB (_bind1st_tran__gt_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__gt_fp64)
+GrB_Info GB (_bind2nd__lt_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39265,7 +42298,7 @@ GrB_Info GB (_bind2nd__gt_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__gt_fp64)
+GrB_Info GB (_bind2nd_tran__lt_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39289,7 +42322,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_bool)
+void GB (_Cdense_ewise3_noaccum__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39297,14 +42330,14 @@ void GB (_Cdense_ewise3_noaccum__lt_bool)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_bool)
+GrB_Info GB (_Cdense_accumB__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_bool)
+GrB_Info GB (_Cdense_accumb__lt_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -39312,14 +42345,14 @@ GrB_Info GB (_Cdense_accumb__lt_bool)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_bool)
+GrB_Info GB (_AxD__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_bool)
+GrB_Info GB (_DxB__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -39328,7 +42361,7 @@ GrB_Info GB (_DxB__lt_bool)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_bool)
+GrB_Info GB (_AaddB__lt_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39351,7 +42384,7 @@ GrB_Info GB (_AaddB__lt_bool)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_bool)
+GrB_Info GB (_AemultB_08__lt_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39369,7 +42402,7 @@ GrB_Info GB (_AemultB_08__lt_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_bool)
+GrB_Info GB (_AemultB_02__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39381,7 +42414,7 @@ GrB_Info GB (_AemultB_02__lt_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_bool)
+GrB_Info GB (_AemultB_04__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39391,7 +42424,7 @@ GrB_Info GB (_AemultB_04__lt_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_bool)
+GrB_Info GB (_AemultB_bitmap__lt_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -39404,10 +42437,17 @@ GrB_Info GB (_AemultB_bitmap__lt_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__lt_bool)
+GrB_Info GB (_bind1st__lt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39416,7 +42456,7 @@ GrB_Info GB (_bind1st__lt_bool)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_bool)
+GrB_Info GB (_bind1st_tran__lt_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39426,7 +42466,7 @@ GrB_Info GB (_bind1st_tran__lt_bool)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_bool)
+GrB_Info GB (_bind2nd__lt_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39435,7 +42475,7 @@ GrB_Info GB (_bind2nd__lt_bool)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_bool)
+GrB_Info GB (_bind2nd_tran__lt_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39459,7 +42499,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_int8)
+void GB (_Cdense_ewise3_noaccum__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39467,14 +42507,14 @@ void GB (_Cdense_ewise3_noaccum__lt_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_int8)
+GrB_Info GB (_Cdense_accumB__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_int8)
+GrB_Info GB (_Cdense_accumb__lt_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -39482,14 +42522,14 @@ GrB_Info GB (_Cdense_accumb__lt_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_int8)
+GrB_Info GB (_AxD__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_int8)
+GrB_Info GB (_DxB__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -39498,7 +42538,7 @@ GrB_Info GB (_DxB__lt_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_int8)
+GrB_Info GB (_AaddB__lt_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39521,7 +42561,7 @@ GrB_Info GB (_AaddB__lt_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_int8)
+GrB_Info GB (_AemultB_08__lt_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39539,7 +42579,7 @@ GrB_Info GB (_AemultB_08__lt_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_int8)
+GrB_Info GB (_AemultB_02__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39551,7 +42591,7 @@ GrB_Info GB (_AemultB_02__lt_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_int8)
+GrB_Info GB (_AemultB_04__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39561,7 +42601,7 @@ GrB_Info GB (_AemultB_04__lt_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_int8)
+GrB_Info GB (_AemultB_bitmap__lt_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -39574,180 +42614,17 @@ GrB_Info GB (_AemultB_bitmap__lt_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__lt_int8)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__lt_int8)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__lt_int8)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__lt_int8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__lt_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__lt_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__lt_int16)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__lt_int16)
+GrB_Info GB (_AkronB__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__lt_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_int16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__lt_int16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__lt_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__lt_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__lt_int16)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__lt_int16)
+GrB_Info GB (_bind1st__lt_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39756,7 +42633,7 @@ GrB_Info GB (_bind1st__lt_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_int16)
+GrB_Info GB (_bind1st_tran__lt_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39766,7 +42643,7 @@ GrB_Info GB (_bind1st_tran__lt_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_int16)
+GrB_Info GB (_bind2nd__lt_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39775,7 +42652,7 @@ GrB_Info GB (_bind2nd__lt_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_int16)
+GrB_Info GB (_bind2nd_tran__lt_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39799,7 +42676,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_int32)
+void GB (_Cdense_ewise3_noaccum__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39807,14 +42684,14 @@ void GB (_Cdense_ewise3_noaccum__lt_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_int32)
+GrB_Info GB (_Cdense_accumB__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_int32)
+GrB_Info GB (_Cdense_accumb__lt_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -39822,14 +42699,14 @@ GrB_Info GB (_Cdense_accumb__lt_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_int32)
+GrB_Info GB (_AxD__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_int32)
+GrB_Info GB (_DxB__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -39838,7 +42715,7 @@ GrB_Info GB (_DxB__lt_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_int32)
+GrB_Info GB (_AaddB__lt_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39861,7 +42738,7 @@ GrB_Info GB (_AaddB__lt_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_int32)
+GrB_Info GB (_AemultB_08__lt_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -39879,7 +42756,7 @@ GrB_Info GB (_AemultB_08__lt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_int32)
+GrB_Info GB (_AemultB_02__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39891,7 +42768,7 @@ GrB_Info GB (_AemultB_02__lt_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_int32)
+GrB_Info GB (_AemultB_04__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -39901,7 +42778,7 @@ GrB_Info GB (_AemultB_04__lt_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_int32)
+GrB_Info GB (_AemultB_bitmap__lt_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -39914,10 +42791,17 @@ GrB_Info GB (_AemultB_bitmap__lt_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lt_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__lt_int32)
+GrB_Info GB (_bind1st__lt_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39926,7 +42810,7 @@ GrB_Info GB (_bind1st__lt_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_int32)
+GrB_Info GB (_bind1st_tran__lt_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39936,7 +42820,7 @@ GrB_Info GB (_bind1st_tran__lt_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_int32)
+GrB_Info GB (_bind2nd__lt_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39945,7 +42829,7 @@ GrB_Info GB (_bind2nd__lt_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_int32)
+GrB_Info GB (_bind2nd_tran__lt_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39969,7 +42853,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_int64)
+void GB (_Cdense_ewise3_noaccum__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39977,14 +42861,14 @@ void GB (_Cdense_ewise3_noaccum__lt_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_int64)
+GrB_Info GB (_Cdense_accumB__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_int64)
+GrB_Info GB (_Cdense_accumb__ge_bool)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -39992,14 +42876,14 @@ GrB_Info GB (_Cdense_accumb__lt_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_int64)
+GrB_Info GB (_AxD__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_int64)
+GrB_Info GB (_DxB__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -40008,7 +42892,7 @@ GrB_Info GB (_DxB__lt_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_int64)
+GrB_Info GB (_AaddB__ge_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40031,7 +42915,7 @@ GrB_Info GB (_AaddB__lt_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_int64)
+GrB_Info GB (_AemultB_08__ge_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40049,7 +42933,7 @@ GrB_Info GB (_AemultB_08__lt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_int64)
+GrB_Info GB (_AemultB_02__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40061,7 +42945,7 @@ GrB_Info GB (_AemultB_02__lt_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_int64)
+GrB_Info GB (_AemultB_04__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40071,7 +42955,7 @@ GrB_Info GB (_AemultB_04__lt_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_int64)
+GrB_Info GB (_AemultB_bitmap__ge_bool)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -40084,10 +42968,17 @@ GrB_Info GB (_AemultB_bitmap__lt_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__lt_int64)
+GrB_Info GB (_bind1st__ge_bool)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -40096,7 +42987,7 @@ GrB_Info GB (_bind1st__lt_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_int64)
+GrB_Info GB (_bind1st_tran__ge_bool)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -40106,7 +42997,7 @@ GrB_Info GB (_bind1st_tran__lt_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_int64)
+GrB_Info GB (_bind2nd__ge_bool)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -40115,7 +43006,7 @@ GrB_Info GB (_bind2nd__lt_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_int64)
+GrB_Info GB (_bind2nd_tran__ge_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40139,7 +43030,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_uint8)
+void GB (_Cdense_ewise3_noaccum__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40147,14 +43038,14 @@ void GB (_Cdense_ewise3_noaccum__lt_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_uint8)
+GrB_Info GB (_Cdense_accumB__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_uint8)
+GrB_Info GB (_Cdense_accumb__ge_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -40162,14 +43053,14 @@ GrB_Info GB (_Cdense_accumb__lt_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_uint8)
+GrB_Info GB (_AxD__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_uint8)
+GrB_Info GB (_DxB__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -40178,7 +43069,7 @@ GrB_Info GB (_DxB__lt_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_uint8)
+GrB_Info GB (_AaddB__ge_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40201,7 +43092,7 @@ GrB_Info GB (_AaddB__lt_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_uint8)
+GrB_Info GB (_AemultB_08__ge_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40219,7 +43110,7 @@ GrB_Info GB (_AemultB_08__lt_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_uint8)
+GrB_Info GB (_AemultB_02__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40231,7 +43122,7 @@ GrB_Info GB (_AemultB_02__lt_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_uint8)
+GrB_Info GB (_AemultB_04__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40241,7 +43132,7 @@ GrB_Info GB (_AemultB_04__lt_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_uint8)
+GrB_Info GB (_AemultB_bitmap__ge_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -40254,180 +43145,17 @@ GrB_Info GB (_AemultB_bitmap__lt_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__lt_uint8)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__lt_uint8)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__lt_uint8)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__lt_uint8)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__lt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__lt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__lt_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__lt_uint16)
+GrB_Info GB (_AkronB__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__lt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_uint16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__lt_uint16)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__lt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__lt_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__lt_uint16)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__lt_uint16)
+GrB_Info GB (_bind1st__ge_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -40436,7 +43164,7 @@ GrB_Info GB (_bind1st__lt_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_uint16)
+GrB_Info GB (_bind1st_tran__ge_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -40446,7 +43174,7 @@ GrB_Info GB (_bind1st_tran__lt_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_uint16)
+GrB_Info GB (_bind2nd__ge_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -40455,7 +43183,7 @@ GrB_Info GB (_bind2nd__lt_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_uint16)
+GrB_Info GB (_bind2nd_tran__ge_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40479,7 +43207,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_uint32)
+void GB (_Cdense_ewise3_noaccum__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40487,14 +43215,14 @@ void GB (_Cdense_ewise3_noaccum__lt_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_uint32)
+GrB_Info GB (_Cdense_accumB__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_uint32)
+GrB_Info GB (_Cdense_accumb__ge_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -40502,14 +43230,14 @@ GrB_Info GB (_Cdense_accumb__lt_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_uint32)
+GrB_Info GB (_AxD__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_uint32)
+GrB_Info GB (_DxB__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -40518,7 +43246,7 @@ GrB_Info GB (_DxB__lt_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_uint32)
+GrB_Info GB (_AaddB__ge_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40541,7 +43269,7 @@ GrB_Info GB (_AaddB__lt_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_uint32)
+GrB_Info GB (_AemultB_08__ge_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40559,7 +43287,7 @@ GrB_Info GB (_AemultB_08__lt_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_uint32)
+GrB_Info GB (_AemultB_02__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40571,7 +43299,7 @@ GrB_Info GB (_AemultB_02__lt_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_uint32)
+GrB_Info GB (_AemultB_04__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40581,7 +43309,7 @@ GrB_Info GB (_AemultB_04__lt_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_uint32)
+GrB_Info GB (_AemultB_bitmap__ge_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -40594,10 +43322,17 @@ GrB_Info GB (_AemultB_bitmap__lt_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__lt_uint32)
+GrB_Info GB (_bind1st__ge_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -40606,7 +43341,7 @@ GrB_Info GB (_bind1st__lt_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_uint32)
+GrB_Info GB (_bind1st_tran__ge_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -40616,7 +43351,7 @@ GrB_Info GB (_bind1st_tran__lt_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_uint32)
+GrB_Info GB (_bind2nd__ge_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -40625,7 +43360,7 @@ GrB_Info GB (_bind2nd__lt_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_uint32)
+GrB_Info GB (_bind2nd_tran__ge_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40649,7 +43384,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_uint64)
+void GB (_Cdense_ewise3_noaccum__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40657,14 +43392,14 @@ void GB (_Cdense_ewise3_noaccum__lt_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_uint64)
+GrB_Info GB (_Cdense_accumB__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_uint64)
+GrB_Info GB (_Cdense_accumb__ge_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -40672,14 +43407,14 @@ GrB_Info GB (_Cdense_accumb__lt_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_uint64)
+GrB_Info GB (_AxD__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_uint64)
+GrB_Info GB (_DxB__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -40688,7 +43423,7 @@ GrB_Info GB (_DxB__lt_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_uint64)
+GrB_Info GB (_AaddB__ge_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40711,7 +43446,7 @@ GrB_Info GB (_AaddB__lt_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_uint64)
+GrB_Info GB (_AemultB_08__ge_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40729,7 +43464,7 @@ GrB_Info GB (_AemultB_08__lt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_uint64)
+GrB_Info GB (_AemultB_02__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40741,7 +43476,7 @@ GrB_Info GB (_AemultB_02__lt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_uint64)
+GrB_Info GB (_AemultB_04__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40751,7 +43486,7 @@ GrB_Info GB (_AemultB_04__lt_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_uint64)
+GrB_Info GB (_AemultB_bitmap__ge_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -40764,10 +43499,17 @@ GrB_Info GB (_AemultB_bitmap__lt_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__lt_uint64)
+GrB_Info GB (_bind1st__ge_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -40776,7 +43518,7 @@ GrB_Info GB (_bind1st__lt_uint64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_uint64)
+GrB_Info GB (_bind1st_tran__ge_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -40786,7 +43528,7 @@ GrB_Info GB (_bind1st_tran__lt_uint64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_uint64)
+GrB_Info GB (_bind2nd__ge_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -40795,7 +43537,7 @@ GrB_Info GB (_bind2nd__lt_uint64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_uint64)
+GrB_Info GB (_bind2nd_tran__ge_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40819,7 +43561,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__lt_fp32)
+void GB (_Cdense_ewise3_noaccum__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40827,14 +43569,14 @@ void GB (_Cdense_ewise3_noaccum__lt_fp32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__lt_fp32)
+GrB_Info GB (_Cdense_accumB__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__lt_fp32)
+GrB_Info GB (_Cdense_accumb__ge_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -40842,14 +43584,14 @@ GrB_Info GB (_Cdense_accumb__lt_fp32)
 ) ;
 
 
-GrB_Info GB (_AxD__lt_fp32)
+GrB_Info GB (_AxD__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__lt_fp32)
+GrB_Info GB (_DxB__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -40858,7 +43600,7 @@ GrB_Info GB (_DxB__lt_fp32)
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_fp32)
+GrB_Info GB (_AaddB__ge_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40881,7 +43623,7 @@ GrB_Info GB (_AaddB__lt_fp32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lt_fp32)
+GrB_Info GB (_AemultB_08__ge_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -40899,7 +43641,7 @@ GrB_Info GB (_AemultB_08__lt_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lt_fp32)
+GrB_Info GB (_AemultB_02__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40911,7 +43653,7 @@ GrB_Info GB (_AemultB_02__lt_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lt_fp32)
+GrB_Info GB (_AemultB_04__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -40921,7 +43663,7 @@ GrB_Info GB (_AemultB_04__lt_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lt_fp32)
+GrB_Info GB (_AemultB_bitmap__ge_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -40934,180 +43676,17 @@ GrB_Info GB (_AemultB_bitmap__lt_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__lt_fp32)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__lt_fp32)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__lt_fp32)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__lt_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__lt_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__lt_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__lt_fp64)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__lt_fp64)
+GrB_Info GB (_AkronB__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__lt_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__lt_fp64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__lt_fp64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__lt_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__lt_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__lt_fp64)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__lt_fp64)
+GrB_Info GB (_bind1st__ge_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -41116,7 +43695,7 @@ GrB_Info GB (_bind1st__lt_fp64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__lt_fp64)
+GrB_Info GB (_bind1st_tran__ge_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -41126,7 +43705,7 @@ GrB_Info GB (_bind1st_tran__lt_fp64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__lt_fp64)
+GrB_Info GB (_bind2nd__ge_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -41135,7 +43714,7 @@ GrB_Info GB (_bind2nd__lt_fp64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__lt_fp64)
+GrB_Info GB (_bind2nd_tran__ge_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41159,7 +43738,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_bool)
+void GB (_Cdense_ewise3_noaccum__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41167,14 +43746,14 @@ void GB (_Cdense_ewise3_noaccum__ge_bool)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_bool)
+GrB_Info GB (_Cdense_accumB__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_bool)
+GrB_Info GB (_Cdense_accumb__ge_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -41182,14 +43761,14 @@ GrB_Info GB (_Cdense_accumb__ge_bool)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_bool)
+GrB_Info GB (_AxD__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_bool)
+GrB_Info GB (_DxB__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -41198,7 +43777,7 @@ GrB_Info GB (_DxB__ge_bool)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_bool)
+GrB_Info GB (_AaddB__ge_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41221,7 +43800,7 @@ GrB_Info GB (_AaddB__ge_bool)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_bool)
+GrB_Info GB (_AemultB_08__ge_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41239,7 +43818,7 @@ GrB_Info GB (_AemultB_08__ge_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_bool)
+GrB_Info GB (_AemultB_02__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41251,7 +43830,7 @@ GrB_Info GB (_AemultB_02__ge_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_bool)
+GrB_Info GB (_AemultB_04__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41261,7 +43840,7 @@ GrB_Info GB (_AemultB_04__ge_bool)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_bool)
+GrB_Info GB (_AemultB_bitmap__ge_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -41274,10 +43853,17 @@ GrB_Info GB (_AemultB_bitmap__ge_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_bool)
+GrB_Info GB (_bind1st__ge_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -41286,7 +43872,7 @@ GrB_Info GB (_bind1st__ge_bool)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_bool)
+GrB_Info GB (_bind1st_tran__ge_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -41296,7 +43882,7 @@ GrB_Info GB (_bind1st_tran__ge_bool)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_bool)
+GrB_Info GB (_bind2nd__ge_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -41305,7 +43891,7 @@ GrB_Info GB (_bind2nd__ge_bool)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_bool)
+GrB_Info GB (_bind2nd_tran__ge_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41329,7 +43915,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_int8)
+void GB (_Cdense_ewise3_noaccum__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41337,14 +43923,14 @@ void GB (_Cdense_ewise3_noaccum__ge_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_int8)
+GrB_Info GB (_Cdense_accumB__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_int8)
+GrB_Info GB (_Cdense_accumb__ge_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -41352,14 +43938,14 @@ GrB_Info GB (_Cdense_accumb__ge_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_int8)
+GrB_Info GB (_AxD__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_int8)
+GrB_Info GB (_DxB__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -41368,7 +43954,7 @@ GrB_Info GB (_DxB__ge_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_int8)
+GrB_Info GB (_AaddB__ge_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41391,7 +43977,7 @@ GrB_Info GB (_AaddB__ge_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_int8)
+GrB_Info GB (_AemultB_08__ge_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41409,7 +43995,7 @@ GrB_Info GB (_AemultB_08__ge_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_int8)
+GrB_Info GB (_AemultB_02__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41421,7 +44007,7 @@ GrB_Info GB (_AemultB_02__ge_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_int8)
+GrB_Info GB (_AemultB_04__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41431,7 +44017,7 @@ GrB_Info GB (_AemultB_04__ge_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_int8)
+GrB_Info GB (_AemultB_bitmap__ge_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -41444,10 +44030,17 @@ GrB_Info GB (_AemultB_bitmap__ge_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_int8)
+GrB_Info GB (_bind1st__ge_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -41456,7 +44049,7 @@ GrB_Info GB (_bind1st__ge_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_int8)
+GrB_Info GB (_bind1st_tran__ge_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -41466,7 +44059,7 @@ GrB_Info GB (_bind1st_tran__ge_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_int8)
+GrB_Info GB (_bind2nd__ge_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -41475,7 +44068,7 @@ GrB_Info GB (_bind2nd__ge_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_int8)
+GrB_Info GB (_bind2nd_tran__ge_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41499,7 +44092,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_int16)
+void GB (_Cdense_ewise3_noaccum__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41507,14 +44100,14 @@ void GB (_Cdense_ewise3_noaccum__ge_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_int16)
+GrB_Info GB (_Cdense_accumB__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_int16)
+GrB_Info GB (_Cdense_accumb__ge_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -41522,14 +44115,14 @@ GrB_Info GB (_Cdense_accumb__ge_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_int16)
+GrB_Info GB (_AxD__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_int16)
+GrB_Info GB (_DxB__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -41538,7 +44131,7 @@ GrB_Info GB (_DxB__ge_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_int16)
+GrB_Info GB (_AaddB__ge_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41561,7 +44154,7 @@ GrB_Info GB (_AaddB__ge_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_int16)
+GrB_Info GB (_AemultB_08__ge_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41579,7 +44172,7 @@ GrB_Info GB (_AemultB_08__ge_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_int16)
+GrB_Info GB (_AemultB_02__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41591,7 +44184,7 @@ GrB_Info GB (_AemultB_02__ge_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_int16)
+GrB_Info GB (_AemultB_04__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41601,7 +44194,7 @@ GrB_Info GB (_AemultB_04__ge_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_int16)
+GrB_Info GB (_AemultB_bitmap__ge_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -41614,180 +44207,17 @@ GrB_Info GB (_AemultB_bitmap__ge_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__ge_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__ge_int16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__ge_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__ge_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__ge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__ge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__ge_int32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__ge_int32)
+GrB_Info GB (_AkronB__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__ge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__ge_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__ge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__ge_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__ge_int32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__ge_int32)
+GrB_Info GB (_bind1st__ge_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -41796,7 +44226,7 @@ GrB_Info GB (_bind1st__ge_int32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_int32)
+GrB_Info GB (_bind1st_tran__ge_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -41806,7 +44236,7 @@ GrB_Info GB (_bind1st_tran__ge_int32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_int32)
+GrB_Info GB (_bind2nd__ge_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -41815,7 +44245,7 @@ GrB_Info GB (_bind2nd__ge_int32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_int32)
+GrB_Info GB (_bind2nd_tran__ge_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41839,7 +44269,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_int64)
+void GB (_Cdense_ewise3_noaccum__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -41847,14 +44277,14 @@ void GB (_Cdense_ewise3_noaccum__ge_int64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_int64)
+GrB_Info GB (_Cdense_accumB__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_int64)
+GrB_Info GB (_Cdense_accumb__ge_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -41862,14 +44292,14 @@ GrB_Info GB (_Cdense_accumb__ge_int64)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_int64)
+GrB_Info GB (_AxD__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_int64)
+GrB_Info GB (_DxB__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -41878,7 +44308,7 @@ GrB_Info GB (_DxB__ge_int64)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_int64)
+GrB_Info GB (_AaddB__ge_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41901,7 +44331,7 @@ GrB_Info GB (_AaddB__ge_int64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_int64)
+GrB_Info GB (_AemultB_08__ge_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -41919,7 +44349,7 @@ GrB_Info GB (_AemultB_08__ge_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_int64)
+GrB_Info GB (_AemultB_02__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41931,7 +44361,7 @@ GrB_Info GB (_AemultB_02__ge_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_int64)
+GrB_Info GB (_AemultB_04__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -41941,7 +44371,7 @@ GrB_Info GB (_AemultB_04__ge_int64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_int64)
+GrB_Info GB (_AemultB_bitmap__ge_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -41954,10 +44384,17 @@ GrB_Info GB (_AemultB_bitmap__ge_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_int64)
+GrB_Info GB (_bind1st__ge_uint64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -41966,7 +44403,7 @@ GrB_Info GB (_bind1st__ge_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_int64)
+GrB_Info GB (_bind1st_tran__ge_uint64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -41976,7 +44413,7 @@ GrB_Info GB (_bind1st_tran__ge_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_int64)
+GrB_Info GB (_bind2nd__ge_uint64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -41985,7 +44422,7 @@ GrB_Info GB (_bind2nd__ge_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_int64)
+GrB_Info GB (_bind2nd_tran__ge_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42009,7 +44446,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_uint8)
+void GB (_Cdense_ewise3_noaccum__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42017,14 +44454,14 @@ void GB (_Cdense_ewise3_noaccum__ge_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_uint8)
+GrB_Info GB (_Cdense_accumB__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_uint8)
+GrB_Info GB (_Cdense_accumb__ge_fp32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42032,14 +44469,14 @@ GrB_Info GB (_Cdense_accumb__ge_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_uint8)
+GrB_Info GB (_AxD__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_uint8)
+GrB_Info GB (_DxB__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -42048,7 +44485,7 @@ GrB_Info GB (_DxB__ge_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_uint8)
+GrB_Info GB (_AaddB__ge_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42071,7 +44508,7 @@ GrB_Info GB (_AaddB__ge_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_uint8)
+GrB_Info GB (_AemultB_08__ge_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42089,7 +44526,7 @@ GrB_Info GB (_AemultB_08__ge_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_uint8)
+GrB_Info GB (_AemultB_02__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42101,7 +44538,7 @@ GrB_Info GB (_AemultB_02__ge_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_uint8)
+GrB_Info GB (_AemultB_04__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42111,7 +44548,7 @@ GrB_Info GB (_AemultB_04__ge_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_uint8)
+GrB_Info GB (_AemultB_bitmap__ge_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -42124,10 +44561,17 @@ GrB_Info GB (_AemultB_bitmap__ge_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ge_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_uint8)
+GrB_Info GB (_bind1st__ge_fp32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42136,7 +44580,7 @@ GrB_Info GB (_bind1st__ge_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_uint8)
+GrB_Info GB (_bind1st_tran__ge_fp32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42146,7 +44590,7 @@ GrB_Info GB (_bind1st_tran__ge_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_uint8)
+GrB_Info GB (_bind2nd__ge_fp32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42155,7 +44599,7 @@ GrB_Info GB (_bind2nd__ge_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_uint8)
+GrB_Info GB (_bind2nd_tran__ge_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42179,7 +44623,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_uint16)
+void GB (_Cdense_ewise3_noaccum__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42187,14 +44631,14 @@ void GB (_Cdense_ewise3_noaccum__ge_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_uint16)
+GrB_Info GB (_Cdense_accumB__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_uint16)
+GrB_Info GB (_Cdense_accumb__ge_fp64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42202,14 +44646,14 @@ GrB_Info GB (_Cdense_accumb__ge_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_uint16)
+GrB_Info GB (_AxD__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_uint16)
+GrB_Info GB (_DxB__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -42218,7 +44662,7 @@ GrB_Info GB (_DxB__ge_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_uint16)
+GrB_Info GB (_AaddB__ge_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42241,7 +44685,7 @@ GrB_Info GB (_AaddB__ge_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_uint16)
+GrB_Info GB (_AemultB_08__ge_fp64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42259,7 +44703,7 @@ GrB_Info GB (_AemultB_08__ge_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_uint16)
+GrB_Info GB (_AemultB_02__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42271,7 +44715,7 @@ GrB_Info GB (_AemultB_02__ge_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_uint16)
+GrB_Info GB (_AemultB_04__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42281,7 +44725,7 @@ GrB_Info GB (_AemultB_04__ge_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_uint16)
+GrB_Info GB (_AemultB_bitmap__ge_fp64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -42294,180 +44738,17 @@ GrB_Info GB (_AemultB_bitmap__ge_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__ge_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__ge_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__ge_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__ge_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__ge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__ge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__ge_uint32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__ge_uint32)
+GrB_Info GB (_AkronB__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__ge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__ge_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__ge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__ge_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__ge_uint32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__ge_uint32)
+GrB_Info GB (_bind1st__ge_fp64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42476,7 +44757,7 @@ GrB_Info GB (_bind1st__ge_uint32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_uint32)
+GrB_Info GB (_bind1st_tran__ge_fp64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42486,7 +44767,7 @@ GrB_Info GB (_bind1st_tran__ge_uint32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_uint32)
+GrB_Info GB (_bind2nd__ge_fp64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42495,7 +44776,7 @@ GrB_Info GB (_bind2nd__ge_uint32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_uint32)
+GrB_Info GB (_bind2nd_tran__ge_fp64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42519,7 +44800,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_uint64)
+void GB (_Cdense_ewise3_noaccum__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42527,14 +44808,14 @@ void GB (_Cdense_ewise3_noaccum__ge_uint64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_uint64)
+GrB_Info GB (_Cdense_accumB__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_uint64)
+GrB_Info GB (_Cdense_accumb__le_bool)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42542,14 +44823,14 @@ GrB_Info GB (_Cdense_accumb__ge_uint64)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_uint64)
+GrB_Info GB (_AxD__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_uint64)
+GrB_Info GB (_DxB__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -42558,7 +44839,7 @@ GrB_Info GB (_DxB__ge_uint64)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_uint64)
+GrB_Info GB (_AaddB__le_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42581,7 +44862,7 @@ GrB_Info GB (_AaddB__ge_uint64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_uint64)
+GrB_Info GB (_AemultB_08__le_bool)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42599,7 +44880,7 @@ GrB_Info GB (_AemultB_08__ge_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_uint64)
+GrB_Info GB (_AemultB_02__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42611,7 +44892,7 @@ GrB_Info GB (_AemultB_02__ge_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_uint64)
+GrB_Info GB (_AemultB_04__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42621,7 +44902,7 @@ GrB_Info GB (_AemultB_04__ge_uint64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_uint64)
+GrB_Info GB (_AemultB_bitmap__le_bool)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -42634,10 +44915,17 @@ GrB_Info GB (_AemultB_bitmap__ge_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_uint64)
+GrB_Info GB (_bind1st__le_bool)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42646,7 +44934,7 @@ GrB_Info GB (_bind1st__ge_uint64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_uint64)
+GrB_Info GB (_bind1st_tran__le_bool)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42656,7 +44944,7 @@ GrB_Info GB (_bind1st_tran__ge_uint64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_uint64)
+GrB_Info GB (_bind2nd__le_bool)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42665,7 +44953,7 @@ GrB_Info GB (_bind2nd__ge_uint64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_uint64)
+GrB_Info GB (_bind2nd_tran__le_bool)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42689,7 +44977,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_fp32)
+void GB (_Cdense_ewise3_noaccum__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42697,14 +44985,14 @@ void GB (_Cdense_ewise3_noaccum__ge_fp32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_fp32)
+GrB_Info GB (_Cdense_accumB__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_fp32)
+GrB_Info GB (_Cdense_accumb__le_int8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42712,14 +45000,14 @@ GrB_Info GB (_Cdense_accumb__ge_fp32)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_fp32)
+GrB_Info GB (_AxD__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_fp32)
+GrB_Info GB (_DxB__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -42728,7 +45016,7 @@ GrB_Info GB (_DxB__ge_fp32)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_fp32)
+GrB_Info GB (_AaddB__le_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42751,7 +45039,7 @@ GrB_Info GB (_AaddB__ge_fp32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_fp32)
+GrB_Info GB (_AemultB_08__le_int8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42769,7 +45057,7 @@ GrB_Info GB (_AemultB_08__ge_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_fp32)
+GrB_Info GB (_AemultB_02__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42781,7 +45069,7 @@ GrB_Info GB (_AemultB_02__ge_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_fp32)
+GrB_Info GB (_AemultB_04__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42791,7 +45079,7 @@ GrB_Info GB (_AemultB_04__ge_fp32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_fp32)
+GrB_Info GB (_AemultB_bitmap__le_int8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -42804,10 +45092,17 @@ GrB_Info GB (_AemultB_bitmap__ge_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__ge_fp32)
+GrB_Info GB (_bind1st__le_int8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42816,7 +45111,7 @@ GrB_Info GB (_bind1st__ge_fp32)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__ge_fp32)
+GrB_Info GB (_bind1st_tran__le_int8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42826,7 +45121,7 @@ GrB_Info GB (_bind1st_tran__ge_fp32)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__ge_fp32)
+GrB_Info GB (_bind2nd__le_int8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42835,7 +45130,7 @@ GrB_Info GB (_bind2nd__ge_fp32)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__ge_fp32)
+GrB_Info GB (_bind2nd_tran__le_int8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42859,7 +45154,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__ge_fp64)
+void GB (_Cdense_ewise3_noaccum__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42867,14 +45162,14 @@ void GB (_Cdense_ewise3_noaccum__ge_fp64)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__ge_fp64)
+GrB_Info GB (_Cdense_accumB__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__ge_fp64)
+GrB_Info GB (_Cdense_accumb__le_int16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42882,14 +45177,14 @@ GrB_Info GB (_Cdense_accumb__ge_fp64)
 ) ;
 
 
-GrB_Info GB (_AxD__ge_fp64)
+GrB_Info GB (_AxD__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__ge_fp64)
+GrB_Info GB (_DxB__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -42898,7 +45193,7 @@ GrB_Info GB (_DxB__ge_fp64)
 ) ;
 
 
-GrB_Info GB (_AaddB__ge_fp64)
+GrB_Info GB (_AaddB__le_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42921,7 +45216,7 @@ GrB_Info GB (_AaddB__ge_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__ge_fp64)
+GrB_Info GB (_AemultB_08__le_int16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -42939,7 +45234,7 @@ GrB_Info GB (_AemultB_08__ge_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__ge_fp64)
+GrB_Info GB (_AemultB_02__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42951,7 +45246,7 @@ GrB_Info GB (_AemultB_02__ge_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__ge_fp64)
+GrB_Info GB (_AemultB_04__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42961,7 +45256,7 @@ GrB_Info GB (_AemultB_04__ge_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__ge_fp64)
+GrB_Info GB (_AemultB_bitmap__le_int16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -42974,180 +45269,17 @@ GrB_Info GB (_AemultB_bitmap__ge_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__ge_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__ge_fp64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__ge_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__ge_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__le_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__le_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__le_bool)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__le_bool)
+GrB_Info GB (_AkronB__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__le_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__le_bool)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__le_bool)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__le_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__le_bool)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__le_bool)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__le_bool)
+GrB_Info GB (_bind1st__le_int16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43156,7 +45288,7 @@ GrB_Info GB (_bind1st__le_bool)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_bool)
+GrB_Info GB (_bind1st_tran__le_int16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43166,7 +45298,7 @@ GrB_Info GB (_bind1st_tran__le_bool)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_bool)
+GrB_Info GB (_bind2nd__le_int16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43175,7 +45307,7 @@ GrB_Info GB (_bind2nd__le_bool)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_bool)
+GrB_Info GB (_bind2nd_tran__le_int16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43199,7 +45331,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_int8)
+void GB (_Cdense_ewise3_noaccum__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43207,14 +45339,14 @@ void GB (_Cdense_ewise3_noaccum__le_int8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_int8)
+GrB_Info GB (_Cdense_accumB__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_int8)
+GrB_Info GB (_Cdense_accumb__le_int32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43222,14 +45354,14 @@ GrB_Info GB (_Cdense_accumb__le_int8)
 ) ;
 
 
-GrB_Info GB (_AxD__le_int8)
+GrB_Info GB (_AxD__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_int8)
+GrB_Info GB (_DxB__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -43238,7 +45370,7 @@ GrB_Info GB (_DxB__le_int8)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_int8)
+GrB_Info GB (_AaddB__le_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43261,7 +45393,7 @@ GrB_Info GB (_AaddB__le_int8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_int8)
+GrB_Info GB (_AemultB_08__le_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43279,7 +45411,7 @@ GrB_Info GB (_AemultB_08__le_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_int8)
+GrB_Info GB (_AemultB_02__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43291,7 +45423,7 @@ GrB_Info GB (_AemultB_02__le_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_int8)
+GrB_Info GB (_AemultB_04__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43301,7 +45433,7 @@ GrB_Info GB (_AemultB_04__le_int8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_int8)
+GrB_Info GB (_AemultB_bitmap__le_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -43314,10 +45446,17 @@ GrB_Info GB (_AemultB_bitmap__le_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__le_int8)
+GrB_Info GB (_bind1st__le_int32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43326,7 +45465,7 @@ GrB_Info GB (_bind1st__le_int8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_int8)
+GrB_Info GB (_bind1st_tran__le_int32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43336,7 +45475,7 @@ GrB_Info GB (_bind1st_tran__le_int8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_int8)
+GrB_Info GB (_bind2nd__le_int32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43345,7 +45484,7 @@ GrB_Info GB (_bind2nd__le_int8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_int8)
+GrB_Info GB (_bind2nd_tran__le_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43369,7 +45508,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_int16)
+void GB (_Cdense_ewise3_noaccum__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43377,14 +45516,14 @@ void GB (_Cdense_ewise3_noaccum__le_int16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_int16)
+GrB_Info GB (_Cdense_accumB__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_int16)
+GrB_Info GB (_Cdense_accumb__le_int64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43392,14 +45531,14 @@ GrB_Info GB (_Cdense_accumb__le_int16)
 ) ;
 
 
-GrB_Info GB (_AxD__le_int16)
+GrB_Info GB (_AxD__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_int16)
+GrB_Info GB (_DxB__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -43408,7 +45547,7 @@ GrB_Info GB (_DxB__le_int16)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_int16)
+GrB_Info GB (_AaddB__le_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43431,7 +45570,7 @@ GrB_Info GB (_AaddB__le_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_int16)
+GrB_Info GB (_AemultB_08__le_int64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43449,7 +45588,7 @@ GrB_Info GB (_AemultB_08__le_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_int16)
+GrB_Info GB (_AemultB_02__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43461,7 +45600,7 @@ GrB_Info GB (_AemultB_02__le_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_int16)
+GrB_Info GB (_AemultB_04__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43471,7 +45610,7 @@ GrB_Info GB (_AemultB_04__le_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_int16)
+GrB_Info GB (_AemultB_bitmap__le_int64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -43484,10 +45623,17 @@ GrB_Info GB (_AemultB_bitmap__le_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__le_int16)
+GrB_Info GB (_bind1st__le_int64)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43496,7 +45642,7 @@ GrB_Info GB (_bind1st__le_int16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_int16)
+GrB_Info GB (_bind1st_tran__le_int64)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43506,7 +45652,7 @@ GrB_Info GB (_bind1st_tran__le_int16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_int16)
+GrB_Info GB (_bind2nd__le_int64)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43515,7 +45661,7 @@ GrB_Info GB (_bind2nd__le_int16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_int16)
+GrB_Info GB (_bind2nd_tran__le_int64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43539,7 +45685,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_int32)
+void GB (_Cdense_ewise3_noaccum__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43547,14 +45693,14 @@ void GB (_Cdense_ewise3_noaccum__le_int32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_int32)
+GrB_Info GB (_Cdense_accumB__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_int32)
+GrB_Info GB (_Cdense_accumb__le_uint8)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43562,14 +45708,14 @@ GrB_Info GB (_Cdense_accumb__le_int32)
 ) ;
 
 
-GrB_Info GB (_AxD__le_int32)
+GrB_Info GB (_AxD__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_int32)
+GrB_Info GB (_DxB__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -43578,7 +45724,7 @@ GrB_Info GB (_DxB__le_int32)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_int32)
+GrB_Info GB (_AaddB__le_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43601,7 +45747,7 @@ GrB_Info GB (_AaddB__le_int32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_int32)
+GrB_Info GB (_AemultB_08__le_uint8)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43619,7 +45765,7 @@ GrB_Info GB (_AemultB_08__le_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_int32)
+GrB_Info GB (_AemultB_02__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43631,7 +45777,7 @@ GrB_Info GB (_AemultB_02__le_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_int32)
+GrB_Info GB (_AemultB_04__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43641,7 +45787,7 @@ GrB_Info GB (_AemultB_04__le_int32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_int32)
+GrB_Info GB (_AemultB_bitmap__le_uint8)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -43654,180 +45800,17 @@ GrB_Info GB (_AemultB_bitmap__le_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__le_int32)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__le_int32)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__le_int32)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__le_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__le_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__le_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__le_int64)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__le_int64)
+GrB_Info GB (_AkronB__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__le_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
     const GrB_Matrix B,
-    int nthreads
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
-GrB_Info GB (_AaddB__le_int64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
 
-
-GrB_Info GB (_AemultB_08__le_int64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__le_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__le_int64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__le_int64)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-
-GrB_Info GB (_bind1st__le_int64)
+GrB_Info GB (_bind1st__le_uint8)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43836,7 +45819,7 @@ GrB_Info GB (_bind1st__le_int64)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_int64)
+GrB_Info GB (_bind1st_tran__le_uint8)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43846,7 +45829,7 @@ GrB_Info GB (_bind1st_tran__le_int64)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_int64)
+GrB_Info GB (_bind2nd__le_uint8)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43855,7 +45838,7 @@ GrB_Info GB (_bind2nd__le_int64)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_int64)
+GrB_Info GB (_bind2nd_tran__le_uint8)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43879,7 +45862,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_uint8)
+void GB (_Cdense_ewise3_noaccum__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43887,14 +45870,14 @@ void GB (_Cdense_ewise3_noaccum__le_uint8)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_uint8)
+GrB_Info GB (_Cdense_accumB__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_uint8)
+GrB_Info GB (_Cdense_accumb__le_uint16)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43902,14 +45885,14 @@ GrB_Info GB (_Cdense_accumb__le_uint8)
 ) ;
 
 
-GrB_Info GB (_AxD__le_uint8)
+GrB_Info GB (_AxD__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_uint8)
+GrB_Info GB (_DxB__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -43918,7 +45901,7 @@ GrB_Info GB (_DxB__le_uint8)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_uint8)
+GrB_Info GB (_AaddB__le_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43941,7 +45924,7 @@ GrB_Info GB (_AaddB__le_uint8)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_uint8)
+GrB_Info GB (_AemultB_08__le_uint16)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -43959,7 +45942,7 @@ GrB_Info GB (_AemultB_08__le_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_uint8)
+GrB_Info GB (_AemultB_02__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43971,7 +45954,7 @@ GrB_Info GB (_AemultB_02__le_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_uint8)
+GrB_Info GB (_AemultB_04__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43981,7 +45964,7 @@ GrB_Info GB (_AemultB_04__le_uint8)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_uint8)
+GrB_Info GB (_AemultB_bitmap__le_uint16)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -43994,10 +45977,17 @@ GrB_Info GB (_AemultB_bitmap__le_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__le_uint8)
+GrB_Info GB (_bind1st__le_uint16)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44006,7 +45996,7 @@ GrB_Info GB (_bind1st__le_uint8)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_uint8)
+GrB_Info GB (_bind1st_tran__le_uint16)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44016,7 +46006,7 @@ GrB_Info GB (_bind1st_tran__le_uint8)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_uint8)
+GrB_Info GB (_bind2nd__le_uint16)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44025,7 +46015,7 @@ GrB_Info GB (_bind2nd__le_uint8)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_uint8)
+GrB_Info GB (_bind2nd_tran__le_uint16)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44049,7 +46039,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_uint16)
+void GB (_Cdense_ewise3_noaccum__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44057,14 +46047,14 @@ void GB (_Cdense_ewise3_noaccum__le_uint16)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_uint16)
+GrB_Info GB (_Cdense_accumB__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_uint16)
+GrB_Info GB (_Cdense_accumb__le_uint32)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -44072,14 +46062,14 @@ GrB_Info GB (_Cdense_accumb__le_uint16)
 ) ;
 
 
-GrB_Info GB (_AxD__le_uint16)
+GrB_Info GB (_AxD__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_uint16)
+GrB_Info GB (_DxB__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -44088,7 +46078,7 @@ GrB_Info GB (_DxB__le_uint16)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_uint16)
+GrB_Info GB (_AaddB__le_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -44111,7 +46101,7 @@ GrB_Info GB (_AaddB__le_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_uint16)
+GrB_Info GB (_AemultB_08__le_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -44129,7 +46119,7 @@ GrB_Info GB (_AemultB_08__le_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_uint16)
+GrB_Info GB (_AemultB_02__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44141,7 +46131,7 @@ GrB_Info GB (_AemultB_02__le_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_uint16)
+GrB_Info GB (_AemultB_04__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44151,7 +46141,7 @@ GrB_Info GB (_AemultB_04__le_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_uint16)
+GrB_Info GB (_AemultB_bitmap__le_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -44164,10 +46154,17 @@ GrB_Info GB (_AemultB_bitmap__le_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
-GrB_Info GB (_bind1st__le_uint16)
+GrB_Info GB (_bind1st__le_uint32)
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44176,7 +46173,7 @@ GrB_Info GB (_bind1st__le_uint16)
     int64_t bnz,
     int nthreads
 ) ;
-GrB_Info GB (_bind1st_tran__le_uint16)
+GrB_Info GB (_bind1st_tran__le_uint32)
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44186,7 +46183,7 @@ GrB_Info GB (_bind1st_tran__le_uint16)
     int nworkspaces,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd__le_uint16)
+GrB_Info GB (_bind2nd__le_uint32)
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44195,7 +46192,7 @@ GrB_Info GB (_bind2nd__le_uint16)
     int64_t anz,
     int nthreads
 ) ;
-GrB_Info GB (_bind2nd_tran__le_uint16)
+GrB_Info GB (_bind2nd_tran__le_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44219,7 +46216,7 @@ void GB ((none))
 ) ;
 #endif
 
-void GB (_Cdense_ewise3_noaccum__le_uint32)
+void GB (_Cdense_ewise3_noaccum__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44227,14 +46224,14 @@ void GB (_Cdense_ewise3_noaccum__le_uint32)
     const int nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumB__le_uint32)
+GrB_Info GB (_Cdense_accumB__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix B,
     const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
 ) ;
 
-GrB_Info GB (_Cdense_accumb__le_uint32)
+GrB_Info GB (_Cdense_accumb__le_uint64)
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -44242,14 +46239,14 @@ GrB_Info GB (_Cdense_accumb__le_uint32)
 ) ;
 
 
-GrB_Info GB (_AxD__le_uint32)
+GrB_Info GB (_AxD__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix D,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_DxB__le_uint32)
+GrB_Info GB (_DxB__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix D,
@@ -44258,7 +46255,7 @@ GrB_Info GB (_DxB__le_uint32)
 ) ;
 
 
-GrB_Info GB (_AaddB__le_uint32)
+GrB_Info GB (_AaddB__le_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -44281,7 +46278,7 @@ GrB_Info GB (_AaddB__le_uint32)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__le_uint32)
+GrB_Info GB (_AemultB_08__le_uint64)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -44299,7 +46296,7 @@ GrB_Info GB (_AemultB_08__le_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__le_uint32)
+GrB_Info GB (_AemultB_02__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44311,7 +46308,7 @@ GrB_Info GB (_AemultB_02__le_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__le_uint32)
+GrB_Info GB (_AemultB_04__le_uint64)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44321,7 +46318,7 @@ GrB_Info GB (_AemultB_04__le_uint32)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__le_uint32)
+GrB_Info GB (_AemultB_bitmap__le_uint64)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -44334,175 +46331,12 @@ GrB_Info GB (_AemultB_bitmap__le_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__le_uint32)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__le_uint32)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__le_uint32)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__le_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__le_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__le_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__le_uint64)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__le_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__le_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__le_uint64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__le_uint64)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__le_uint64)
+GrB_Info GB (_AkronB__le_uint64)
 (
     GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__le_uint64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__le_uint64)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
@@ -44674,6 +46508,13 @@ GrB_Info GB (_AemultB_bitmap__le_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -44844,6 +46685,13 @@ GrB_Info GB (_AemultB_bitmap__le_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__le_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45014,6 +46862,13 @@ GrB_Info GB (_AemultB_bitmap__lor_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45184,6 +47039,13 @@ GrB_Info GB (_AemultB_bitmap__lor_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45354,6 +47216,13 @@ GrB_Info GB (_AemultB_bitmap__lor_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45524,6 +47393,13 @@ GrB_Info GB (_AemultB_bitmap__lor_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45694,6 +47570,13 @@ GrB_Info GB (_AemultB_bitmap__lor_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -45864,6 +47747,13 @@ GrB_Info GB (_AemultB_bitmap__lor_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46034,6 +47924,13 @@ GrB_Info GB (_AemultB_bitmap__lor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46204,6 +48101,13 @@ GrB_Info GB (_AemultB_bitmap__lor_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46374,6 +48278,13 @@ GrB_Info GB (_AemultB_bitmap__lor_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46544,6 +48455,13 @@ GrB_Info GB (_AemultB_bitmap__lor_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46714,6 +48632,13 @@ GrB_Info GB (_AemultB_bitmap__lor_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lor_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -46884,6 +48809,13 @@ GrB_Info GB (_AemultB_bitmap__land_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47054,6 +48986,13 @@ GrB_Info GB (_AemultB_bitmap__land_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47224,6 +49163,13 @@ GrB_Info GB (_AemultB_bitmap__land_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47394,6 +49340,13 @@ GrB_Info GB (_AemultB_bitmap__land_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47564,6 +49517,13 @@ GrB_Info GB (_AemultB_bitmap__land_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47734,6 +49694,13 @@ GrB_Info GB (_AemultB_bitmap__land_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -47904,6 +49871,13 @@ GrB_Info GB (_AemultB_bitmap__land_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48074,6 +50048,13 @@ GrB_Info GB (_AemultB_bitmap__land_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48244,6 +50225,13 @@ GrB_Info GB (_AemultB_bitmap__land_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48414,6 +50402,13 @@ GrB_Info GB (_AemultB_bitmap__land_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48584,6 +50579,13 @@ GrB_Info GB (_AemultB_bitmap__land_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__land_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48754,6 +50756,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_bool)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_bool)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -48924,6 +50933,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49094,6 +51110,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49264,6 +51287,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49434,6 +51464,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49604,6 +51641,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49774,6 +51818,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -49944,6 +51995,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -50114,6 +52172,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -50284,6 +52349,13 @@ GrB_Info GB (_AemultB_bitmap__lxor_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__lxor_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -50401,7 +52473,184 @@ GrB_Info GB (_AaddB__lxor_fp64)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__lxor_fp64)
+GrB_Info GB (_AemultB_08__lxor_fp64)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__lxor_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__lxor_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__lxor_fp64)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__lxor_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__lxor_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__lxor_fp64)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__lxor_fp64)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__lxor_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__atan2_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__atan2_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__atan2_fp32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+#endif
+
+GrB_Info GB (_AaddB__atan2_fp32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__atan2_fp32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -50419,7 +52668,7 @@ GrB_Info GB (_AemultB_08__lxor_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__lxor_fp64)
+GrB_Info GB (_AemultB_02__atan2_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50431,7 +52680,7 @@ GrB_Info GB (_AemultB_02__lxor_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__lxor_fp64)
+GrB_Info GB (_AemultB_04__atan2_fp32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50441,7 +52690,7 @@ GrB_Info GB (_AemultB_04__lxor_fp64)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__lxor_fp64)
+GrB_Info GB (_AemultB_bitmap__atan2_fp32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -50454,175 +52703,12 @@ GrB_Info GB (_AemultB_bitmap__lxor_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__lxor_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__lxor_fp64)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__lxor_fp64)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__lxor_fp64)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__atan2_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__atan2_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__atan2_fp32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-#if 0
-GrB_Info GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-#endif
-
-GrB_Info GB (_AaddB__atan2_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__atan2_fp32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__atan2_fp32)
+GrB_Info GB (_AkronB__atan2_fp32)
 (
     GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__atan2_fp32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__atan2_fp32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
@@ -50794,6 +52880,13 @@ GrB_Info GB (_AemultB_bitmap__atan2_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__atan2_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -50964,6 +53057,13 @@ GrB_Info GB (_AemultB_bitmap__hypot_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__hypot_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51134,6 +53234,13 @@ GrB_Info GB (_AemultB_bitmap__hypot_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__hypot_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51304,6 +53411,13 @@ GrB_Info GB (_AemultB_bitmap__fmod_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__fmod_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51474,6 +53588,13 @@ GrB_Info GB (_AemultB_bitmap__fmod_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__fmod_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51644,6 +53765,13 @@ GrB_Info GB (_AemultB_bitmap__remainder_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__remainder_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51814,6 +53942,13 @@ GrB_Info GB (_AemultB_bitmap__remainder_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__remainder_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -51984,6 +54119,13 @@ GrB_Info GB (_AemultB_bitmap__copysign_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__copysign_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -52154,6 +54296,13 @@ GrB_Info GB (_AemultB_bitmap__copysign_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__copysign_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -52324,6 +54473,13 @@ GrB_Info GB (_AemultB_bitmap__ldexp_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ldexp_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -52494,6 +54650,13 @@ GrB_Info GB (_AemultB_bitmap__ldexp_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__ldexp_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -52664,6 +54827,13 @@ GrB_Info GB (_AemultB_bitmap__cmplx_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__cmplx_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -52834,6 +55004,13 @@ GrB_Info GB (_AemultB_bitmap__cmplx_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__cmplx_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53004,6 +55181,13 @@ GrB_Info GB (_AemultB_bitmap__bor_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53174,6 +55358,13 @@ GrB_Info GB (_AemultB_bitmap__bor_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53344,6 +55535,13 @@ GrB_Info GB (_AemultB_bitmap__bor_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53514,6 +55712,13 @@ GrB_Info GB (_AemultB_bitmap__bor_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53684,6 +55889,13 @@ GrB_Info GB (_AemultB_bitmap__bor_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -53854,6 +56066,13 @@ GrB_Info GB (_AemultB_bitmap__bor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54024,6 +56243,13 @@ GrB_Info GB (_AemultB_bitmap__bor_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54194,6 +56420,13 @@ GrB_Info GB (_AemultB_bitmap__bor_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bor_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54364,6 +56597,13 @@ GrB_Info GB (_AemultB_bitmap__band_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54534,6 +56774,13 @@ GrB_Info GB (_AemultB_bitmap__band_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54704,6 +56951,13 @@ GrB_Info GB (_AemultB_bitmap__band_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -54874,6 +57128,13 @@ GrB_Info GB (_AemultB_bitmap__band_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55044,6 +57305,13 @@ GrB_Info GB (_AemultB_bitmap__band_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55214,6 +57482,13 @@ GrB_Info GB (_AemultB_bitmap__band_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55384,6 +57659,13 @@ GrB_Info GB (_AemultB_bitmap__band_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55554,6 +57836,13 @@ GrB_Info GB (_AemultB_bitmap__band_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__band_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55724,6 +58013,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -55894,6 +58190,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -56064,6 +58367,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -56234,6 +58544,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -56404,6 +58721,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -56521,7 +58845,184 @@ GrB_Info GB (_AaddB__bxor_uint16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__bxor_uint16)
+GrB_Info GB (_AemultB_08__bxor_uint16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__bxor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__bxor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__bxor_uint16)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__bxor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__bxor_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__bxor_uint16)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__bxor_uint16)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__bxor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__bxor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__bxor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__bxor_uint32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+GrB_Info GB (_AxD__bxor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_DxB__bxor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+
+
+GrB_Info GB (_AaddB__bxor_uint32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__bxor_uint32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -56539,7 +59040,7 @@ GrB_Info GB (_AemultB_08__bxor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__bxor_uint16)
+GrB_Info GB (_AemultB_02__bxor_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -56551,7 +59052,7 @@ GrB_Info GB (_AemultB_02__bxor_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__bxor_uint16)
+GrB_Info GB (_AemultB_04__bxor_uint32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -56561,7 +59062,7 @@ GrB_Info GB (_AemultB_04__bxor_uint16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__bxor_uint16)
+GrB_Info GB (_AemultB_bitmap__bxor_uint32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -56574,175 +59075,12 @@ GrB_Info GB (_AemultB_bitmap__bxor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__bxor_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__bxor_uint16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__bxor_uint16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__bxor_uint16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-GrB_Info GB (_AxD__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_DxB__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-
-
-GrB_Info GB (_AaddB__bxor_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__bxor_uint32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__bxor_uint32)
+GrB_Info GB (_AkronB__bxor_uint32)
 (
     GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__bxor_uint32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__bxor_uint32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
@@ -56914,6 +59252,13 @@ GrB_Info GB (_AemultB_bitmap__bxor_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxor_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57084,6 +59429,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57254,6 +59606,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57424,6 +59783,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57594,6 +59960,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57764,6 +60137,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -57934,6 +60314,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58104,6 +60491,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58274,6 +60668,13 @@ GrB_Info GB (_AemultB_bitmap__bxnor_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bxnor_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58444,6 +60845,13 @@ GrB_Info GB (_AemultB_bitmap__bget_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58614,6 +61022,13 @@ GrB_Info GB (_AemultB_bitmap__bget_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58784,6 +61199,13 @@ GrB_Info GB (_AemultB_bitmap__bget_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -58954,6 +61376,13 @@ GrB_Info GB (_AemultB_bitmap__bget_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59124,6 +61553,13 @@ GrB_Info GB (_AemultB_bitmap__bget_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59294,6 +61730,13 @@ GrB_Info GB (_AemultB_bitmap__bget_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59464,6 +61907,13 @@ GrB_Info GB (_AemultB_bitmap__bget_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59634,6 +62084,13 @@ GrB_Info GB (_AemultB_bitmap__bget_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bget_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59804,6 +62261,13 @@ GrB_Info GB (_AemultB_bitmap__bset_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -59974,6 +62438,13 @@ GrB_Info GB (_AemultB_bitmap__bset_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60144,6 +62615,13 @@ GrB_Info GB (_AemultB_bitmap__bset_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60314,6 +62792,13 @@ GrB_Info GB (_AemultB_bitmap__bset_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60484,6 +62969,13 @@ GrB_Info GB (_AemultB_bitmap__bset_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60654,6 +63146,13 @@ GrB_Info GB (_AemultB_bitmap__bset_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60824,6 +63323,13 @@ GrB_Info GB (_AemultB_bitmap__bset_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -60994,6 +63500,13 @@ GrB_Info GB (_AemultB_bitmap__bset_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bset_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -61164,6 +63677,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -61334,6 +63854,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -61504,6 +64031,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -61674,6 +64208,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -61844,6 +64385,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -62014,6 +64562,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -62184,6 +64739,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -62354,6 +64916,13 @@ GrB_Info GB (_AemultB_bitmap__bclr_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bclr_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -62524,6 +65093,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -62641,7 +65217,184 @@ GrB_Info GB (_AaddB__bshift_int16)
 ) ;
 
 
-GrB_Info GB (_AemultB_08__bshift_int16)
+GrB_Info GB (_AemultB_08__bshift_int16)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AemultB_02__bshift_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB (_AemultB_04__bshift_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+GrB_Info GB (_AemultB_bitmap__bshift_int16)
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+GrB_Info GB (_AkronB__bshift_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+
+
+
+GrB_Info GB (_bind1st__bshift_int16)
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    const int8_t *restrict Bb,
+    int64_t bnz,
+    int nthreads
+) ;
+GrB_Info GB (_bind1st_tran__bshift_int16)
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd__bshift_int16)
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    const int8_t *restrict Ab,
+    int64_t anz,
+    int nthreads
+) ;
+GrB_Info GB (_bind2nd_tran__bshift_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *restrict *Workspaces,
+    const int64_t *restrict A_slice,
+    int nworkspaces,
+    int nthreads
+) ;
+
+
+
+// SPDX-License-Identifier: Apache-2.0
+#if 0
+void GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+void GB (_Cdense_ewise3_noaccum__bshift_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumB__bshift_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
+) ;
+
+GrB_Info GB (_Cdense_accumb__bshift_int32)
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix D,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+GrB_Info GB ((none))
+(
+    GrB_Matrix C,
+    const GrB_Matrix D,
+    const GrB_Matrix B,
+    int nthreads
+) ;
+#endif
+
+GrB_Info GB (_AaddB__bshift_int32)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+
+GrB_Info GB (_AemultB_08__bshift_int32)
 (
     GrB_Matrix C,
     const int C_sparsity,
@@ -62659,7 +65412,7 @@ GrB_Info GB (_AemultB_08__bshift_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-GrB_Info GB (_AemultB_02__bshift_int16)
+GrB_Info GB (_AemultB_02__bshift_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -62671,7 +65424,7 @@ GrB_Info GB (_AemultB_02__bshift_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
 ) ;
-GrB_Info GB (_AemultB_04__bshift_int16)
+GrB_Info GB (_AemultB_04__bshift_int32)
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -62681,7 +65434,7 @@ GrB_Info GB (_AemultB_04__bshift_int16)
     const int64_t *restrict Cp_kfirst,
     const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
 ) ;
-GrB_Info GB (_AemultB_bitmap__bshift_int16)
+GrB_Info GB (_AemultB_bitmap__bshift_int32)
 (
     GrB_Matrix C,
     const int ewise_method,
@@ -62694,175 +65447,12 @@ GrB_Info GB (_AemultB_bitmap__bshift_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
-
-
-
-GrB_Info GB (_bind1st__bshift_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    const int8_t *restrict Bb,
-    int64_t bnz,
-    int nthreads
-) ;
-GrB_Info GB (_bind1st_tran__bshift_int16)
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd__bshift_int16)
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    const int8_t *restrict Ab,
-    int64_t anz,
-    int nthreads
-) ;
-GrB_Info GB (_bind2nd_tran__bshift_int16)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *restrict *Workspaces,
-    const int64_t *restrict A_slice,
-    int nworkspaces,
-    int nthreads
-) ;
-
-
-
-// SPDX-License-Identifier: Apache-2.0
-#if 0
-void GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-#endif
-
-void GB (_Cdense_ewise3_noaccum__bshift_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumB__bshift_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *B_ek_slicing, const int B_ntasks, const int B_nthreads
-) ;
-
-GrB_Info GB (_Cdense_accumb__bshift_int32)
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-#if 0
-GrB_Info GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GrB_Matrix D,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB ((none))
-(
-    GrB_Matrix C,
-    const GrB_Matrix D,
-    const GrB_Matrix B,
-    int nthreads
-) ;
-#endif
-
-GrB_Info GB (_AaddB__bshift_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool is_eWiseUnion,
-    const GB_void *alpha_scalar_in,
-    const GB_void *beta_scalar_in,
-    const bool Ch_is_Mh,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-
-
-GrB_Info GB (_AemultB_08__bshift_int32)
-(
-    GrB_Matrix C,
-    const int C_sparsity,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *restrict C_to_M,
-    const int64_t *restrict C_to_A,
-    const int64_t *restrict C_to_B,
-    const GB_task_struct *restrict TaskList,
-    const int C_ntasks,
-    const int C_nthreads,
-    GB_Context Context
-) ;
-GrB_Info GB (_AemultB_02__bshift_int32)
+GrB_Info GB (_AkronB__bshift_int32)
 (
     GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool flipxy,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
-) ;
-GrB_Info GB (_AemultB_04__bshift_int32)
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int64_t *restrict Cp_kfirst,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
-) ;
-GrB_Info GB (_AemultB_bitmap__bshift_int32)
-(
-    GrB_Matrix C,
-    const int ewise_method,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const bool Mask_comp,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
-    const int C_nthreads,
-    GB_Context Context
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
 ) ;
 
 
@@ -63034,6 +65624,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -63204,6 +65801,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -63374,6 +65978,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -63544,6 +66155,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -63714,6 +66332,13 @@ GrB_Info GB (_AemultB_bitmap__bshift_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__bshift_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -63884,6 +66509,13 @@ GrB_Info GB (_AemultB_bitmap__pow_int8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64054,6 +66686,13 @@ GrB_Info GB (_AemultB_bitmap__pow_int16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_int16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64224,6 +66863,13 @@ GrB_Info GB (_AemultB_bitmap__pow_int32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_int32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64394,6 +67040,13 @@ GrB_Info GB (_AemultB_bitmap__pow_int64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_int64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64564,6 +67217,13 @@ GrB_Info GB (_AemultB_bitmap__pow_uint8)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_uint8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64734,6 +67394,13 @@ GrB_Info GB (_AemultB_bitmap__pow_uint16)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_uint16)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -64904,6 +67571,13 @@ GrB_Info GB (_AemultB_bitmap__pow_uint32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_uint32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -65074,6 +67748,13 @@ GrB_Info GB (_AemultB_bitmap__pow_uint64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_uint64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -65244,6 +67925,13 @@ GrB_Info GB (_AemultB_bitmap__pow_fp32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_fp32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -65414,6 +68102,13 @@ GrB_Info GB (_AemultB_bitmap__pow_fp64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_fp64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -65584,6 +68279,13 @@ GrB_Info GB (_AemultB_bitmap__pow_fc32)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_fc32)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -65754,6 +68456,13 @@ GrB_Info GB (_AemultB_bitmap__pow_fc64)
     const int C_nthreads,
     GB_Context Context
 ) ;
+GrB_Info GB (_AkronB__pow_fc64)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
 
 
 
@@ -28,6 +28,7 @@
 // A.*B function (eWiseMult):       GB (_AemultB_02__minus_int8)
 // A.*B function (eWiseMult):       GB (_AemultB_04__minus_int8)
 // A.*B function (eWiseMult):       GB (_AemultB_bitmap__minus_int8)
+// kron(A,B) function:              GB (_AkronB__minus_int8)
 // A*D function (colscale):         GB (_AxD__minus_int8)
 // D*A function (rowscale):         GB (_DxB__minus_int8)
 // C+=B function (dense accum):     GB (_Cdense_accumB__minus_int8)
@@ -444,6 +445,30 @@ GrB_Info GB (_AemultB_bitmap__minus_int8)
 
 
 
+//------------------------------------------------------------------------------
+// kron: C = kron (A,B) where C is sparse, hypersparse, or full
+//------------------------------------------------------------------------------
+
+
+
+GrB_Info GB (_AkronB__minus_int8)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_kroner_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+
+
 //------------------------------------------------------------------------------
 // Cx = op (x,Bx):  apply a binary operator to a matrix with scalar bind1st
 //------------------------------------------------------------------------------
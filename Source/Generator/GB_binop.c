@@ -27,6 +27,7 @@
 // A.*B function (eWiseMult):       GB (_AemultB_02)
 // A.*B function (eWiseMult):       GB (_AemultB_04)
 // A.*B function (eWiseMult):       GB (_AemultB_bitmap)
+// kron(A,B) function:              GB (_AkronB)
 // A*D function (colscale):         GB (_AxD)
 // D*A function (rowscale):         GB (_DxB)
 // C+=B function (dense accum):     GB (_Cdense_accumB)
@@ -443,6 +444,30 @@ GrB_Info GB (_AemultB_bitmap)
 
 endif_binop_emult_is_enabled
 
+//------------------------------------------------------------------------------
+// kron: C = kron (A,B) where C is sparse, hypersparse, or full
+//------------------------------------------------------------------------------
+
+if_binop_kron_is_enabled
+
+GrB_Info GB (_AkronB)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_kroner_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+endif_binop_kron_is_enabled
+
 //------------------------------------------------------------------------------
 // Cx = op (x,Bx):  apply a binary operator to a matrix with scalar bind1st
 //------------------------------------------------------------------------------
@@ -126,6 +126,16 @@ GrB_Info GB (_AemultB_bitmap)
 ) ;
 endif_binop_emult_is_enabled
 
+if_binop_kron_is_enabled
+GrB_Info GB (_AkronB)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing, const int C_ntasks, const int C_nthreads
+) ;
+endif_binop_kron_is_enabled
+
 if_binop_bind_is_enabled
 GrB_Info GB (_bind1st)
 (
@@ -127,8 +127,11 @@ GrB_Info GrB_Descriptor_set     // set a parameter in a descriptor
             // import/deserialization, if the GxB_IMPORT setting is made.
             // Only use the fast import/deserialize if the value is GxB_DEFAULT
             // or GxB_FAST_IMPORT; otherwise use the slower secure method.
+            // GxB_SHALLOW_IMPORT is kept as-is, for GxB_*_deserialize.
             desc->import =
-                (value == GxB_DEFAULT) ? GxB_FAST_IMPORT : GxB_SECURE_IMPORT ;
+                (value == GxB_DEFAULT) ? GxB_FAST_IMPORT :
+                (value == GxB_SHALLOW_IMPORT) ? GxB_SHALLOW_IMPORT :
+                GxB_SECURE_IMPORT ;
             break ;
 
         default : 
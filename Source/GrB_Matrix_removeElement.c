@@ -211,6 +211,10 @@ GrB_Info GB_Matrix_removeElement
         return (GrB_SUCCESS) ;
     }
 
+    // C is modified in-place, so it must own all of its content
+    GrB_Info info ;
+    GB_OK (GB_unshallow (C, Context)) ;
+
     // remove the entry
     if (GB_removeElement (C, i, j))
     { 
@@ -221,7 +225,6 @@ GrB_Info GB_Matrix_removeElement
     // assemble any pending tuples; zombies are OK
     if (C_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait (C, "C (removeElement:pending tuples)", Context)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
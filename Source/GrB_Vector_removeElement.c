@@ -160,6 +160,10 @@ GrB_Info GB_Vector_removeElement
         return (GrB_SUCCESS) ;
     }
 
+    // V is modified in-place, so it must own all of its content
+    GrB_Info info ;
+    GB_OK (GB_unshallow ((GrB_Matrix) V, Context)) ;
+
     // remove the entry
     if (GB_removeElement (V, i))
     { 
@@ -170,7 +174,6 @@ GrB_Info GB_Vector_removeElement
     // assemble any pending tuples; zombies are OK
     if (V_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait ((GrB_Matrix) V, "v (removeElement:pending tuples)",
             Context)) ;
         ASSERT (!GB_ZOMBIES (V)) ;
@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// GxB_Context_disengage: disengage the execution context of this user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the context is NULL, any context engaged by this thread is disengaged.
+// Otherwise, it must be the context engaged by this thread, if any.  The
+// thread then returns to the global settings.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_disengage  // disengage the context of this user thread
+(
+    GxB_Context context         // context to disengage (NULL: any context)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_disengage (Context)") ;
+    GB_RETURN_IF_FAULTY (context) ;
+    GxB_Context engaged = GB_Global_context_get ( ) ;
+    if (context != NULL && engaged != NULL && context != engaged)
+    { 
+        // a different context is engaged by this thread
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // disengage the context
+    //--------------------------------------------------------------------------
+
+    GB_Global_context_engage (NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// GxB_Context_engage: engage an execution context for this user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All GraphBLAS methods subsequently called by this thread use the settings
+// in the context, until it is disengaged.  Any context already engaged by
+// this thread is replaced.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_engage     // engage a context for this user thread
+(
+    GxB_Context context         // context to engage
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_engage (Context)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    //--------------------------------------------------------------------------
+    // engage the context
+    //--------------------------------------------------------------------------
+
+    if (!GB_Global_context_engage (context))
+    { 
+        // thread-local storage is not available
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GxB_Context_free: free an execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the context is engaged by the calling thread, it is disengaged first.
+// It must not be engaged by any other thread.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_free       // free a context
+(
+    GxB_Context *Context_handle // handle of context to free
+)
+{
+
+    if (Context_handle != NULL)
+    {
+        GxB_Context context = *Context_handle ;
+        if (context != NULL)
+        {
+            size_t header_size = context->header_size ;
+            if (header_size > 0)
+            { 
+                if (GB_Global_context_get ( ) == context)
+                { 
+                    GB_Global_context_engage (NULL) ;
+                }
+                GB_FREE (&(context->logger), context->logger_size) ;
+                context->logger_size = 0 ;
+                context->magic = GB_FREED ;  // to help detect dangling pointers
+                context->header_size = 0 ;
+                GB_FREE (Context_handle, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// GxB_Context_get: get a parameter from an execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Context_get        // get a parameter from a context
+(
+    GxB_Context context,        // context to query
+    GxB_Option_Field field,     // parameter to query
+    ...                         // return value of the parameter
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_get (Context, field, &value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    //--------------------------------------------------------------------------
+    // get the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_GLOBAL_NTHREADS :      // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                int *nthreads_max = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (nthreads_max) ;
+                (*nthreads_max) = context->nthreads_max ;
+            }
+            break ;
+
+        case GxB_GLOBAL_CHUNK :         // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                double *chunk = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (chunk) ;
+                (*chunk) = context->chunk ;
+            }
+            break ;
+
+        case GxB_CONTEXT_MAX_MEMORY :
+
+            {
+                va_start (ap, field) ;
+                int64_t *max_memory = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (max_memory) ;
+                (*max_memory) = context->max_memory ;
+            }
+            break ;
+
+        case GxB_CONTEXT_MEMORY_USED :
+
+            {
+                va_start (ap, field) ;
+                int64_t *memory_used = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_used) ;
+                #ifdef _OPENMP
+                #pragma omp critical(GB_context)
+                #endif
+                { 
+                    (*memory_used) = context->memory_used ;
+                }
+            }
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
+
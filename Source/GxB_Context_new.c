@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Context_new: create a new execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Default values are set to GxB_DEFAULT, so the new context uses the global
+// settings until they are changed with GxB_Context_set.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_new        // create a new context
+(
+    GxB_Context *Context_handle // handle of context to create
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_new (&Context)") ;
+    GB_RETURN_IF_NULL (Context_handle) ;
+    (*Context_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the context
+    //--------------------------------------------------------------------------
+
+    // allocate the context
+    size_t header_size ;
+    GxB_Context context = GB_MALLOC (1, struct GB_Context_opaque,
+        &header_size) ;
+    if (context == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // initialize the context
+    context->magic = GB_MAGIC ;
+    context->header_size = header_size ;
+    context->logger = NULL ;            // error string
+    context->logger_size = 0 ;
+    context->nthreads_max = GxB_DEFAULT ;   // max # of threads to use
+    context->chunk = GxB_DEFAULT ;      // chunk for auto-tuning of # threads
+    context->max_memory = 0 ;           // no memory budget
+    context->memory_used = 0 ;
+    (*Context_handle) = context ;
+    return (GrB_SUCCESS) ;
+}
+
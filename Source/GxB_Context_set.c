@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// GxB_Context_set: set a parameter in an execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The new settings take effect at the start of the next GraphBLAS method
+// called by any thread that has engaged the context.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_set        // set a parameter in a context
+(
+    GxB_Context context,        // context to modify
+    GxB_Option_Field field,     // parameter to change
+    ...                         // value to change it to
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (context, "GxB_Context_set (Context, field, value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    //--------------------------------------------------------------------------
+    // set the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_GLOBAL_NTHREADS :      // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                context->nthreads_max = va_arg (ap, int) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_GLOBAL_CHUNK :         // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                context->chunk = va_arg (ap, double) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_MAX_MEMORY :
+
+            {
+                va_start (ap, field) ;
+                int64_t max_memory = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                // if <= 0, then the context has no memory budget
+                context->max_memory = GB_IMAX (max_memory, 0) ;
+            }
+            break ;
+
+        default : 
+
+            GB_ERROR (GrB_INVALID_VALUE,
+                "invalid context field [%d], must be one of:\n"
+                "GxB_NTHREADS [%d], GxB_CHUNK [%d], or "
+                "GxB_CONTEXT_MAX_MEMORY [%d]", (int) field,
+                (int) GxB_NTHREADS, (int) GxB_CHUNK,
+                (int) GxB_CONTEXT_MAX_MEMORY) ;
+    }
+
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
+
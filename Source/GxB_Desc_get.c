@@ -142,7 +142,10 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
                 va_end (ap) ;
                 GB_RETURN_IF_NULL (method) ;
                 int s = (desc == NULL) ? GxB_DEFAULT : desc->import ;
-                if (s != GxB_DEFAULT) s = GxB_SECURE_IMPORT ;
+                if (s != GxB_DEFAULT && s != GxB_SHALLOW_IMPORT)
+                { 
+                    s = GxB_SECURE_IMPORT ;
+                }
                 (*method) = s ;
             }
             break ;
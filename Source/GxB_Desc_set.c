@@ -194,7 +194,9 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 int s = va_arg (ap, int) ;
                 va_end (ap) ;
                 desc->import =
-                    (s == GxB_DEFAULT) ? GxB_FAST_IMPORT : GxB_SECURE_IMPORT ;
+                    (s == GxB_DEFAULT) ? GxB_FAST_IMPORT :
+                    (s == GxB_SHALLOW_IMPORT) ? GxB_SHALLOW_IMPORT :
+                    GxB_SECURE_IMPORT ;
             }
             break ;
 
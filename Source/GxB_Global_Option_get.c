@@ -136,6 +136,32 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_MEMORY_POOL_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *free_pool_cache_limit = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (free_pool_cache_limit) ;
+                for (int k = 0 ; k < 64 ; k++)
+                { 
+                    free_pool_cache_limit [k] =
+                        GB_Global_free_pool_cache_limit_get (k) ;
+                }
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *free_pool_stats = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (free_pool_stats) ;
+                GB_Global_free_pool_stats_get (free_pool_stats) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, date, license, etc
         //----------------------------------------------------------------------
@@ -345,6 +371,107 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_TELEMETRY_FUNCTION : 
+
+            {
+                va_start (ap, field) ;
+                GxB_telemetry_function_t *telemetry_func =
+                    va_arg (ap, GxB_telemetry_function_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (telemetry_func) ;
+                (*telemetry_func) = GB_Global_telemetry_get ( ) ;
+            }
+            break ;
+
+        case GxB_THREAD_SHARING : 
+
+            {
+                va_start (ap, field) ;
+                bool *thread_sharing = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (thread_sharing) ;
+                (*thread_sharing) = GB_Global_thread_sharing_get ( ) ;
+            }
+            break ;
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int *numa_policy = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (numa_policy) ;
+                (*numa_policy) = GB_Global_numa_policy_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_ALIGNMENT : 
+
+            {
+                va_start (ap, field) ;
+                int *alignment = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (alignment) ;
+                (*alignment) = (int) GB_Global_memory_alignment_get ( ) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGE_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *threshold = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (threshold) ;
+                (*threshold) = (int64_t) GB_Global_huge_page_threshold_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *memory_budget = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_budget) ;
+                (*memory_budget) = GB_Global_memory_budget_get ( ) ;
+            }
+            break ;
+
+        case GxB_MEMORY_USED : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *memory_used = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_used) ;
+                (*memory_used) = GB_Global_memory_used_get ( ) ;
+            }
+            break ;
+
+        case GxB_SPILL_DIRECTORY : 
+
+            {
+                va_start (ap, field) ;
+                const char **spill_directory = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (spill_directory) ;
+                const char *dir = GB_Global_spill_directory_get ( ) ;
+                (*spill_directory) = (dir [0] == '\0') ? NULL : dir ;
+            }
+            break ;
+
+        case GxB_SPILL_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *spill_threshold = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (spill_threshold) ;
+                (*spill_threshold) = (int64_t) GB_Global_spill_threshold_get ( );
+            }
+            break ;
+
         case GxB_PRINT_1BASED : 
 
             {
@@ -132,6 +132,43 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_MEMORY_POOL_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *free_pool_cache_limit = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                if (free_pool_cache_limit == NULL)
+                { 
+                    // set all limits to their default
+                    GB_Global_free_pool_cache_init ( ) ;
+                }
+                else
+                {
+                    for (int k = 3 ; k < 64 ; k++)
+                    { 
+                        GB_Global_free_pool_cache_limit_set (k,
+                            free_pool_cache_limit [k]) ;
+                    }
+                }
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *free_pool_stats = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                if (free_pool_stats != NULL)
+                { 
+                    // the counters can only be cleared
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_free_pool_stats_clear ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // diagnostics
         //----------------------------------------------------------------------
@@ -166,6 +203,143 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_TELEMETRY_FUNCTION : 
+
+            {
+                va_start (ap, field) ;
+                GxB_telemetry_function_t telemetry_func =
+                    va_arg (ap, GxB_telemetry_function_t) ;
+                va_end (ap) ;
+                GB_Global_telemetry_set (telemetry_func) ;
+            }
+            break ;
+
+        case GxB_THREAD_SHARING : 
+
+            {
+                va_start (ap, field) ;
+                int thread_sharing = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!GB_Global_thread_sharing_set ((bool) thread_sharing))
+                { 
+                    // thread-local storage is not available
+                    return (GrB_NOT_IMPLEMENTED) ;
+                }
+            }
+            break ;
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int numa_policy = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (numa_policy == GxB_NUMA_DEFAULT ||
+                       numa_policy == GxB_NUMA_FIRST_TOUCH ||
+                       numa_policy == GxB_NUMA_INTERLEAVE))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                if (!GB_Global_numa_policy_set (numa_policy))
+                { 
+                    // mbind is not available
+                    return (GrB_NOT_IMPLEMENTED) ;
+                }
+            }
+            break ;
+
+        case GxB_MEMORY_ALIGNMENT : 
+
+            {
+                va_start (ap, field) ;
+                int alignment = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (alignment == 0 ||
+                      (alignment >= (int) sizeof (void *) &&
+                       alignment <= GB_HUGE_PAGE_SIZE &&
+                       GB_IS_POWER_OF_TWO (alignment))))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                if (!GB_Global_memory_alignment_set ((size_t) alignment))
+                { 
+                    // aligned_alloc is not available, or GraphBLAS does not
+                    // use the ANSI C malloc and free
+                    return (GrB_NOT_IMPLEMENTED) ;
+                }
+                // free the blocks in the free_pool, which may not be aligned
+                GB_free_pool_finalize ( ) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGE_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t threshold = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                if (threshold < 0)
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                if (threshold > 0 && !GB_huge_page_supported ( ))
+                { 
+                    // madvise (MADV_HUGEPAGE) is not available
+                    return (GrB_NOT_IMPLEMENTED) ;
+                }
+                if (threshold > 0)
+                { 
+                    // a smaller block cannot hold a huge page
+                    threshold = GB_IMAX (threshold, GB_HUGE_PAGE_SIZE) ;
+                }
+                GB_Global_huge_page_threshold_set ((size_t) threshold) ;
+            }
+            break ;
+
+        case GxB_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t memory_budget = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                if (memory_budget < 0)
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_memory_budget_set (memory_budget) ;
+            }
+            break ;
+
+        case GxB_SPILL_DIRECTORY : 
+
+            {
+                va_start (ap, field) ;
+                const char *spill_directory = va_arg (ap, const char *) ;
+                va_end (ap) ;
+                GrB_Info info = GB_spill_directory_set (spill_directory) ;
+                if (info != GrB_SUCCESS)
+                { 
+                    // the directory cannot be written, or mmap is not
+                    // available
+                    return (info) ;
+                }
+            }
+            break ;
+
+        case GxB_SPILL_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t spill_threshold = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                if (spill_threshold < 0)
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_spill_threshold_set ((size_t) spill_threshold) ;
+            }
+            break ;
+
         case GxB_PRINT_1BASED : 
 
             {
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a stream of bytes
+
+// Identical to GxB_Matrix_deserialize, except that the blob is not held in
+// memory.  Instead, it is read in order, one piece at a time, by the reader
+// function provided by the user application.  The blob may have been
+// constructed by GxB_Matrix_serialize_stream, or by any of the
+// GrB_*_serialize or GxB_*_serialize methods.  The descriptor controls the #
+// of threads used.  See GxB_Matrix_serialize_stream for an example.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_serialize_read_function reader,     // function to read the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_stream (&C, type, reader, stream, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+    GB_RETURN_IF_NULL (reader) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, NULL, 0, false, reader, stream, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
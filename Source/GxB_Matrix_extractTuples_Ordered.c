@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractTuples_Ordered: extract all tuples in row or column order
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extracts all tuples from a matrix, like [I,J,X] = find (A), in row-major
+// order (order is GxB_BY_ROW), column-major order (GxB_BY_COL), or in the
+// order they are held in A (GxB_NO_FORMAT).  The values are typecasted to
+// xtype (or left as A->type if xtype is NULL) as they are written into X.
+
+// If A is iso and X is not NULL, the iso scalar Ax [0] is expanded into X.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_extractTuples_Ordered   // [I,J,X] = find (A), in order
+(
+    GrB_Index *I,               // array for returning row indices of tuples
+    GrB_Index *J,               // array for returning col indices of tuples
+    void *X,                    // array for returning values of tuples
+    GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
+    GrB_Type xtype,             // type of X (NULL: the type of A)
+    int order,                  // GxB_BY_ROW, GxB_BY_COL, or GxB_NO_FORMAT
+    const GrB_Matrix A,         // matrix to extract tuples from
+    const GrB_Descriptor desc   // currently unused
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_extractTuples_Ordered (I, J, X, nvals, xtype, "
+        "order, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_extractTuples_Ordered") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (p_nvals) ;
+    GB_RETURN_IF_FAULTY (xtype) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (order != GxB_BY_ROW && order != GxB_BY_COL && order != GxB_NO_FORMAT)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid order: %d", order) ;
+    }
+
+    if (xtype == NULL)
+    {
+        xtype = A->type ;
+    }
+    if (xtype->code == GB_UDT_code && xtype != A->type)
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type of X [%s] must match the type "
+            "of A [%s]", xtype->name, A->type->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the tuples
+    //--------------------------------------------------------------------------
+
+    info = GB_extractTuples_ordered (I, J, X, p_nvals, xtype->code, order, A,
+        Context) ;
+    GB_BURBLE_END ;
+    GB_PRAGMA (omp flush)
+    return (info) ;
+}
+
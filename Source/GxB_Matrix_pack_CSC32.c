@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_CSC32: pack a matrix in CSC format, with 32-bit indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_export.h"
+
+GrB_Info GxB_Matrix_pack_CSC32    // pack a CSC matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // col "pointers", Ap_size >= (ncols+1)*sizeof(uint32_t)
+    uint32_t **Ai,      // row indices, Ai_size >= nvals(A)*sizeof(uint32_t)
+    void **Ax,          // values, Ax_size >= nvals(A) * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ap_size,  // size of Ap in bytes
+    GrB_Index Ai_size,  // size of Ai in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    bool jumbled,       // if true, indices in each column may be unsorted
+    const GrB_Descriptor desc
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_pack_CSC32 (A, "
+        "&Ap, &Ai, &Ax, Ap_size, Ai_size, Ax_size, iso, "
+        "jumbled, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_pack_CSC32") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_IMPORT (desc, fast_import) ;
+
+    //--------------------------------------------------------------------------
+    // pack the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_import32 (A, Ap, Ap_size, Ai, Ai_size, Ax, Ax_size, iso,
+        jumbled, true, fast_import, Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_read_MatrixMarket: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is read in large chunks, and each chunk is parsed in parallel.
+// See GB_read_MatrixMarket for details.
+
+#include "GB.h"
+#include "GB_read.h"
+
+GrB_Info GxB_Matrix_read_MatrixMarket   // read a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,          // matrix read from the file
+    // input:
+    GrB_Type type,          // type of C, or NULL to use the file
+    FILE *f,                // file to read, open for reading
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_read_MatrixMarket (&C, type, f, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_read_MatrixMarket") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (f) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // read the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_read_MatrixMarket (C, type, f, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
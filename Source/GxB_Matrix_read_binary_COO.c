@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_read_binary_COO: read a matrix from a binary list of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file is read in large chunks, and each chunk is decoded in parallel.
+// See GB_read_binary_COO for details.
+
+#include "GB.h"
+#include "GB_read.h"
+
+GrB_Info GxB_Matrix_read_binary_COO     // read a binary list of tuples
+(
+    // output:
+    GrB_Matrix *C,          // matrix read from the file
+    // input:
+    GrB_Type type,          // type of C and of the values in the file, or
+                            // NULL if the file holds no values
+    GrB_Index nrows,        // # of rows of C
+    GrB_Index ncols,        // # of columns of C
+    int index_size,         // size of each index in the file (4 or 8 bytes)
+    FILE *f,                // file to read, open for reading
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_read_binary_COO (&C, type, nrows, ncols, "
+        "index_size, f, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_read_binary_COO") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (f) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (nrows > GB_NMAX || ncols > GB_NMAX)
+    { 
+        // problem too large
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    if (index_size != 4 && index_size != 8)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "index_size must be 4 or 8, not %d",
+            index_size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_read_binary_COO (C, type, nrows, ncols, index_size, f, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
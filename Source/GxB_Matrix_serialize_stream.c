@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix to a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Matrix to a stream of bytes
+
+// This method is similar to GxB_Matrix_serialize, except that the blob is not
+// constructed in memory.  Instead, it is passed in order, one piece at a time,
+// to the writer function provided by the user application.  The blob has the
+// same format as the one constructed by GxB_Matrix_serialize (with smaller
+// compressed blocks for large arrays), so it can be read back by
+// GxB_Matrix_deserialize_stream, or loaded into memory and read by
+// GxB_Matrix_deserialize.  Example usage:
+
+/*
+    bool my_write (void *stream, const void *data, size_t size)
+    {
+        return (fwrite (data, 1, size, (FILE *) stream) == size) ;
+    }
+    bool my_read (void *stream, void *data, size_t size)
+    {
+        return (fread (data, 1, size, (FILE *) stream) == size) ;
+    }
+    GrB_Matrix A, B = NULL ;
+    // construct a matrix A, then write it to a file:
+    FILE *f = fopen ("A.blob", "wb") ;
+    GxB_Matrix_serialize_stream (my_write, f, A, NULL) ;
+    fclose (f) ;
+    // read it back into B:
+    f = fopen ("A.blob", "rb") ;
+    GxB_Matrix_deserialize_stream (&B, atype, my_read, f, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_serialize_write_function writer,    // function to write the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (writer, stream, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (writer) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (writer, stream, A, method, Context) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
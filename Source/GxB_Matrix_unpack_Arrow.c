@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_unpack_Arrow: unpack a matrix into Arrow-compatible buffers
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The matrix is unpacked in its current by-row/by-col orientation, with no
+// transpose, in one of two layouts that can be wrapped directly as Apache
+// Arrow buffers:
+
+// GxB_SPARSE: if A is sparse or hypersparse, it is unpacked as CSR or CSC.
+//      Ap (int64 offsets), Ai (int64 indices), and Ax are the buffers of an
+//      Arrow SparseCSRMatrix or SparseCSCMatrix.  No data is copied, unless A
+//      is hypersparse (Ap is then expanded to length nvec+1).
+
+// GxB_FULL: if A is bitmap or full, it is unpacked as a dense array of
+//      nrows*ncols values, held by row or by column, with Ap and Ai returned
+//      as NULL.  If A is bitmap, Av is returned as an Arrow validity bitmap,
+//      with one bit per value (least significant bit first), padded with
+//      zeros to a multiple of 64 bytes.  A->b holds one byte per value, so it
+//      is packed into Av in parallel and then freed.  Av is NULL if A is full
+//      (all values are valid).  Ax is not copied.
+
+// If iso is true, Ax holds a single value; this can be wrapped as an Arrow
+// run-end encoded array with one run.  The buffers are allocated by the malloc
+// function passed to GxB_init (or malloc, for GrB_init); if that function
+// returns 64-byte aligned memory, all buffers satisfy the Arrow alignment
+// recommendation.
+
+#include "GB_export.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Av_new, Av_new_size) ;    \
+}
+
+GrB_Info GxB_Matrix_unpack_Arrow    // unpack a matrix into Arrow buffers
+(
+    GrB_Matrix A,       // matrix to unpack (type, nrows, ncols unchanged)
+    int *layout,        // GxB_SPARSE (CSR or CSC) or GxB_FULL (dense)
+    bool *by_col,       // true if CSC or column-major, false if by row
+    GrB_Index **Ap,     // offsets, size nvec+1 (NULL if dense)
+    GrB_Index **Ai,     // indices (NULL if dense)
+    uint8_t **Av,       // validity bitmap (NULL if sparse, or no nulls)
+    void **Ax,          // values
+    GrB_Index *Ap_size, // size of Ap in bytes
+    GrB_Index *Ai_size, // size of Ai in bytes
+    GrB_Index *Av_size, // size of Av in bytes
+    GrB_Index *Ax_size, // size of Ax in bytes
+    bool *iso,          // if true, A is iso
+    const GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_unpack_Arrow (A, &layout, &by_col, "
+        "&Ap, &Ai, &Av, &Ax, &Ap_size, &Ai_size, &Av_size, &Ax_size, &iso, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_unpack_Arrow") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (layout) ;
+    GB_RETURN_IF_NULL (by_col) ;
+    GB_RETURN_IF_NULL (Ap) ;
+    GB_RETURN_IF_NULL (Ai) ;
+    GB_RETURN_IF_NULL (Av) ;
+    GB_RETURN_IF_NULL (Ap_size) ;
+    GB_RETURN_IF_NULL (Ai_size) ;
+    GB_RETURN_IF_NULL (Av_size) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    uint8_t *Av_new = NULL ; size_t Av_new_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work, and convert hypersparse to sparse
+    //--------------------------------------------------------------------------
+
+    // the unpacked matrix cannot be jumbled
+    GB_MATRIX_WAIT (A) ;
+    if (GB_IS_HYPERSPARSE (A))
+    {
+        GB_OK (GB_convert_hyper_to_sparse (A, Context)) ;
+    }
+
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_IS_HYPERSPARSE (A)) ;
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap A->b into the Arrow validity bitmap
+    //--------------------------------------------------------------------------
+
+    // This is done before A is unpacked, so that A is not modified if the
+    // method runs out of memory.
+
+    if (GB_IS_BITMAP (A))
+    {
+        int64_t anz_held = GB_nnz_held (A) ;
+        int64_t nbytes = (anz_held + 7) / 8 ;
+        int64_t nbytes_padded = GB_IMAX (64 * ((nbytes + 63) / 64), 64) ;
+        Av_new = GB_MALLOC (nbytes_padded, uint8_t, &Av_new_size) ;
+        // Av_new is given to the user application, so it cannot be left in
+        // a memory-mapped file
+        if (Av_new == NULL ||
+            !GB_spill_unspill ((void **) &Av_new, Av_new_size))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        const int8_t *restrict Ab = A->b ;
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (anz_held, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nbytes_padded ; k++)
+        {
+            // pack Ab [8*k ... 8*k+7] into Av_new [k]
+            uint8_t byte = 0 ;
+            int64_t pstart = 8 * k ;
+            int64_t pend = GB_IMIN (pstart + 8, anz_held) ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                byte |= ((Ab [p] != 0) << (p - pstart)) ;
+            }
+            Av_new [k] = byte ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the matrix
+    //--------------------------------------------------------------------------
+
+    int sparsity ;
+    bool is_csc ;
+    GrB_Type type ;
+    GrB_Index vlen, vdim, nvals ;
+    int8_t *Ab = NULL ;
+    GrB_Index Ab_size = 0 ;
+
+    GB_OK (GB_export (true, &A, &type, &vlen, &vdim, false,
+        Ap,   Ap_size,  // Ap
+        NULL, NULL,     // Ah
+        &Ab,  &Ab_size, // Ab
+        Ai,   Ai_size,  // Ai
+        Ax,   Ax_size,  // Ax
+        &nvals, NULL, NULL,                 // not jumbled
+        &sparsity, &is_csc,                 // sparse, bitmap, or full
+        iso, Context)) ;
+
+    if (Ab != NULL)
+    {
+        // A->b has been replaced by the Arrow validity bitmap; GB_export has
+        // removed it from the debug memtable
+        GB_Global_memtable_add (Ab, Ab_size) ;
+        GB_FREE (&Ab, Ab_size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the layout of the buffers
+    //--------------------------------------------------------------------------
+
+    if (sparsity == GxB_SPARSE)
+    {
+        (*layout) = GxB_SPARSE ;
+    }
+    else
+    {
+        (*layout) = GxB_FULL ;
+        (*Ap) = NULL ; (*Ap_size) = 0 ;
+        (*Ai) = NULL ; (*Ai_size) = 0 ;
+    }
+    (*by_col) = is_csc ;
+    if (Av_new != NULL)
+    {
+        GB_Global_memtable_remove (Av_new) ;
+    }
+    (*Av) = Av_new ;
+    (*Av_size) = Av_new_size ;
+
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
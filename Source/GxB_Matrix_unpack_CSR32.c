@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_unpack_CSR32: unpack a matrix in CSR format, with 32-bit indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_export.h"
+
+GrB_Info GxB_Matrix_unpack_CSR32  // unpack a CSR matrix with 32-bit indices
+(
+    GrB_Matrix A,       // matrix to unpack (type, nrows, ncols unchanged)
+    uint32_t **Ap,      // row "pointers"
+    uint32_t **Aj,      // column indices
+    void **Ax,          // values
+    GrB_Index *Ap_size, // size of Ap in bytes
+    GrB_Index *Aj_size, // size of Aj in bytes
+    GrB_Index *Ax_size, // size of Ax in bytes
+    bool *iso,          // if true, A is iso
+    bool *jumbled,      // if true, indices in each row may be unsorted
+    const GrB_Descriptor desc
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_unpack_CSR32 (A, "
+        "&Ap, &Aj, &Ax, &Ap_size, &Aj_size, &Ax_size, &iso, "
+        "&jumbled, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_unpack_CSR32") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // unpack the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_export32 (A, Ap, Ap_size, Aj, Aj_size, Ax, Ax_size, iso,
+        jumbled, false, Context) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -39,13 +39,15 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     GB_RETURN_IF_NULL (blob) ;
     GB_RETURN_IF_NULL (w) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    // GxB_SHALLOW_IMPORT: the result may contain shallow pointers into blob
+    bool shallow = (desc != NULL && desc->import == GxB_SHALLOW_IMPORT) ;
 
     //--------------------------------------------------------------------------
     // deserialize the blob into a vector
     //--------------------------------------------------------------------------
 
     info = GB_deserialize ((GrB_Matrix *) w, type, (const GB_void *) blob,
-        (size_t) blob_size, Context) ;
+        (size_t) blob_size, shallow, NULL, NULL, Context) ;
     GB_BURBLE_END ;
     return (info) ;
 }
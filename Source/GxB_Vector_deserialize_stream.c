@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_deserialize_stream: create a vector from a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Vector from a stream of bytes
+
+// Identical to GxB_Matrix_deserialize_stream, except for a GrB_Vector.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Vector_deserialize_stream  // deserialize a stream into a vector
+(
+    // output:
+    GrB_Vector *w,      // output vector created from the stream
+    // input:
+    GrB_Type type,      // type of the vector w.  Required if the stream holds
+                        // a vector of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of w.
+    GxB_serialize_read_function reader,     // function to read the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_deserialize_stream (&w, type, reader, stream, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Vector_deserialize_stream") ;
+    GB_RETURN_IF_NULL (reader) ;
+    GB_RETURN_IF_NULL (w) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a vector
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize ((GrB_Matrix *) w, type, NULL, 0, false, reader,
+        stream, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_serialize_stream: serialize a vector to a user-defined stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Vector to a stream of bytes
+
+// Identical to GxB_Matrix_serialize_stream, except for a GrB_Vector.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Vector_serialize_stream    // serialize a GrB_Vector to a stream
+(
+    GxB_serialize_write_function writer,    // function to write the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Vector u,                   // vector to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_serialize_stream (writer, stream, u, desc)") ;
+    GB_BURBLE_START ("GxB_Vector_serialize_stream") ;
+    GB_RETURN_IF_NULL (writer) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the vector to the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (writer, stream, (GrB_Matrix) u, method,
+        Context) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
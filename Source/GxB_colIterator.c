@@ -13,10 +13,12 @@
 #undef GxB_colIterator_kount
 #undef GxB_colIterator_seekCol
 #undef GxB_colIterator_kseek
+#undef GxB_colIterator_seekPartition
 #undef GxB_colIterator_nextCol
 #undef GxB_colIterator_nextRow
 #undef GxB_colIterator_getColIndex
 #undef GxB_colIterator_getRowIndex
+#undef GxB_colIterator_getSpan
 
 //------------------------------------------------------------------------------
 
@@ -53,6 +55,18 @@ GrB_Info GxB_colIterator_kseek (GxB_Iterator iterator, GrB_Index k)
     return (GB_Iterator_rc_seek (iterator, k, true)) ;
 }
 
+GrB_Info GxB_colIterator_seekPartition
+(
+    GxB_Iterator iterator,
+    int tid,
+    int ntasks
+)
+{ 
+    // move a column iterator that is already attached to A, to the first
+    // entry of the tid-th of ntasks partitions of A
+    return (GB_Iterator_rc_partition (iterator, tid, ntasks)) ;
+}
+
 GrB_Info GxB_colIterator_nextCol (GxB_Iterator iterator)
 { 
     // move a column iterator to the first entry of the next column
@@ -77,3 +91,19 @@ GrB_Index GxB_colIterator_getRowIndex (GxB_Iterator iterator)
     return (GB_Iterator_rc_geti (iterator)) ;
 }
 
+GrB_Info GxB_colIterator_getSpan
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,
+    const GrB_Index **Indices,
+    GrB_Index *first,
+    const int8_t **Bitmap,
+    const void **Values,
+    bool *iso
+)
+{ 
+    // get the rest of the current column of a column iterator, as arrays
+    return (GB_Iterator_rc_span (iterator, count, Indices, first, Bitmap,
+        Values, iso)) ;
+}
+
@@ -13,10 +13,12 @@
 #undef GxB_rowIterator_kount
 #undef GxB_rowIterator_seekRow
 #undef GxB_rowIterator_kseek
+#undef GxB_rowIterator_seekPartition
 #undef GxB_rowIterator_nextRow
 #undef GxB_rowIterator_nextCol
 #undef GxB_rowIterator_getRowIndex
 #undef GxB_rowIterator_getColIndex
+#undef GxB_rowIterator_getSpan
 
 //------------------------------------------------------------------------------
 // GxB_rowIterator_attach: attach a row iterator to a matrix
@@ -119,6 +121,30 @@ GrB_Info GxB_rowIterator_kseek (GxB_Iterator iterator, GrB_Index k)
     return (GB_Iterator_rc_seek (iterator, k, true)) ;
 }
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_seekPartition:  move a row iterator to a partition of a matrix
+//------------------------------------------------------------------------------
+
+// On input, the row iterator must be attached to a matrix, but need not be at
+// any specific row; results are undefined if this condition is not met.
+
+// GxB_rowIterator_seekPartition restricts the row iterator to the tid-th of
+// ntasks partitions of the matrix, each with about the same number of
+// entries, and moves it to the first row of that partition.  A row may be
+// split across two or more partitions.  GxB_rowIterator_nextRow returns
+// GxB_EXHAUSTED at the end of the partition.  The return conditions are
+// otherwise the same as GxB_rowIterator_seekRow.
+
+GrB_Info GxB_rowIterator_seekPartition
+(
+    GxB_Iterator iterator,
+    int tid,
+    int ntasks
+)
+{ 
+    return (GB_Iterator_rc_partition (iterator, tid, ntasks)) ;
+}
+
 //------------------------------------------------------------------------------
 // GxB_rowIterator_nextRow: move a row iterator to the next row of a matrix
 //------------------------------------------------------------------------------
@@ -193,3 +219,28 @@ GrB_Index GxB_rowIterator_getColIndex (GxB_Iterator iterator)
     return (GB_Iterator_rc_geti (iterator)) ;
 }
 
+//------------------------------------------------------------------------------
+// GxB_rowIterator_getSpan: get the rest of the current row, as arrays
+//------------------------------------------------------------------------------
+
+// On input, the iterator must be already successfully attached to matrix as a
+// row iterator, and positioned at a row.  Results are undefined if this
+// condition is not met.  Pointers to the indices, bitmap, and values of the
+// entries from the current entry to the end of the row are returned; see
+// GraphBLAS.h for details.
+
+GrB_Info GxB_rowIterator_getSpan
+(
+    GxB_Iterator iterator,
+    GrB_Index *count,
+    const GrB_Index **Indices,
+    GrB_Index *first,
+    const int8_t **Bitmap,
+    const void **Values,
+    bool *iso
+)
+{ 
+    return (GB_Iterator_rc_span (iterator, count, Indices, first, Bitmap,
+        Values, iso)) ;
+}
+
@@ -275,7 +275,36 @@
                 ASSERT (A_is_sparse || A_is_hyper) ;
                 ASSERT (B_is_sparse || B_is_hyper) ;
 
-                if (ajnz > 32 * bjnz)
+                if (ajnz == bjnz && Ai + pA == Bi + pB)
+                {
+
+                    //----------------------------------------------------------
+                    // Method8(e): A(:,j) and B(:,j) have the same pattern
+                    //----------------------------------------------------------
+
+                    // A and B are aliased, as in C=A.*A, so no merge is
+                    // needed and the pattern of C(:,j) is that of A(:,j).
+
+                    #if defined ( GB_PHASE_1_OF_2 )
+                    cjnz = ajnz ;
+                    #else
+                    ASSERT (cjnz == ajnz) ;
+                    for ( ; pA < pA_end ; pA++, pB++, pC++)
+                    {
+                        // C (i,j) = A (i,j) .* B (i,j)
+                        int64_t i = Ai [pA] ;
+                        Ci [pC] = i ;
+                        #ifndef GB_ISO_EMULT
+                        GB_GETA (aij, Ax, pA, A_iso) ;
+                        GB_GETB (bij, Bx, pB, B_iso) ;
+                        GB_BINOP (GB_CX (pC), aij, bij, i, j) ;
+                        #endif
+                    }
+                    ASSERT (pC == pC_end) ;
+                    #endif
+
+                }
+                else if (ajnz > 32 * bjnz)
                 {
 
                     //----------------------------------------------------------
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// GB_kroner_template: C = kron (A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is sparse, hypersparse, or full, and its pattern (Cp and Ch) has already
+// been computed.  A and B are sparse, hypersparse, or full (not bitmap).  The
+// (kC)th vector of C is the Kronecker product of the (kA)th vector of A and
+// the (kB)th vector of B, where kC = kA * bnvec + kB.  Within C(:,kC), the
+// entry C(iA*bvlen+iB,jC) at position
+// pC = Cp [kC] + (pA - Ap [kA]) * bknz + (pB - Bp [kB]) is the product of
+// A(iA,jA) and B(iB,jB), where bknz = nnz (B(:,jB)).
+
+// The entries of C have been sliced by GB_ek_slice, so the work is balanced
+// by nnz(C), and any single vector of C can be split across many tasks.  Each
+// task finds the entries A(iA,jA) and B(iB,jB) that define its first entry
+// C(iC,jC) by a single division, and then iterates through the rest of its
+// slice.
+
+// The positional indices iA and jA are in scope when GB_GETA is used, and iB
+// and jB are in scope when GB_GETB is used, so that the generic method can
+// compute positional operators in GB_GETA and GB_GETB.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A, B, and C
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t avlen = A->vlen ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t bnvec = B->nvec ;
+
+    const int64_t *restrict Cp = C->p ;
+          int64_t *restrict Ci = C->i ;
+    const int64_t cvlen = C->vlen ;
+    const bool C_is_full = (Cp == NULL) ;
+
+    #ifdef GB_ISO_KRON
+    ASSERT (C->iso) ;
+    #else
+    ASSERT (!C->iso) ;
+    const bool A_iso = A->iso ;
+    const bool B_iso = B->iso ;
+    const GB_ATYPE *restrict Ax = (GB_ATYPE *) A->x ;
+    const GB_BTYPE *restrict Bx = (GB_BTYPE *) B->x ;
+          GB_CTYPE *restrict Cx = (GB_CTYPE *) C->x ;
+    #endif
+
+    const int64_t *restrict kfirst_Cslice = C_ek_slicing ;
+    const int64_t *restrict klast_Cslice  = C_ek_slicing + C_ntasks ;
+    const int64_t *restrict pstart_Cslice = C_ek_slicing + C_ntasks * 2 ;
+
+    //--------------------------------------------------------------------------
+    // C = kron (A,B)
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(C_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < C_ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_Cslice [tid] ;
+        int64_t klast  = klast_Cslice  [tid] ;
+        for (int64_t kC = kfirst ; kC <= klast ; kC++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of C(:,kC) to be computed by this task
+            //------------------------------------------------------------------
+
+            int64_t pC_start, pC_end ;
+            GB_get_pA (&pC_start, &pC_end, tid, kC, kfirst, klast,
+                pstart_Cslice, Cp, cvlen) ;
+            if (pC_start >= pC_end) continue ;
+
+            //------------------------------------------------------------------
+            // get A(:,jA) and B(:,jB)
+            //------------------------------------------------------------------
+
+            const int64_t kA = kC / bnvec ;
+            const int64_t kB = kC % bnvec ;
+            const int64_t jA = GBH (Ah, kA) ;
+            const int64_t jB = GBH (Bh, kB) ;
+            const int64_t pB_start = GBP (Bp, kB, bvlen) ;
+            const int64_t pB_end   = GBP (Bp, kB+1, bvlen) ;
+            const int64_t bknz = pB_end - pB_start ;
+            ASSERT (bknz > 0) ;
+
+            //------------------------------------------------------------------
+            // find A(iA,jA) and B(iB,jB) for the first entry C(iC,jC)
+            //------------------------------------------------------------------
+
+            const int64_t pC_offset = pC_start - GBP (Cp, kC, cvlen) ;
+            int64_t pA = GBP (Ap, kA, avlen) + pC_offset / bknz ;
+            int64_t pB = pB_start + pC_offset % bknz ;
+
+            //------------------------------------------------------------------
+            // C(iA*bvlen+iB,jC) = A(iA,jA) * B(iB,jB)
+            //------------------------------------------------------------------
+
+            int64_t pC = pC_start ;
+            for ( ; pC < pC_end ; pA++)
+            {
+                // get A(iA,jA)
+                const int64_t iA = GBI (Ai, pA, avlen) ;
+                const int64_t iAblock = iA * bvlen ;
+                GB_GETA (aij, Ax, pA, A_iso) ;
+                // C(iAblock:iAblock+bvlen-1,jC) = A(iA,jA) * B(:,jB)
+                for ( ; pB < pB_end && pC < pC_end ; pB++, pC++)
+                {
+                    // get B(iB,jB)
+                    const int64_t iB = GBI (Bi, pB, bvlen) ;
+                    if (!C_is_full)
+                    {
+                        Ci [pC] = iAblock + iB ;
+                    }
+                    GB_GETB (bij, Bx, pB, B_iso) ;
+                    // C(iC,jC) = A(iA,jA) * B(iB,jB)
+                    GB_BINOP (GB_CX (pC), aij, bij, 0, 0) ;
+                }
+                pB = pB_start ;
+            }
+        }
+    }
+}
+
+#undef GB_ISO_KRON
+
@@ -102,6 +102,19 @@ switch (binop)
         fprintf (f, 'define(`endif_binop_emult_is_enabled'', `'')\n') ;
 end
 
+% subset of operators for GB_kroner
+switch (binop)
+    case { 'pair' }
+        % no kron for these operators (C=kron(A,B) is always iso)
+        fprintf (f, 'define(`_AkronB'', `(none)'')\n') ;
+        fprintf (f, 'define(`if_binop_kron_is_enabled'', `#if 0'')\n') ;
+        fprintf (f, 'define(`endif_binop_kron_is_enabled'', `#endif'')\n') ;
+    otherwise
+        fprintf (f, 'define(`_AkronB'', `_AkronB__%s'')\n', name) ;
+        fprintf (f, 'define(`if_binop_kron_is_enabled'', `'')\n') ;
+        fprintf (f, 'define(`endif_binop_kron_is_enabled'', `'')\n') ;
+end
+
 if (isequal (binop, 'second'))
     fprintf (f, 'define(`GB_op_is_second'', `1'')\n') ;
 else
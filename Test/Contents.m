@@ -208,7 +208,7 @@
 %   test145  - test dot4
 %   test146  - test C<M,struct> = scalar
 %   test147  - test C<M>A*B with very sparse M
-%   test148  - eWiseAdd with aliases
+%   test148  - eWiseAdd and eWiseMult with aliases
 %   test149  - test fine hash method for C<!M>=A*B
 %   test150  - test GrB_mxm with typecasting and zombies (dot3 and saxpy)
 %   test151  - test bitwise operators
@@ -37,6 +37,17 @@ int myflush (void)
     return (0) ;
 }
 
+int ntelemetry [5] ;
+
+void mytelemetry (const GxB_Telemetry_Event *event) ;
+
+void mytelemetry (const GxB_Telemetry_Event *event)
+{
+    printf ("telemetry: %d %s %s\n", event->kind, event->operation,
+        (event->method == NULL) ? "" : event->method) ;
+    ntelemetry [event->kind]++ ;
+}
+
 typedef int (* printf_func_t) (const char *restrict format, ...) ;
 typedef int (* flush_func_t)  (void) ;
 typedef struct { int64_t blob [4] ; } myblob_struct ;
@@ -99,6 +110,211 @@ void mexFunction
     OK (GxB_Global_Option_set (GxB_PRINTF, printf)) ;
     OK (GxB_Global_Option_set (GxB_FLUSH, NULL)) ;
 
+    //--------------------------------------------------------------------------
+    // GxB_set/get for the telemetry function
+    //--------------------------------------------------------------------------
+
+    GxB_telemetry_function_t mytel = NULL ;
+    OK (GxB_Global_Option_set (GxB_TELEMETRY_FUNCTION, mytelemetry)) ;
+    OK (GxB_Global_Option_get (GxB_TELEMETRY_FUNCTION, &mytel)) ;
+    CHECK (mytel == mytelemetry) ;
+    for (int k = 0 ; k < 5 ; k++) ntelemetry [k] = 0 ;
+    OK (GrB_Matrix_setElement_FP32 (C, 2, 0, 0)) ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, C, C, NULL)) ;
+    CHECK (ntelemetry [GxB_TELEMETRY_CALL] > 0) ;
+    CHECK (ntelemetry [GxB_TELEMETRY_METHOD] > 0) ;
+    OK (GxB_Global_Option_set (GxB_TELEMETRY_FUNCTION, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_TELEMETRY_FUNCTION, &mytel)) ;
+    CHECK (mytel == NULL) ;
+    int ncalls = ntelemetry [GxB_TELEMETRY_CALL] ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, C, C, NULL)) ;
+    CHECK (ntelemetry [GxB_TELEMETRY_CALL] == ncalls) ;
+    OK (GrB_Matrix_clear (C)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_Context
+    //--------------------------------------------------------------------------
+
+    GxB_Context context = NULL ;
+    GrB_Matrix E = NULL ;
+    int context_nthreads ;
+    double context_chunk ;
+    int64_t context_memory ;
+    OK (GxB_Context_new (&context)) ;
+    OK (GxB_Context_get (context, GxB_NTHREADS, &context_nthreads)) ;
+    CHECK (context_nthreads == GxB_DEFAULT) ;
+    OK (GxB_Context_set (context, GxB_NTHREADS, 1)) ;
+    OK (GxB_Context_set (context, GxB_CHUNK, (double) 4096)) ;
+    OK (GxB_Context_get (context, GxB_NTHREADS, &context_nthreads)) ;
+    CHECK (context_nthreads == 1) ;
+    OK (GxB_Context_get (context, GxB_CHUNK, &context_chunk)) ;
+    CHECK (context_chunk == 4096) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set (context, GxB_FORMAT, GxB_BY_ROW)) ;
+    OK (GxB_Context_engage (context)) ;
+    CHECK (GB_Global_context_nthreads_max_get ( ) == 1) ;
+    CHECK (GB_Global_context_chunk_get ( ) == 4096) ;
+    OK (GrB_Matrix_setElement_FP32 (C, 2, 0, 0)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_MEMORY_USED, &context_memory)) ;
+    CHECK (context_memory > 0) ;
+    // the context is already over a budget of 1 byte, so all allocations fail
+    OK (GxB_Context_set (context, GxB_CONTEXT_MAX_MEMORY, (int64_t) 1)) ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_MAX_MEMORY, &context_memory)) ;
+    CHECK (context_memory == 1) ;
+    expected = GrB_OUT_OF_MEMORY ;
+    info = GrB_Matrix_new (&E, GrB_FP32, 4, 4) ;
+    CHECK (info == expected) ;
+    CHECK (E == NULL) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_MAX_MEMORY, (int64_t) 0)) ;
+    OK (GrB_Matrix_clear (C)) ;
+    OK (GxB_Context_disengage (context)) ;
+    CHECK (GB_Global_context_get ( ) == NULL) ;
+    CHECK (GB_Global_context_nthreads_max_get ( ) ==
+        GB_Global_nthreads_max_get ( )) ;
+    OK (GxB_Context_free (&context)) ;
+    CHECK (context == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for thread sharing
+    //--------------------------------------------------------------------------
+
+    bool thread_sharing = true ;
+    OK (GxB_Global_Option_get (GxB_THREAD_SHARING, &thread_sharing)) ;
+    CHECK (!thread_sharing) ;
+    OK (GxB_Global_Option_set (GxB_THREAD_SHARING, true)) ;
+    OK (GxB_Global_Option_get (GxB_THREAD_SHARING, &thread_sharing)) ;
+    CHECK (thread_sharing) ;
+    OK (GrB_Matrix_setElement_FP32 (C, 2, 0, 0)) ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, C, C, NULL)) ;
+    // the call has finished, so it no longer holds a share of the threads
+    CHECK (GB_Global_thread_share_get (64) == 64) ;
+    OK (GxB_Global_Option_set (GxB_THREAD_SHARING, false)) ;
+    OK (GrB_Matrix_clear (C)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for the NUMA policy
+    //--------------------------------------------------------------------------
+
+    int numa_policy = -1 ;
+    OK (GxB_Global_Option_get (GxB_NUMA_POLICY, &numa_policy)) ;
+    CHECK (numa_policy == GxB_NUMA_DEFAULT) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_NUMA_POLICY, 99)) ;
+    info = GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_INTERLEAVE) ;
+    CHECK (info == GrB_SUCCESS || info == GrB_NOT_IMPLEMENTED) ;
+    OK (GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_FIRST_TOUCH)) ;
+    OK (GxB_Global_Option_get (GxB_NUMA_POLICY, &numa_policy)) ;
+    CHECK (numa_policy == GxB_NUMA_FIRST_TOUCH) ;
+    // a large block is placed and cleared by GB_numa_place
+    size_t numa_size = 0 ;
+    int64_t numa_n = 3 * GB_NUMA_MIN_SIZE / sizeof (int64_t) ;
+    int64_t *numa_block = GB_calloc_memory (numa_n, sizeof (int64_t),
+        &numa_size, NULL) ;
+    CHECK (numa_block != NULL) ;
+    for (int64_t k = 0 ; k < numa_n ; k++)
+    {
+        CHECK (numa_block [k] == 0) ;
+    }
+    GB_dealloc_memory ((void **) &numa_block, numa_size) ;
+    OK (GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for aligned allocation and huge pages
+    //--------------------------------------------------------------------------
+
+    int alignment = -1 ;
+    int64_t huge_page_threshold = -1 ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_ALIGNMENT, &alignment)) ;
+    CHECK (alignment == 0) ;
+    OK (GxB_Global_Option_get (GxB_HUGE_PAGE_THRESHOLD, &huge_page_threshold));
+    CHECK (huge_page_threshold == 0) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_MEMORY_ALIGNMENT, 48)) ;
+    ERR (GxB_Global_Option_set (GxB_HUGE_PAGE_THRESHOLD, (int64_t) -1)) ;
+    info = GxB_Global_Option_set (GxB_MEMORY_ALIGNMENT, 64) ;
+    CHECK (info == GrB_SUCCESS || info == GrB_NOT_IMPLEMENTED) ;
+    if (info == GrB_SUCCESS)
+    {
+        // all new blocks are aligned, with malloc, calloc, and realloc
+        size_t asize = 0 ;
+        bool aok = false ;
+        void *ablock = GB_malloc_memory (3, 1, &asize) ;
+        CHECK (ablock != NULL && ((size_t) ablock) % 64 == 0) ;
+        ablock = GB_realloc_memory (100000, 8, ablock, &asize, &aok, NULL) ;
+        CHECK (aok && ((size_t) ablock) % 64 == 0) ;
+        GB_dealloc_memory (&ablock, asize) ;
+        OK (GxB_Global_Option_get (GxB_MEMORY_ALIGNMENT, &alignment)) ;
+        CHECK (alignment == 64) ;
+    }
+    info = GxB_Global_Option_set (GxB_HUGE_PAGE_THRESHOLD, (int64_t) 1) ;
+    CHECK (info == GrB_SUCCESS || info == GrB_NOT_IMPLEMENTED) ;
+    if (info == GrB_SUCCESS)
+    {
+        OK (GxB_Global_Option_get (GxB_HUGE_PAGE_THRESHOLD,
+            &huge_page_threshold)) ;
+        CHECK (huge_page_threshold == GB_HUGE_PAGE_SIZE) ;
+        // the 32 MB Ax array of H is backed by huge pages
+        GrB_Matrix H = NULL ;
+        OK (GrB_Matrix_new (&H, GrB_FP64, 2000, 2000)) ;
+        OK (GrB_Matrix_assign_FP64 (H, NULL, NULL, 1, GrB_ALL, 2000,
+            GrB_ALL, 2000, NULL)) ;
+        OK (GrB_Matrix_nvals (&nvals, H)) ;
+        CHECK (nvals == 2000 * 2000) ;
+        OK (GrB_Matrix_free (&H)) ;
+    }
+    OK (GxB_Global_Option_set (GxB_HUGE_PAGE_THRESHOLD, (int64_t) 0)) ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_ALIGNMENT, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for the memory budget and spilling to files
+    //--------------------------------------------------------------------------
+
+    int64_t memory_budget = -1, memory_used = -1, spill_threshold = -1 ;
+    const char *spill_directory = "" ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_BUDGET, &memory_budget)) ;
+    CHECK (memory_budget == 0) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_USED, &memory_used)) ;
+    CHECK (memory_used > 0) ;
+    OK (GxB_Global_Option_get (GxB_SPILL_DIRECTORY, &spill_directory)) ;
+    CHECK (spill_directory == NULL) ;
+    OK (GxB_Global_Option_get (GxB_SPILL_THRESHOLD, &spill_threshold)) ;
+    CHECK (spill_threshold == 64 * 1024 * 1024) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) -1)) ;
+    ERR (GxB_Global_Option_set (GxB_SPILL_THRESHOLD, (int64_t) -1)) ;
+    ERR (GxB_Global_Option_set (GxB_SPILL_DIRECTORY, "/no/such/directory")) ;
+    // GraphBLAS is already over a budget of 1 byte, so all allocations fail
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 1)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_BUDGET, &memory_budget)) ;
+    CHECK (memory_budget == 1) ;
+    expected = GrB_OUT_OF_MEMORY ;
+    info = GrB_Matrix_new (&E, GrB_FP32, 4, 4) ;
+    CHECK (info == expected) ;
+    CHECK (E == NULL) ;
+    // unless they are spilled to files instead
+    info = GxB_Global_Option_set (GxB_SPILL_DIRECTORY, "/tmp") ;
+    CHECK (info == GrB_SUCCESS || info == GrB_NOT_IMPLEMENTED) ;
+    if (info == GrB_SUCCESS)
+    {
+        OK (GxB_Global_Option_get (GxB_SPILL_DIRECTORY, &spill_directory)) ;
+        CHECK (strcmp (spill_directory, "/tmp") == 0) ;
+        OK (GxB_Global_Option_set (GxB_SPILL_THRESHOLD, (int64_t) 0)) ;
+        OK (GrB_Matrix_new (&E, GrB_FP32, 4, 4)) ;
+        CHECK (GB_Global_spill_nblocks ( ) > 0) ;
+        OK (GrB_Matrix_setElement_FP32 (E, 3, 1, 2)) ;
+        OK (GrB_Matrix_wait (E, GrB_MATERIALIZE)) ;
+        float spilled_value = 0 ;
+        OK (GrB_Matrix_extractElement_FP32 (&spilled_value, E, 1, 2)) ;
+        CHECK (spilled_value == 3) ;
+        OK (GrB_Matrix_free (&E)) ;
+        CHECK (GB_Global_spill_nblocks ( ) == 0) ;
+        OK (GxB_Global_Option_set (GxB_SPILL_DIRECTORY, NULL)) ;
+        OK (GxB_Global_Option_set (GxB_SPILL_THRESHOLD,
+            (int64_t) (64 * 1024 * 1024))) ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 0)) ;
+
     //--------------------------------------------------------------------------
     // test GxB_set/get for free_pool_limit
     //--------------------------------------------------------------------------
@@ -139,6 +355,39 @@ void mexFunction
         CHECK (free_pool_limit [k] == 0) ;
     }
 
+    int64_t free_pool_cache_limit [64], free_pool_stats [3] ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_CACHE, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_CACHE, free_pool_cache_limit)) ;
+    printf ("\ndefault memory pool cache limits:\n") ;
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        if (free_pool_cache_limit [k] > 0)
+        {
+            printf ("pool %2d: cache limit %ld\n", k, free_pool_cache_limit [k]);
+        }
+    }
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        free_pool_cache_limit [k] = k ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_CACHE, free_pool_cache_limit)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_CACHE, free_pool_cache_limit)) ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        CHECK (free_pool_cache_limit [k] == 0) ;
+    }
+    for (int k = 3 ; k < 64 ; k++)
+    {
+        CHECK (free_pool_cache_limit [k] == k) ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_STATS, free_pool_stats)) ;
+    CHECK (free_pool_stats [0] == 0) ;
+    CHECK (free_pool_stats [1] == 0) ;
+    CHECK (free_pool_stats [2] == 0) ;
+    info = GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, free_pool_stats) ;
+    CHECK (info == GrB_INVALID_VALUE) ;
+
     //--------------------------------------------------------------------------
     // GrB_reduce with invalid binary op
     //--------------------------------------------------------------------------
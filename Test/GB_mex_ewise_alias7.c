@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// GB_mex_ewise_alias7: C<M> = M.*A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_ewise_alias7 (C, M, op, A, desc)"
+
+#define FREE_ALL                            \
+{                                           \
+    GrB_Matrix_free_(&A) ;                  \
+    GrB_Matrix_free_(&M) ;                  \
+    GrB_Matrix_free_(&C) ;                  \
+    GrB_Descriptor_free_(&desc) ;           \
+    GB_mx_put_global (true) ;               \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL, M = NULL, A = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    // check inputs
+    if (nargout > 1 || nargin < 4 || nargin > 5)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get C (make a deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GrB_Matrix_free_(&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    // get M (shallow copy)
+    M = GB_mx_mxArray_to_Matrix (pargin [1], "M input", false, true) ;
+    if (M == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("M failed") ;
+    }
+
+    // get op
+    bool user_complex = (Complex != GxB_FC64) && (C->type == Complex) ;
+    GrB_BinaryOp op ;
+    if (!GB_mx_mxArray_to_BinaryOp (&op, pargin [2], "op",
+        C->type, user_complex) || op == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("op failed") ;
+    }
+
+    // get A (shallow copy)
+    A = GB_mx_mxArray_to_Matrix (pargin [3], "A input", false, true) ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+
+    // get desc
+    if (!GB_mx_mxArray_to_Descriptor (&desc, PARGIN (4), "desc"))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("desc failed") ;
+    }
+
+    // C<M> = M.*A
+    METHOD (GrB_Matrix_eWiseMult_BinaryOp_(C, M, NULL, op, M, A, desc)) ;
+
+    // return C as a struct and free the GraphBLAS C
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+
+    FREE_ALL ;
+}
+
@@ -9,7 +9,10 @@
 
 #include "GB_mex.h"
 
-#define USAGE "[I,J,X] = GB_mex_extractTuples (A, xtype)"
+// If order is present, GxB_Matrix_extractTuples_Ordered is used, with order
+// 0 (by row), 1 (by column), or -1 (as held in A).
+
+#define USAGE "[I,J,X] = GB_mex_extractTuples (A, xtype, order)"
 
 #define FREE_ALL                        \
 {                                       \
@@ -32,7 +35,7 @@ void mexFunction
     GrB_Index nvals = 0 ;
 
     // check inputs
-    if (nargout > 3 || nargin < 1 || nargin > 2)
+    if (nargout > 3 || nargin < 1 || nargin > 3)
     {
         mexErrMsgTxt ("Usage: " USAGE) ;
     }
@@ -73,7 +76,14 @@ void mexFunction
     }
 
     // [I,J,X] = find (A)
-    if (GB_VECTOR_OK (A))
+    if (nargin > 2)
+    {
+        // test the ordered extract method
+        int GET_SCALAR (2, int, order, GxB_NO_FORMAT) ;
+        METHOD (GxB_Matrix_extractTuples_Ordered (I, J, X, &nvals, xtype,
+            order, A, NULL)) ;
+    }
+    else if (GB_VECTOR_OK (A))
     {
         // test extract vector methods
         GrB_Vector v = (GrB_Vector) A ;
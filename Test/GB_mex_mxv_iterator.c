@@ -8,12 +8,16 @@
 //------------------------------------------------------------------------------
 
 // A and X must have the same type.  If boolean, the lor_land semiring is used.
-// Otherwise, the plus_times semiring is used for the given type.
+// Otherwise, the plus_times semiring is used for the given type.  If ntasks
+// is present and > 0, kinds 0 and 1 traverse A one partition at a time, with
+// GxB_rowIterator_seekPartition or GxB_colIterator_seekPartition, and check
+// each entry against the span from GxB_rowIterator_getSpan or
+// GxB_colIterator_getSpan.
 
 #include "GB_mex.h"
 #include "GB_mex_errors.h"
 
-#define USAGE "Y = GB_mex_mxv_iterator (A, X, kind)"
+#define USAGE "Y = GB_mex_mxv_iterator (A, X, kind, ntasks)"
 
 #define FREE_ALL                                    \
 {                                                   \
@@ -49,7 +53,7 @@ void mexFunction
     GxB_Iterator iterator = NULL ;
 
     // check inputs
-    if (nargout > 1 || nargin < 2 || nargin > 3)
+    if (nargout > 1 || nargin < 2 || nargin > 4)
     {
         mexErrMsgTxt ("Usage: " USAGE) ;
     }
@@ -95,6 +99,9 @@ void mexFunction
     bool use_macros = (kind <= 7) ;
     kind = kind % 8 ;
 
+    // get ntasks
+    int GET_SCALAR (3, int, ntasks, 0) ;
+
     // make sure X is full
     int sparsity ;
     OK (GxB_Vector_Option_get (X, GxB_SPARSITY_STATUS, &sparsity)) ;
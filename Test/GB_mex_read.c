@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// GB_mex_read: read a matrix from a Matrix Market or binary COO file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// With 1 or 2 inputs, the file is read by GxB_Matrix_read_MatrixMarket.
+// Otherwise, it is read by GxB_Matrix_read_binary_COO.  If type is '' the
+// type is NULL.  If the read fails, C is returned as empty, and info gives
+// the error code.  The read is not repeated for malloc debugging (since the
+// file would need to be rewound), but the test for memory leaks is done.
+
+#include "GB_mex.h"
+
+#define USAGE "[C,info] = GB_mex_read (filename, type, nrows, ncols, index_size)"
+
+#define FREE_ALL                        \
+{                                       \
+    if (f != NULL) fclose (f) ;         \
+    GrB_Matrix_free_(&C) ;              \
+    GB_mx_put_global (true) ;           \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL ;
+    FILE *f = NULL ;
+
+    // check inputs
+    if (nargout > 2 || nargin < 1 || nargin == 3 || nargin == 4 || nargin > 5)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get the filename
+    #define LEN 2048
+    char filename [LEN+2] ;
+    if (GB_mx_mxArray_to_string (filename, LEN, pargin [0]) <= 0)
+    {
+        mexErrMsgTxt ("filename must be a string") ;
+    }
+
+    // get the type
+    GrB_Type type = NULL ;
+    if (nargin > 1)
+    {
+        type = GB_mx_string_to_Type (pargin [1], NULL) ;
+    }
+
+    // read the file
+    GrB_Info info ;
+    if (nargin <= 2)
+    {
+        f = fopen (filename, "r") ;
+        if (f == NULL) mexErrMsgTxt ("cannot open file") ;
+        info = GxB_Matrix_read_MatrixMarket (&C, type, f, NULL) ;
+    }
+    else
+    {
+        GrB_Index GET_SCALAR (2, GrB_Index, nrows, 0) ;
+        GrB_Index GET_SCALAR (3, GrB_Index, ncols, 0) ;
+        int GET_SCALAR (4, int, index_size, 8) ;
+        f = fopen (filename, "rb") ;
+        if (f == NULL) mexErrMsgTxt ("cannot open file") ;
+        info = GxB_Matrix_read_binary_COO (&C, type, nrows, ncols, index_size,
+            f, NULL) ;
+    }
+
+    // return C as a struct, or empty if the read failed
+    if (info == GrB_SUCCESS)
+    {
+        pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+    }
+    else
+    {
+        pargout [0] = mxCreateDoubleMatrix (0, 0, mxREAL) ;
+    }
+    if (nargout > 1)
+    {
+        pargout [1] = mxCreateDoubleScalar ((double) info) ;
+    }
+    FREE_ALL ;
+}
@@ -12,6 +12,8 @@
 // GrB_Matrix_serialize and GrB_Matrix_deserialize
 // GxB_Vector_serialize and GxB_Vector_deserialize
 // GrB_Vector_serialize and GrB_Vector_deserialize
+// GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream
+// GxB_Vector_serialize_stream and GxB_Vector_deserialize_stream
 
 #include "GB_mex.h"
 #include "GB_mex_errors.h"
@@ -26,17 +28,58 @@
 // ...
 // GxB_COMPRESSION_LZ4HC 2009  // LZ4HC:9
 
-#define USAGE "C = GB_mex_serialize (A, method)"
+// If shallow is true, GxB*deserialize is used with GxB_SHALLOW_IMPORT, and
+// then the shallow content of C is copied before C is returned.
+
+// If stream is true, A is also serialized to a stream held in memory, which
+// must match the blob, and the stream is deserialized and compared with C.
+
+#define USAGE "C = GB_mex_serialize (A, method, shallow, stream)"
 
 #define FREE_ALL                        \
 {                                       \
     mxFree (blob) ;                     \
+    if (S.p != NULL) mxFree (S.p) ;     \
+    GrB_Matrix_free_(&C2) ;             \
     GrB_Matrix_free_(&A) ;              \
     GrB_Matrix_free_(&C) ;              \
     GrB_Descriptor_free_(&desc) ;       \
     GB_mx_put_global (true) ;           \
 }
 
+// a stream held in memory
+typedef struct
+{
+    GB_void *p ;        // the stream, of size S->size
+    size_t size ;       // allocated size of the stream
+    size_t len ;        // # of bytes written to the stream
+    size_t pos ;        // # of bytes read from the stream
+}
+mem_stream ;
+
+bool mem_write (void *stream, const void *data, size_t size)
+{
+    mem_stream *S = (mem_stream *) stream ;
+    if (S->len + size > S->size)
+    {
+        size_t newsize = GB_IMAX (2 * S->size, S->len + size) ;
+        S->p = (S->p == NULL) ? mxMalloc (newsize) : mxRealloc (S->p, newsize) ;
+        S->size = newsize ;
+    }
+    memcpy (S->p + S->len, data, size) ;
+    S->len += size ;
+    return (true) ;
+}
+
+bool mem_read (void *stream, void *data, size_t size)
+{
+    mem_stream *S = (mem_stream *) stream ;
+    if (S->pos + size > S->len) return (false) ;    // stream is truncated
+    memcpy (data, S->p + S->pos, size) ;
+    S->pos += size ;
+    return (true) ;
+}
+
 void mexFunction
 (
     int nargout,
@@ -47,13 +90,14 @@ void mexFunction
 {
 
     bool malloc_debug = GB_mx_get_global (true) ;
-    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Matrix A = NULL, C = NULL, C2 = NULL ;
+    mem_stream S = { NULL, 0, 0, 0 } ;
     GrB_Descriptor desc = NULL ;
     void *blob = NULL ;
     GrB_Index blob_size = 0 ;
 
     // check inputs
-    if (nargout > 1 || nargin < 1 || nargin > 3)
+    if (nargout > 1 || nargin < 1 || nargin > 4)
     {
         mexErrMsgTxt ("Usage: " USAGE) ;
     }
@@ -80,11 +124,22 @@ void mexFunction
     {
         method = 0 ;
     }
-    if (method != 0)
+    // get shallow
+    bool GET_SCALAR (2, bool, shallow, false) ;
+    // get stream
+    bool GET_SCALAR (3, bool, stream, false) ;
+    if (method != 0 || shallow)
     {
         GrB_Descriptor_new (&desc) ;
         GxB_Desc_set (desc, GxB_COMPRESSION, method) ;
     }
+    if (shallow)
+    {
+        GxB_Desc_set (desc, GxB_IMPORT, GxB_SHALLOW_IMPORT) ;
+        int import_method = GxB_DEFAULT ;
+        GxB_Desc_get (desc, GxB_IMPORT, &import_method) ;
+        CHECK (import_method == GxB_SHALLOW_IMPORT) ;
+    }
 
     // serialize A into the blob and then deserialize into C
     if (use_GrB_serialize)
@@ -134,6 +189,64 @@ void mexFunction
     CHECK (MATCH (type_name1, type_name2)) ;
     CHECK (MATCH (type_name1, type_name3)) ;
 
+    if (shallow)
+    {
+        // a shallow C can be an input to any method
+        GrB_Matrix C2 = NULL ;
+        METHOD (GrB_Matrix_dup (&C2, C)) ;
+        CHECK (!GB_is_shallow (C2)) ;
+        GrB_Matrix_free_(&C2) ;
+        // C no longer refers to the blob after GB_unshallow
+        METHOD (GB_unshallow (C, NULL)) ;
+        CHECK (!GB_is_shallow (C)) ;
+    }
+
+    if (stream)
+    {
+        // serialize A to a stream in memory
+        bool is_vector = GB_VECTOR_OK (A) ;
+        if (is_vector)
+        {
+            METHOD ((S.len = 0, GxB_Vector_serialize_stream (mem_write, &S,
+                (GrB_Vector) A, desc))) ;
+        }
+        else
+        {
+            METHOD ((S.len = 0, GxB_Matrix_serialize_stream (mem_write, &S, A,
+                desc))) ;
+        }
+        if (method == GxB_COMPRESSION_NONE)
+        {
+            // the stream must match the uncompressed blob
+            CHECK (S.len == blob_size) ;
+            CHECK (memcmp (S.p, blob, blob_size) == 0) ;
+        }
+        // the stream can be deserialized as a blob in memory
+        METHOD (GxB_Matrix_deserialize (&C2, atype, S.p, S.len, desc)) ;
+        CHECK (GB_mx_isequal (C, C2, 0)) ;
+        GrB_Matrix_free_(&C2) ;
+        // deserialize the stream into C2, which must match C
+        if (is_vector)
+        {
+            METHOD ((S.pos = 0, GxB_Vector_deserialize_stream (
+                (GrB_Vector *) &C2, atype, mem_read, &S, desc))) ;
+        }
+        else
+        {
+            METHOD ((S.pos = 0, GxB_Matrix_deserialize_stream (&C2, atype,
+                mem_read, &S, desc))) ;
+        }
+        CHECK (S.pos == S.len) ;
+        CHECK (GB_mx_isequal (C, C2, 0)) ;
+        GrB_Matrix_free_(&C2) ;
+        // a truncated stream is invalid
+        S.len-- ;
+        S.pos = 0 ;
+        GrB_Info info, expected = GrB_INVALID_OBJECT ;
+        ERR (GxB_Matrix_deserialize_stream (&C2, atype, mem_read, &S, desc)) ;
+        CHECK (C2 == NULL) ;
+    }
+
     // return C as a struct and free the GraphBLAS C
     pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
     FREE_ALL ;
@@ -12,6 +12,9 @@
 //  1: standard CSC
 //  3: hyper CSR
 //  4: hyper CSC
+//  12: standard CSR, with 32-bit indices
+//  13: standard CSC, with 32-bit indices
+//  14: Arrow buffers (unpacked as Arrow, packed as CSR/CSC, bitmap, or full)
 
 #include "GB_mex.h"
 
@@ -24,6 +27,9 @@
     if (Cb != NULL) { mxFree (Cb) ; Cb = NULL ; }   \
     if (Ci != NULL) { mxFree (Ci) ; Ci = NULL ; }   \
     if (Cx != NULL) { mxFree (Cx) ; Cx = NULL ; }   \
+    if (Cp32 != NULL) { mxFree (Cp32) ; Cp32 = NULL ; } \
+    if (Ci32 != NULL) { mxFree (Ci32) ; Ci32 = NULL ; } \
+    if (Cv != NULL) { mxFree (Cv) ; Cv = NULL ; }   \
     GrB_Matrix_free_(&C) ;                          \
 }
 
@@ -49,6 +55,9 @@ GrB_Matrix C = NULL ;
 GrB_Index *Cp = NULL, *Ch = NULL, *Ci = NULL ;
 void *Cx = NULL ;
 int8_t *Cb = NULL ;
+uint32_t *Cp32 = NULL, *Ci32 = NULL ;
+uint8_t *Cv = NULL ;
+GrB_Index Cv_size = 0 ;
 GB_Context Context = NULL ;
 GrB_Index nvec = 0, nvals = 0 ;
 
@@ -103,7 +112,7 @@ void mexFunction
         format_matrix = -format_matrix ;
     }
 
-    // get export/import format (0 to 11)
+    // get export/import format (0 to 14)
     int GET_SCALAR (2, int, format_export, 0) ;
 
     #define GET_DEEP_COPY   GrB_Matrix_dup (&C, A) ;
@@ -396,6 +405,113 @@ GrB_Info unpack_pack
 
             break ;
 
+        //----------------------------------------------------------------------
+        case 12 :    // standard CSR, with 32-bit indices
+        //----------------------------------------------------------------------
+
+            OK (GxB_Matrix_unpack_CSR32 (C,
+                &Cp32, &Ci32, &Cx, &Cp_size, &Ci_size, &Cx_size, &iso,
+                &jumbled, NULL)) ;
+
+            OK (GxB_Matrix_pack_CSR32 (C,
+                &Cp32, &Ci32, &Cx, Cp_size, Ci_size, Cx_size, iso,
+                jumbled, NULL)) ;
+
+            break ;
+
+        //----------------------------------------------------------------------
+        case 13 :    // standard CSC, with 32-bit indices
+        //----------------------------------------------------------------------
+
+            OK (GxB_Matrix_unpack_CSC32 (C,
+                &Cp32, &Ci32, &Cx, &Cp_size, &Ci_size, &Cx_size, &iso,
+                NULL, NULL)) ;
+
+            OK (GxB_Matrix_pack_CSC32 (C,
+                &Cp32, &Ci32, &Cx, Cp_size, Ci_size, Cx_size, iso,
+                false, NULL)) ;
+
+            break ;
+
+        //----------------------------------------------------------------------
+        case 14 :    // Arrow buffers
+        //----------------------------------------------------------------------
+
+        {
+            int layout ;
+            bool by_col ;
+            OK (GxB_Matrix_unpack_Arrow (C, &layout, &by_col,
+                &Cp, &Ci, &Cv, &Cx, &Cp_size, &Ci_size, &Cv_size, &Cx_size,
+                &iso, NULL)) ;
+
+            if (layout == GxB_SPARSE)
+            {
+                if (Cv != NULL) mexErrMsgTxt ("Arrow: invalid validity") ;
+                if (by_col)
+                {
+                    OK (GxB_Matrix_pack_CSC (C,
+                        &Cp, &Ci, &Cx, Cp_size, Ci_size, Cx_size, iso,
+                        false, NULL)) ;
+                }
+                else
+                {
+                    OK (GxB_Matrix_pack_CSR (C,
+                        &Cp, &Ci, &Cx, Cp_size, Ci_size, Cx_size, iso,
+                        false, NULL)) ;
+                }
+            }
+            else if (Cv == NULL)
+            {
+                if (Cp != NULL || Ci != NULL) mexErrMsgTxt ("Arrow: full") ;
+                if (by_col)
+                {
+                    OK (GxB_Matrix_pack_FullC (C, &Cx, Cx_size, iso, NULL)) ;
+                }
+                else
+                {
+                    OK (GxB_Matrix_pack_FullR (C, &Cx, Cx_size, iso, NULL)) ;
+                }
+            }
+            else
+            {
+                // expand the Arrow validity bitmap into a GraphBLAS bitmap
+                GrB_Index nrows, ncols ;
+                OK (GrB_Matrix_nrows (&nrows, C)) ;
+                OK (GrB_Matrix_ncols (&ncols, C)) ;
+                GrB_Index n = nrows * ncols ;
+                if (Cv_size < (n+7)/8 || Cv_size % 64 != 0)
+                {
+                    mexErrMsgTxt ("Arrow: invalid validity size") ;
+                }
+                Cb_size = GB_IMAX (n, 1) ;
+                Cb = mxMalloc (Cb_size) ;
+                nvals = 0 ;
+                for (GrB_Index p = 0 ; p < n ; p++)
+                {
+                    Cb [p] = (Cv [p/8] >> (p%8)) & 1 ;
+                    nvals += Cb [p] ;
+                }
+                for (GrB_Index p = n ; p < 8 * Cv_size ; p++)
+                {
+                    // the padding must be zero
+                    if ((Cv [p/8] >> (p%8)) & 1) mexErrMsgTxt ("Arrow: pad") ;
+                }
+                mxFree (Cv) ;
+                Cv = NULL ;
+                if (by_col)
+                {
+                    OK (GxB_Matrix_pack_BitmapC (C,
+                        &Cb, &Cx, Cb_size, Cx_size, iso, nvals, NULL)) ;
+                }
+                else
+                {
+                    OK (GxB_Matrix_pack_BitmapR (C,
+                        &Cb, &Cx, Cb_size, Cx_size, iso, nvals, NULL)) ;
+                }
+            }
+        }
+        break ;
+
 
         default : mexErrMsgTxt ("invalid export format") ;
     }
@@ -584,6 +700,14 @@ GrB_Info vector_unpack_pack
 
             return (GrB_SUCCESS) ;
 
+        //----------------------------------------------------------------------
+        case 12 :    // standard CSR, with 32-bit indices
+        case 13 :    // standard CSC, with 32-bit indices
+        case 14 :    // Arrow buffers
+        //----------------------------------------------------------------------
+
+            return (GrB_SUCCESS) ;
+
         default : mexErrMsgTxt ("invalid format") ;
     }
 
@@ -11,18 +11,22 @@
 #undef GxB_rowIterator_kount
 #undef GxB_rowIterator_seekRow
 #undef GxB_rowIterator_kseek
+#undef GxB_rowIterator_seekPartition
 #undef GxB_rowIterator_nextRow
 #undef GxB_rowIterator_nextCol
 #undef GxB_rowIterator_getRowIndex
 #undef GxB_rowIterator_getColIndex
+#undef GxB_rowIterator_getSpan
 #undef GxB_colIterator_attach
 #undef GxB_colIterator_kount
 #undef GxB_colIterator_seekCol
 #undef GxB_colIterator_kseek
+#undef GxB_colIterator_seekPartition
 #undef GxB_colIterator_nextCol
 #undef GxB_colIterator_nextRow
 #undef GxB_colIterator_getColIndex
 #undef GxB_colIterator_getRowIndex
+#undef GxB_colIterator_getSpan
 #undef GxB_Vector_Iterator_getpmax
 #undef GxB_Vector_Iterator_seek
 #undef GxB_Vector_Iterator_next
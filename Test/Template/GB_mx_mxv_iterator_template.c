@@ -92,8 +92,170 @@
     }                                                                   \
 }
 
+//------------------------------------------------------------------------------
+// SPAN_CHECK: check the current entry against the kth entry in the span
+//------------------------------------------------------------------------------
+
+#define SPAN_CHECK(index)                                               \
+{                                                                       \
+    /* skip entries not present in the bitmap */                        \
+    while (k < count && Span_b != NULL && !Span_b [k]) k++ ;            \
+    Assert (k < count) ;                                                \
+    GrB_Index ispan = (Span_i == NULL) ? (first + k) : Span_i [k] ;     \
+    Assert (ispan == index) ;                                           \
+    size_t tsize = type->size ;                                         \
+    GB_void xiter [GB_VLA(tsize)] ;                                     \
+    GxB_Iterator_get_UDT (iterator, xiter) ;                            \
+    const GB_void *xspan = ((const GB_void *) Span_x) +                 \
+        ((Span_iso) ? 0 : (k * tsize)) ;                                \
+    Assert (memcmp (xiter, xspan, tsize) == 0) ;                        \
+    k++ ;                                                               \
+}
+
+#define SPAN_DONE                                                       \
+{                                                                       \
+    while (k < count && Span_b != NULL && !Span_b [k]) k++ ;            \
+    Assert (k == count) ;                                               \
+}
+
 {
-    if (kind == 0)
+    if (ntasks > 0 && kind == 0)
+    {
+
+        //----------------------------------------------------------------------
+        // Y = A*X using a row iterator, one partition of A at a time
+        //----------------------------------------------------------------------
+
+        OK (GxB_rowIterator_attach (iterator, A, NULL)) ;
+        GrB_Index pfirst = 0 ;
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            // seek to the first row of the tid-th partition of A
+            info = GxB_rowIterator_seekPartition (iterator, tid, ntasks) ;
+            OK (info) ;
+            while (info != GxB_EXHAUSTED)
+            {
+                // iterate over entries in A(i,:) in this partition
+                GrB_Index i = GxB_rowIterator_getRowIndex (iterator) ;
+                Assert (i >= 0 && i < nrows) ;
+                // get the span of A(i,:) in this partition
+                GrB_Index count, first, k = 0 ;
+                const GrB_Index *Span_i ;
+                const int8_t *Span_b ;
+                const void *Span_x ;
+                bool Span_iso ;
+                GrB_Info info2 = GxB_rowIterator_getSpan (iterator, &count,
+                    &Span_i, &first, &Span_b, &Span_x, &Span_iso) ;
+                Assert (info2 == ((count == 0) ? GrB_NO_VALUE : GrB_SUCCESS)) ;
+                Assert (Span_iso == A->iso) ;
+                while (info == GrB_SUCCESS)
+                {
+                    // the entry must match the next entry in the span
+                    SPAN_CHECK (GxB_rowIterator_getColIndex (iterator)) ;
+                    // each entry is visited just once, in order
+                    GrB_Index p = iterator->p ;
+                    Assert (p >= pfirst) ;
+                    pfirst = p + 1 ;
+                    // get the entry A(i,j)
+                    GrB_Index j = GxB_rowIterator_getColIndex (iterator) ;
+                    Assert (j >= 0 && j < ncols) ;
+                    // Y (i) += A(i,j) * X (j)
+                    MULTADD ;
+                    // move to the next entry in A(i,:)
+                    info = GxB_rowIterator_nextCol (iterator) ;
+                    OK (info) ;
+                }
+                // all entries in the span have been visited
+                SPAN_DONE ;
+                // move to the next row in this partition
+                info = GxB_rowIterator_nextRow (iterator) ;
+                OK (info) ;
+            }
+        }
+
+        // an invalid partition leaves the iterator exhausted
+        info = GxB_rowIterator_seekPartition (iterator, ntasks, ntasks) ;
+        Assert (info == GxB_EXHAUSTED) ;
+        GrB_Index i = GxB_rowIterator_getRowIndex (iterator) ;
+        Assert (i == nrows) ;
+
+        // seekRow removes the partition
+        info = GxB_rowIterator_seekPartition (iterator, 0, ntasks) ;
+        OK (info) ;
+        GrB_Index kount2 = 0 ;
+        GrB_Index kount1 = GxB_rowIterator_kount (iterator) ;
+        info = GxB_rowIterator_seekRow (iterator, 0) ;
+        while (info != GxB_EXHAUSTED)
+        {
+            kount2++ ;
+            info = GxB_rowIterator_nextRow (iterator) ;
+            OK (info) ;
+        }
+        Assert (kount1 == kount2) ;
+
+    }
+    else if (ntasks > 0 && kind == 1)
+    {
+
+        //----------------------------------------------------------------------
+        // Y = A*X using a col iterator, one partition of A at a time
+        //----------------------------------------------------------------------
+
+        OK (GxB_colIterator_attach (iterator, A, NULL)) ;
+        GrB_Index pfirst = 0 ;
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        {
+            // seek to the first column of the tid-th partition of A
+            info = GxB_colIterator_seekPartition (iterator, tid, ntasks) ;
+            OK (info) ;
+            while (info != GxB_EXHAUSTED)
+            {
+                // iterate over entries in A(:,j) in this partition
+                GrB_Index j = GxB_colIterator_getColIndex (iterator) ;
+                Assert (j >= 0 && j < ncols) ;
+                // get the span of A(:,j) in this partition
+                GrB_Index count, first, k = 0 ;
+                const GrB_Index *Span_i ;
+                const int8_t *Span_b ;
+                const void *Span_x ;
+                bool Span_iso ;
+                GrB_Info info2 = GxB_colIterator_getSpan (iterator, &count,
+                    &Span_i, &first, &Span_b, &Span_x, &Span_iso) ;
+                Assert (info2 == ((count == 0) ? GrB_NO_VALUE : GrB_SUCCESS)) ;
+                Assert (Span_iso == A->iso) ;
+                while (info == GrB_SUCCESS)
+                {
+                    // the entry must match the next entry in the span
+                    SPAN_CHECK (GxB_colIterator_getRowIndex (iterator)) ;
+                    // each entry is visited just once, in order
+                    GrB_Index p = iterator->p ;
+                    Assert (p >= pfirst) ;
+                    pfirst = p + 1 ;
+                    // get the entry A(i,j)
+                    GrB_Index i = GxB_colIterator_getRowIndex (iterator) ;
+                    Assert (i >= 0 && i < nrows) ;
+                    // Y (i) += A(i,j) * X (j)
+                    MULTADD ;
+                    // move to the next entry in A(:,j)
+                    info = GxB_colIterator_nextRow (iterator) ;
+                    OK (info) ;
+                }
+                // all entries in the span have been visited
+                SPAN_DONE ;
+                // move to the next column in this partition
+                info = GxB_colIterator_nextCol (iterator) ;
+                OK (info) ;
+            }
+        }
+
+        // an invalid partition leaves the iterator exhausted
+        info = GxB_colIterator_seekPartition (iterator, -1, ntasks) ;
+        Assert (info == GxB_EXHAUSTED) ;
+        GrB_Index j = GxB_colIterator_getColIndex (iterator) ;
+        Assert (j == ncols) ;
+
+    }
+    else if (kind == 0)
     {
 
         //----------------------------------------------------------------------
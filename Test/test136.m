@@ -33,6 +33,18 @@ C2 = GB_mex_subassign  (C, M, 'plus', A, I0, [ ], [ ]) ;
 C1 = GB_spec_subassign (C, M, 'plus', A, I , [ ], [ ], false) ;
 GB_spec_compare (C1, C2) ;
 
+% Method 08n with dense M(:,j) or dense A(:,j)
+M (:,3) = 1 ;
+A (:,3) = sprand (am, 1, 0.01) ;
+A (:,4) = 1 + sparse (rand (am, 1)) ;
+M (:,4) = spones (sprand (am, 1, 0.01)) ;
+M (:,5) = 1 ;
+A (:,5) = 1 + sparse (rand (am, 1)) ;
+M (100:200,5) = 0 ;
+C2 = GB_mex_subassign  (C, M, 'plus', A, I0, [ ], [ ]) ;
+C1 = GB_spec_subassign (C, M, 'plus', A, I , [ ], [ ], false) ;
+GB_spec_compare (C1, C2) ;
+
 % create a Mask with explicit zero entries
 [i j x] = find (M) ;
 nz = length (x) ;
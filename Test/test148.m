@@ -1,10 +1,10 @@
 function test148
-%TEST148 eWiseAdd with aliases
+%TEST148 eWiseAdd and eWiseMult with aliases
 
 % SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
 % SPDX-License-Identifier: Apache-2.0
 
-fprintf ('test148 ---------------eWiseAdd with alias\n') ;
+fprintf ('test148 ---------------eWiseAdd and eWiseMult with alias\n') ;
 
 rng ('default') ;
 
@@ -73,4 +73,28 @@ C1 = GB_mex_Matrix_eWiseAdd (C, M, [ ], 'plus', M, A, desc) ;
 C2 = GB_mex_ewise_alias6 (C, M, 'plus', A, desc) ;
 assert (norm (C1.matrix - C2.matrix, 1) < 1e-12) ;
 
+% C<M> = M.*A, where the structural mask is redundant
+C1 = GB_mex_Matrix_eWiseMult (C, M, [ ], 'times', M, A, desc) ;
+C2 = GB_mex_ewise_alias7 (C, M, 'times', A, desc) ;
+assert (norm (C1.matrix - C2.matrix, 1) < 1e-12) ;
+
+A = sprand (n, n, 0.5) ;
+M = sprand (n, n, 0.5) ;
+C1 = GB_mex_Matrix_eWiseMult (C, M, [ ], 'times', M, A, desc) ;
+C2 = GB_mex_ewise_alias7 (C, M, 'times', A, desc) ;
+assert (norm (C1.matrix - C2.matrix, 1) < 1e-12) ;
+
+% C<M> = M.*M, where M, A, and B all have the same pattern
+C1 = GB_mex_Matrix_eWiseMult (C, M, [ ], 'times', M, M, desc) ;
+C2 = GB_mex_ewise_alias7 (C, M, 'times', M, desc) ;
+assert (norm (C1.matrix - C2.matrix, 1) < 1e-12) ;
+C0 = C ;
+C0 (M ~= 0) = M (M ~= 0) .^ 2 ;
+assert (norm (C0 - C2.matrix, 1) < 1e-12) ;
+
+% C<M> = M.*A with a valued mask, which is not redundant
+C1 = GB_mex_Matrix_eWiseMult (C, M, [ ], 'times', M, A, [ ]) ;
+C2 = GB_mex_ewise_alias7 (C, M, 'times', A, [ ]) ;
+assert (norm (C1.matrix - C2.matrix, 1) < 1e-12) ;
+
 fprintf ('test148: all tests passed\n') ;
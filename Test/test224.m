@@ -20,7 +20,7 @@ for m = [0 1 5 100]
             is_sparse = (nz < m*n) ;
             fprintf ('.') ;
             for fmt_matrix = fmts
-                for fmt_export = 0:11
+                for fmt_export = 0:14
                     try
                         C = GB_mex_unpack_pack (A, fmt_matrix, fmt_export) ;
                         GB_spec_compare (C, A) ;
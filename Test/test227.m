@@ -112,5 +112,42 @@ for k2 = [4 7 45:52 ]
     end
 end
 
+%-------------------------------------------------------------------------------
+% positional kron with a single vector of C split across many tasks
+%-------------------------------------------------------------------------------
+
+% With a tiny chunk, GB_kroner slices the entries of C so that each vector of
+% C is computed by several tasks, and each task starts in the middle of a
+% vector.
+
+fprintf ('\npositional kron, split vectors:\n') ;
+[save_nthreads, save_chunk] = nthreads_get ;
+nthreads_set (4, 1) ;
+
+clear A B C
+A.matrix = sparse (100 * sprandn (20, 1, 0.5)) ;
+B.matrix = sparse (100 * sprandn (30, 1, 0.5)) ;
+C.matrix = sparse (600, 1) ;
+for k2 = [4 7 45:52 ]
+    binop = binops {k2}  ;
+    for k1 = 1:2
+        type = types {k1} ;
+        op.opname = binop ;
+        op.optype = type ;
+        for A_is_hyper = 0:1
+            for B_is_hyper = 0:1
+                A.is_hyper = A_is_hyper ;
+                B.is_hyper = B_is_hyper ;
+                C0 = GB_spec_kron (C, [ ], [ ], op, A, B, dnn) ;
+                C1 = GB_mex_kron  (C, [ ], [ ], op, A, B, dnn) ;
+                GB_spec_compare (C0, C1) ;
+            end
+        end
+        fprintf ('.') ;
+    end
+end
+
+nthreads_set (save_nthreads, save_chunk) ;
+
 fprintf ('\ntest227: all tests passed\n') ;
 
@@ -21,10 +21,20 @@ for k1 = 1:length (types)
                 A.sparsity = A_sparsity ;
                 C = GB_mex_serialize (A, -2) ;      % GrB_serialize
                 GB_spec_compare (A, C) ;
-                for method = [-1 0 1000 2000:2009]
+                for method = [-1 0 1000 2000:2009 101000]
                     C = GB_mex_serialize (A, method) ;
                     GB_spec_compare (A, C) ;
                 end
+                % deserialize with GxB_SHALLOW_IMPORT
+                for method = [-1 0]
+                    C = GB_mex_serialize (A, method, true) ;
+                    GB_spec_compare (A, C) ;
+                end
+                % serialize/deserialize with a stream
+                for method = [-1 0 2001]
+                    C = GB_mex_serialize (A, method, false, true) ;
+                    GB_spec_compare (A, C) ;
+                end
             end
         end
     end
@@ -35,6 +45,19 @@ nthreads_set (4, 1) ;
 d = 0.5 ;
 A = GB_spec_random (1000, 1000, d, 128, 'double') ;
 C = GB_mex_serialize (A, 0) ;
+C = GB_mex_serialize (A, 0, false, true) ;
+GB_spec_compare (A, C) ;
+% delta+varint encoding of the integer arrays
+for method = [100000 101000 102009]
+    C = GB_mex_serialize (A, method) ;
+    GB_spec_compare (A, C) ;
+    C = GB_mex_serialize (A, method, false, true) ;
+    GB_spec_compare (A, C) ;
+end
+A = GB_spec_random (1000, 1000, 0.01, 128, 'double') ;
+A.sparsity = 1 ;    % hypersparse
+C = GB_mex_serialize (A, 102009) ;
+GB_spec_compare (A, C) ;
 nthreads_set (save_nthreads, save_chunk) ;
 
 fprintf ('\n') ;
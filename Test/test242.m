@@ -96,6 +96,14 @@ for k = 1:(ntypes + 1)
             y1 = GB_mex_mxv_iterator (A, x, 0+8) ;  % with functions
             GB_spec_compare (y0, y1, 0, tol) ;
 
+            % CSR with row iterator, by partitions
+            for ntasks = [1 3 7 100]
+                y1 = GB_mex_mxv_iterator (A, x, 0, ntasks) ;    % macros
+                GB_spec_compare (y0, y1, 0, tol) ;
+                y1 = GB_mex_mxv_iterator (A, x, 0+8, ntasks) ;  % functions
+                GB_spec_compare (y0, y1, 0, tol) ;
+            end
+
             % CSR with entry iterator
             y1 = GB_mex_mxv_iterator (A, x, 2) ;    % with macros
             GB_spec_compare (y0, y1, 0, tol) ;
@@ -127,6 +135,14 @@ for k = 1:(ntypes + 1)
             y1 = GB_mex_mxv_iterator (A, x, 1+8) ;  % with functions
             GB_spec_compare (y0, y1, 0, tol) ;
 
+            % CSC with col iterator, by partitions
+            for ntasks = [1 3 7 100]
+                y1 = GB_mex_mxv_iterator (A, x, 1, ntasks) ;    % macros
+                GB_spec_compare (y0, y1, 0, tol) ;
+                y1 = GB_mex_mxv_iterator (A, x, 1+8, ntasks) ;  % functions
+                GB_spec_compare (y0, y1, 0, tol) ;
+            end
+
             % CSC with entry iterator
             y1 = GB_mex_mxv_iterator (A, x, 2) ;    % with macros
             GB_spec_compare (y0, y1, 0, tol) ;
@@ -0,0 +1,178 @@
+function test244
+%TEST244 test GxB_Matrix_read_MatrixMarket and GxB_Matrix_read_binary_COO
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test244 read Matrix Market and binary COO files\n') ;
+rng ('default') ;
+GB_builtin_complex_set (true) ;
+filename = [tempname '.mtx'] ;
+
+[save_nthreads, save_chunk] = nthreads_get ;
+nthreads_set (4, 1) ;
+
+%-------------------------------------------------------------------------------
+% coordinate real general, with comments and blank lines
+%-------------------------------------------------------------------------------
+
+m = 200 ;
+n = 100 ;
+A = sprandn (m, n, 0.1) ;
+[i, j, x] = find (A) ;
+f = fopen (filename, 'w') ;
+fprintf (f, '%%%%MatrixMarket matrix coordinate real general\n') ;
+fprintf (f, '%% a comment\n\n') ;
+fprintf (f, '%d %d %d\n', m, n, length (x)) ;
+for k = 1:length (x)
+    fprintf (f, '%d %d %.17g\n', i (k), j (k), x (k)) ;
+    if (mod (k, 10) == 0)
+        fprintf (f, '\n') ;
+    end
+end
+fclose (f) ;
+C = GB_mex_read (filename) ;
+assert (isequal (C.class, 'double')) ;
+assert (isequal (C.matrix, A)) ;
+C = GB_mex_read (filename, 'single') ;
+assert (isequal (C.class, 'single')) ;
+assert (isequal (double (C.matrix), double (single (full (A))))) ;
+
+%-------------------------------------------------------------------------------
+% coordinate integer symmetric and skew-symmetric
+%-------------------------------------------------------------------------------
+
+n = 100 ;
+L = tril (round (100 * sprandn (n, n, 0.1))) ;
+L = L - diag (diag (L)) ;
+for skew = [false true]
+    if (skew)
+        A = L - L' ;
+        kind = 'skew-symmetric' ;
+    else
+        A = L + L' + speye (n) ;
+        kind = 'symmetric' ;
+    end
+    [i, j, x] = find (tril (A)) ;
+    f = fopen (filename, 'w') ;
+    fprintf (f, '%%%%MatrixMarket matrix coordinate integer %s\n', kind) ;
+    fprintf (f, '%d %d %d\n', n, n, length (x)) ;
+    fprintf (f, '%d %d %d\n', [i j x]') ;
+    fclose (f) ;
+    C = GB_mex_read (filename) ;
+    assert (isequal (C.class, 'int64')) ;
+    assert (isequal (double (C.matrix), full (A))) ;
+end
+
+%-------------------------------------------------------------------------------
+% coordinate complex hermitian
+%-------------------------------------------------------------------------------
+
+L = tril (sprandn (n, n, 0.1) + 1i * sprandn (n, n, 0.1), -1) ;
+A = L + L' + speye (n) ;
+[i, j, x] = find (tril (A)) ;
+f = fopen (filename, 'w') ;
+fprintf (f, '%%%%MatrixMarket matrix coordinate complex hermitian\n') ;
+fprintf (f, '%d %d %d\n', n, n, length (x)) ;
+fprintf (f, '%d %d %.17g %.17g\n', [i j real(x) imag(x)]') ;
+fclose (f) ;
+C = GB_mex_read (filename) ;
+assert (isequal (C.matrix, A)) ;
+
+%-------------------------------------------------------------------------------
+% array general and symmetric
+%-------------------------------------------------------------------------------
+
+A = rand (30, 20) ;
+f = fopen (filename, 'w') ;
+fprintf (f, '%%%%MatrixMarket matrix array real general\n30 20\n') ;
+fprintf (f, '%.17g\n', A (:)) ;
+fclose (f) ;
+C = GB_mex_read (filename) ;
+assert (isequal (full (C.matrix), A)) ;
+
+A = rand (20) ;
+A = A + A' ;
+f = fopen (filename, 'w') ;
+fprintf (f, '%%%%MatrixMarket matrix array real symmetric\n20 20\n') ;
+for j = 1:20
+    fprintf (f, '%.17g\n', A (j:20, j)) ;
+end
+fclose (f) ;
+C = GB_mex_read (filename) ;
+assert (isequal (full (C.matrix), A)) ;
+
+%-------------------------------------------------------------------------------
+% pattern, with a %%GraphBLAS type
+%-------------------------------------------------------------------------------
+
+C = GB_mex_read ('../Demo/Matrix/cover.mtx') ;
+assert (isequal (C.class, 'logical')) ;
+assert (C.iso) ;
+assert (nnz (C.matrix) == 12) ;
+C = GB_mex_read ('../Demo/Matrix/cover.mtx', 'double') ;
+assert (isequal (C.class, 'double')) ;
+
+%-------------------------------------------------------------------------------
+% invalid files
+%-------------------------------------------------------------------------------
+
+bad = {
+    '%%%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1\n'
+    '%%%%MatrixMarket matrix coordinate real general\n3 3 1\n1 1 1\n2 2 2\n'
+    '%%%%MatrixMarket matrix coordinate real general\n3 3 1\n4 1 1\n'
+    '%%%%MatrixMarket matrix coordinate real general\n3 3 1\n1 1 abc\n'
+    '%%%%MatrixMarket matrix coordinate integer general\n3 3 1\n1 1 1.5\n'
+    '%%%%MatrixMarket matrix coordinate real foo\n3 3 1\n1 1 1\n'
+    '%%%%MatrixMarket matrix array pattern general\n3 3\n'
+    '%%%%MatrixMarket matrix coordinate real symmetric\n3 4 1\n1 1 1\n'
+    '%%%%MatrixMarket matrix coordinate real general\n%%%%GraphBLAS GrB_Foo\n3 3 1\n1 1 1\n'
+    } ;
+for k = 1:length (bad)
+    f = fopen (filename, 'w') ;
+    fprintf (f, bad {k}) ;
+    fclose (f) ;
+    [C, info] = GB_mex_read (filename) ;
+    assert (isempty (C) && info == -3) ;        % GrB_INVALID_VALUE
+end
+
+%-------------------------------------------------------------------------------
+% binary COO
+%-------------------------------------------------------------------------------
+
+m = 300 ;
+n = 200 ;
+A = sprandn (m, n, 0.1) ;
+[i, j, x] = find (A) ;
+nz = length (x) ;
+for index_size = [4 8]
+    itype = sprintf ('uint%d', 8 * index_size) ;
+    for pattern = [false true]
+        f = fopen (filename, 'w') ;
+        for k = 1:nz
+            fwrite (f, [i(k) j(k)] - 1, itype) ;
+            if (~pattern)
+                fwrite (f, x (k), 'double') ;
+            end
+        end
+        fclose (f) ;
+        if (pattern)
+            type = '' ;
+            C = GB_mex_read (filename, type, m, n, index_size) ;
+            assert (isequal (C.class, 'logical')) ;
+            assert (C.iso) ;
+            assert (isequal (C.matrix, A ~= 0)) ;
+        else
+            type = 'double' ;
+            C = GB_mex_read (filename, type, m, n, index_size) ;
+            assert (isequal (C.matrix, A)) ;
+        end
+        % index out of bounds
+        [C, info] = GB_mex_read (filename, type, m-100, n, index_size) ;
+        assert (isempty (C) && info == -105) ;  % GrB_INDEX_OUT_OF_BOUNDS
+    end
+end
+
+delete (filename) ;
+nthreads_set (save_nthreads, save_chunk) ;
+fprintf ('\ntest244: all tests passed\n') ;
@@ -0,0 +1,68 @@
+function test245
+%TEST245 test GxB_Matrix_extractTuples_Ordered
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test245 extractTuples in row or column order\n') ;
+rng ('default') ;
+
+[save_nthreads, save_chunk] = nthreads_get ;
+nthreads_set (4, 1) ;
+
+for xtype = {'double', 'int32', 'single complex'}
+    for m = [1 10 200]
+        for n = [1 10 100]
+            for d = [0.02 0.5 1]
+                A = GB_spec_random (m, n, d, 32, 'double') ;
+                for A_is_csc = 0:1
+                for sparsity = [1 2 4 8]
+                A.is_csc = A_is_csc ;
+                A.sparsity = sparsity ;
+
+                % GB_spec_extractTuples returns the tuples in column order
+                [I2, J2, X2] = GB_spec_extractTuples (A, xtype {1}) ;
+
+                % column order
+                [I1, J1, X1] = GB_mex_extractTuples (A, xtype {1}, 1) ;
+                assert (isequal (I1, I2)) ;
+                assert (isequal (J1, J2)) ;
+                assert (isequal (X1, X2)) ;
+
+                % row order
+                [~, p] = sortrows ([I2 J2]) ;
+                [I1, J1, X1] = GB_mex_extractTuples (A, xtype {1}, 0) ;
+                assert (isequal (I1, I2 (p))) ;
+                assert (isequal (J1, J2 (p))) ;
+                assert (isequal (X1, X2 (p))) ;
+
+                % order as held in A
+                [I1, J1, X1] = GB_mex_extractTuples (A, xtype {1}, -1) ;
+                [~, p1] = sortrows ([I1 J1]) ;
+                assert (isequal (I1 (p1), I2 (p))) ;
+                assert (isequal (J1 (p1), J2 (p))) ;
+                assert (isequal (X1 (p1), X2 (p))) ;
+                end
+                end
+            end
+        end
+    end
+end
+
+% a very sparse hypersparse matrix (the tuples are sorted, not bucketed)
+n = 1e6 ;
+clear A
+A.matrix = sprand (n, n, 1e-9) ;
+A.sparsity = 1 ;
+for A_is_csc = 0:1
+    A.is_csc = A_is_csc ;
+    [I2, J2, X2] = GB_spec_extractTuples (A, 'double') ;
+    [~, p] = sortrows ([I2 J2]) ;
+    [I1, J1, X1] = GB_mex_extractTuples (A, 'double', 0) ;
+    assert (isequal ([I1 J1 X1], [I2(p) J2(p) X2(p)])) ;
+    [I1, J1, X1] = GB_mex_extractTuples (A, 'double', 1) ;
+    assert (isequal ([I1 J1 X1], [I2 J2 X2])) ;
+end
+
+nthreads_set (save_nthreads, save_chunk) ;
+fprintf ('\ntest245: all tests passed\n') ;
@@ -75,6 +75,8 @@ GB_mex_hack (hack) ;
 % tests with high rates (over 100/sec)
 %----------------------------------------
 
+logstat ('test245',t) ; % test GxB_Matrix_extractTuples_Ordered
+logstat ('test244',t) ; % test GxB_Matrix_read_MatrixMarket and binary COO
 logstat ('test243',t) ; % test GxB_Vector_Iterator
 logstat ('test242',t) ; % test GxB_Iterator for matrices
 logstat ('test241',t) ; % test GrB_mxm, triggering the swap_rule